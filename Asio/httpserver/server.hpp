@@ -1,5 +1,6 @@
 #pragma once
 #include "../model/network/network.hpp"
+#include "../model/container/simulate_perfect.hpp"
 
 #include <iostream>
 #include <string>
@@ -10,7 +11,7 @@
 #include <functional>
 #include <filesystem>
 #include <optional>
-#include <unordered_map>
+#include <string_view>
 #include <boost/asio.hpp>
 #include <atomic>
 
@@ -72,7 +73,10 @@ struct status_response
   asset html_500;
 };
 
-static const std::unordered_map<std::string, std::string> extension_map{
+/**
+ * @brief 扩展名到`MIME`类型的映射，编译期建成完美哈希表，查找只做一次键比较
+ */
+static constexpr auto extension_map = standard_con::make_perfect_hash_map<std::string_view, std::string_view>({
     {"html", "text/html"},
     {"htm", "text/html"},
     {"css", "text/css"},
@@ -96,7 +100,7 @@ static const std::unordered_map<std::string, std::string> extension_map{
     {"wav", "audio/wav"},
     {"flac", "audio/flac"},
     {"aac", "audio/aac"},
-};
+});
 
 /**
  * @brief 简单的http静态网页服务器
@@ -117,16 +121,12 @@ private:
    * @brief 获取文件MIME类型
    * @param path 文件路径
    */
-  std::string mime_type(std::string path)
+  static std::string_view mime_type(std::string_view path)
   {
     auto dot = path.rfind('.');
-    if (dot == std::string::npos)
-      return "text/plain";
-    auto ext = std::string(path.substr(dot + 1));
-    auto it = extension_map.find(ext);
-    if (it == extension_map.end())
+    if (dot == std::string_view::npos)
       return "text/plain";
-    return it->second;
+    return extension_map.value_or(path.substr(dot + 1), "text/plain");
   }
 
   /**
@@ -175,7 +175,9 @@ private:
     else
     {
       response.result(boost::beast::http::status::ok);
-      response.base().set(http::field::content_type, mime_type(file_path));
+      // 旧版 Beast 的 string_view 不能由 std::string_view 隐式构造，这里显式转换
+      const std::string_view content_type = mime_type(file_path);
+      response.base().set(http::field::content_type, boost::beast::string_view(content_type.data(), content_type.size()));
       response.body() = std::move(body);
     }
     response.keep_alive(keep_alive);
@@ -2,12 +2,21 @@
 #include "simulate_algorithm.hpp"
 #include "simulate_base.hpp"
 #include "simulate_bloom.hpp"
+#include "simulate_btree.hpp"
+#include "simulate_cache.hpp"
+#include "simulate_cuckoo.hpp"
+#include "simulate_deque.hpp"
+#include "simulate_flat.hpp"
 #include "simulate_imitate.hpp"
 #include "simulate_list.hpp"
 #include "simulate_map.hpp"
+#include "simulate_perfect.hpp"
 #include "simulate_utility.hpp"
 #include "simulate_queue.hpp"
+#include "simulate_radix.hpp"
+#include "simulate_ring.hpp"
 #include "simulate_set.hpp"
+#include "simulate_sketch.hpp"
 #include "simulate_pointer.hpp"
 #include "simulate_stack.hpp"
 #include "simulate_string.hpp"
@@ -1,4 +1,11 @@
 #pragma once
+#include <cstdint>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <thread>
+#include <type_traits>
+#include <utility>
 #include "simulate_exception.hpp"
 #include "simulate_imitate.hpp"
 namespace standard_con
@@ -12,6 +19,10 @@ namespace standard_con
 
   *   - `swap`: 交换函数，交换两个变量的值
 
+  *   - `sort` / `stable_sort` / `radix_sort` / `partial_sort` / `nth_element`: 排序与选择算法
+
+  *   - `parallel_sort` / `parallel_stable_sort` / `parallel_for_each` / `parallel_transform` / `parallel_reduce`: 通过执行器并行执行的算法
+
   *   - `hash_algorithm`: 哈希算法命名空间，提供多种哈希算法实现
   */
   namespace algorithm {}
@@ -144,7 +155,7 @@ namespace standard_con::algorithm
 
       * 模板参数:
 
-      * * - `swap_data_type`: 待交换对象的类型，需支持拷贝构造和赋值操作
+      * * - `swap_data_type`: 待交换对象的类型，需支持移动（或拷贝）构造和赋值操作
 
       * 参数:
 
@@ -164,9 +175,7 @@ namespace standard_con::algorithm
 
       * 注意事项:
 
-      * * - 依赖类型 `swap_data_type` 支持拷贝构造（`swap_data_type temp = a`）和赋值操作（`a = b`、`b = temp`）
-
-      * * - 对于大型对象，此实现可能因拷贝操作导致性能损耗（可考虑为特定类型提供重载版本优化）
+      * * - 通过移动构造和移动赋值交换，没有移动操作的类型退回到拷贝
 
       * * - 交换后，`a` 持有原 `b` 的值，`b` 持有原 `a` 的值
 
@@ -177,8 +186,1202 @@ namespace standard_con::algorithm
   template <typename swap_data_type>
   constexpr void swap(swap_data_type &a, swap_data_type &b) noexcept
   {
-    swap_data_type temp = a;
-    a = b;
-    b = temp;
+    swap_data_type temp = std::move(a);
+    a = std::move(b);
+    b = std::move(temp);
+  }
+  namespace internals
+  {
+    /*
+     * @brief  #### `temporary_buffer` 类模板
+
+        *   - 排序和并行算法使用的临时存储，只分配一次，元素按需原地构造，析构时销毁已构造的元素
+
+        *   - 元素类型只需要可移动构造，不要求默认构造
+    */
+    template <typename buffer_type>
+    class temporary_buffer
+    {
+      std::allocator<buffer_type> allocator_object;
+      buffer_type *buffer_data;
+      uint64_t buffer_capacity;
+      uint64_t constructed_count;
+
+    public:
+      explicit temporary_buffer(const uint64_t capacity_data)
+          : buffer_data(capacity_data == 0 ? nullptr : allocator_object.allocate(capacity_data)),
+            buffer_capacity(capacity_data), constructed_count(0) { ; }
+      temporary_buffer(const temporary_buffer &) = delete;
+      temporary_buffer &operator=(const temporary_buffer &) = delete;
+      ~temporary_buffer()
+      {
+        std::destroy_n(buffer_data, constructed_count);
+        if (buffer_data != nullptr)
+        {
+          allocator_object.deallocate(buffer_data, buffer_capacity);
+        }
+      }
+      template <typename... construct_arguments>
+      buffer_type &emplace_back(construct_arguments &&...buffer_type_arguments)
+      {
+        buffer_type *construct_position = std::construct_at(buffer_data + constructed_count, std::forward<construct_arguments>(buffer_type_arguments)...);
+        ++constructed_count;
+        return *construct_position;
+      }
+      // 调用方已经用 `std::construct_at` 按任意顺序构造了前 `element_count` 个元素
+      void assume_constructed(const uint64_t element_count) noexcept { constructed_count = element_count; }
+
+      [[nodiscard]] buffer_type *data() noexcept { return buffer_data; }
+
+      [[nodiscard]] uint64_t size() const noexcept { return constructed_count; }
+    };
+    // 小区间插入排序，`first` 之前没有哨兵，每一步都检查边界
+    template <typename random_iterator, typename comparators>
+    void insertion_sort(random_iterator first, random_iterator last, comparators &function_policy)
+    {
+      if (first == last)
+      {
+        return;
+      }
+      for (random_iterator current_position = first + 1; current_position != last; ++current_position)
+      {
+        if (!function_policy(*current_position, *(current_position - 1)))
+        {
+          continue;
+        }
+        auto hole_value = std::move(*current_position);
+        random_iterator hole_position = current_position;
+        try
+        {
+          do
+          {
+            *hole_position = std::move(*(hole_position - 1));
+            --hole_position;
+          } while (hole_position != first && function_policy(hole_value, *(hole_position - 1)));
+        }
+        catch (...)
+        {
+          *hole_position = std::move(hole_value); // 比较器抛出异常时把取出的元素放回空位
+          throw;
+        }
+        *hole_position = std::move(hole_value);
+      }
+    }
+    // `first` 之前的元素不大于区间内任何元素，可以省掉边界检查
+    template <typename random_iterator, typename comparators>
+    void unguarded_insertion_sort(random_iterator first, random_iterator last, comparators &function_policy)
+    {
+      if (first == last)
+      {
+        return;
+      }
+      for (random_iterator current_position = first + 1; current_position != last; ++current_position)
+      {
+        if (!function_policy(*current_position, *(current_position - 1)))
+        {
+          continue;
+        }
+        auto hole_value = std::move(*current_position);
+        random_iterator hole_position = current_position;
+        try
+        {
+          do
+          {
+            *hole_position = std::move(*(hole_position - 1));
+            --hole_position;
+          } while (function_policy(hole_value, *(hole_position - 1)));
+        }
+        catch (...)
+        {
+          *hole_position = std::move(hole_value); // 比较器抛出异常时把取出的元素放回空位
+          throw;
+        }
+        *hole_position = std::move(hole_value);
+      }
+    }
+    // 最多移动 8 次的插入排序，超出说明区间不是近乎有序，放弃并返回 false
+    template <typename random_iterator, typename comparators>
+    bool partial_insertion_sort(random_iterator first, random_iterator last, comparators &function_policy)
+    {
+      if (first == last)
+      {
+        return true;
+      }
+      uint64_t move_count = 0;
+      for (random_iterator current_position = first + 1; current_position != last; ++current_position)
+      {
+        if (!function_policy(*current_position, *(current_position - 1)))
+        {
+          continue;
+        }
+        auto hole_value = std::move(*current_position);
+        random_iterator hole_position = current_position;
+        try
+        {
+          do
+          {
+            *hole_position = std::move(*(hole_position - 1));
+            --hole_position;
+          } while (hole_position != first && function_policy(hole_value, *(hole_position - 1)));
+        }
+        catch (...)
+        {
+          *hole_position = std::move(hole_value); // 比较器抛出异常时把取出的元素放回空位
+          throw;
+        }
+        *hole_position = std::move(hole_value);
+        move_count += static_cast<uint64_t>(current_position - hole_position);
+        if (move_count > 8)
+        {
+          return false;
+        }
+      }
+      return true;
+    }
+    template <typename random_iterator, typename value_type, typename comparators>
+    void sift_down(random_iterator first, uint64_t hole_position, const uint64_t heap_size, value_type &&hole_value, comparators &function_policy)
+    {
+      uint64_t child_position = 2 * hole_position + 1;
+      try
+      {
+        while (child_position < heap_size)
+        {
+          if (child_position + 1 < heap_size && function_policy(first[child_position], first[child_position + 1]))
+          {
+            ++child_position;
+          }
+          if (!function_policy(hole_value, first[child_position]))
+          {
+            break;
+          }
+          first[hole_position] = std::move(first[child_position]);
+          hole_position = child_position;
+          child_position = 2 * hole_position + 1;
+        }
+      }
+      catch (...)
+      {
+        first[hole_position] = std::move(hole_value);
+        throw;
+      }
+      first[hole_position] = std::move(hole_value);
+    }
+    template <typename random_iterator, typename comparators>
+    void make_heap(random_iterator first, const uint64_t heap_size, comparators &function_policy)
+    {
+      for (uint64_t parent_position = heap_size / 2; parent_position-- > 0;)
+      {
+        auto hole_value = std::move(first[parent_position]);
+        sift_down(first, parent_position, heap_size, std::move(hole_value), function_policy);
+      }
+    }
+    template <typename random_iterator, typename comparators>
+    void sort_heap(random_iterator first, uint64_t heap_size, comparators &function_policy)
+    {
+      while (heap_size > 1)
+      {
+        --heap_size;
+        auto hole_value = std::move(first[heap_size]);
+        first[heap_size] = std::move(first[0]);
+        sift_down(first, 0, heap_size, std::move(hole_value), function_policy);
+      }
+    }
+    template <typename random_iterator, typename comparators>
+    void heap_sort(random_iterator first, random_iterator last, comparators &function_policy)
+    {
+      const uint64_t heap_size = static_cast<uint64_t>(last - first);
+      make_heap(first, heap_size, function_policy);
+      sort_heap(first, heap_size, function_policy);
+    }
+    template <typename random_iterator, typename comparators>
+    void sort_two(random_iterator first_position, random_iterator second_position, comparators &function_policy)
+    {
+      if (function_policy(*second_position, *first_position))
+      {
+        standard_con::algorithm::swap(*first_position, *second_position);
+      }
+    }
+    template <typename random_iterator, typename comparators>
+    void sort_three(random_iterator first_position, random_iterator second_position, random_iterator third_position, comparators &function_policy)
+    {
+      sort_two(first_position, second_position, function_policy);
+      sort_two(second_position, third_position, function_policy);
+      sort_two(first_position, second_position, function_policy);
+    }
+    // 把中位数放到 `first`，同时保证区间末尾有不小于枢轴的元素作为右侧哨兵
+    template <typename random_iterator, typename comparators>
+    void choose_pivot(random_iterator first, random_iterator last, comparators &function_policy)
+    {
+      const uint64_t element_count = static_cast<uint64_t>(last - first);
+      const uint64_t middle_count = element_count / 2;
+      if (element_count > 128)
+      {
+        // 大区间取九数中位数（ninther），对有规律的输入更稳
+        sort_three(first, first + middle_count, last - 1, function_policy);
+        sort_three(first + 1, first + (middle_count - 1), last - 2, function_policy);
+        sort_three(first + 2, first + (middle_count + 1), last - 3, function_policy);
+        sort_three(first + (middle_count - 1), first + middle_count, first + (middle_count + 1), function_policy);
+        standard_con::algorithm::swap(*first, *(first + middle_count));
+      }
+      else
+      {
+        sort_three(first + middle_count, first, last - 1, function_policy);
+      }
+    }
+    /*
+     * 以 `*first` 为枢轴划分，小于枢轴的在左，其余在右，返回枢轴最终位置
+
+     * `already_partitioned` 表示划分过程中没有发生交换，区间可能本来就有序
+    */
+    template <typename random_iterator, typename comparators>
+    random_iterator partition_right(random_iterator first, random_iterator last, comparators &function_policy, bool &already_partitioned)
+    {
+      auto pivot_value = std::move(*first);
+      random_iterator left_position = first;
+      random_iterator right_position = last;
+      try
+      {
+        while (function_policy(*++left_position, pivot_value))
+        {
+          ;
+        }
+        if (left_position - 1 == first)
+        {
+          while (left_position < right_position && !function_policy(*--right_position, pivot_value))
+          {
+            ;
+          }
+        }
+        else
+        {
+          while (!function_policy(*--right_position, pivot_value))
+          {
+            ;
+          }
+        }
+        already_partitioned = left_position >= right_position;
+        while (left_position < right_position)
+        {
+          standard_con::algorithm::swap(*left_position, *right_position);
+          while (function_policy(*++left_position, pivot_value))
+          {
+            ;
+          }
+          while (!function_policy(*--right_position, pivot_value))
+          {
+            ;
+          }
+        }
+      }
+      catch (...)
+      {
+        *first = std::move(pivot_value); // 划分过程只在 first 之后交换，取出的枢轴放回原位即可
+        throw;
+      }
+      random_iterator pivot_position = left_position - 1;
+      *first = std::move(*pivot_position);
+      *pivot_position = std::move(pivot_value);
+      return pivot_position;
+    }
+    // 枢轴与左侧相邻区间的最大值相等时使用：等于枢轴的元素全部放到左边，之后不再参与排序
+    template <typename random_iterator, typename comparators>
+    random_iterator partition_left(random_iterator first, random_iterator last, comparators &function_policy)
+    {
+      auto pivot_value = std::move(*first);
+      random_iterator left_position = first;
+      random_iterator right_position = last;
+      try
+      {
+        while (function_policy(pivot_value, *--right_position))
+        {
+          ;
+        }
+        if (right_position + 1 == last)
+        {
+          while (left_position < right_position && !function_policy(pivot_value, *++left_position))
+          {
+            ;
+          }
+        }
+        else
+        {
+          while (!function_policy(pivot_value, *++left_position))
+          {
+            ;
+          }
+        }
+        while (left_position < right_position)
+        {
+          standard_con::algorithm::swap(*left_position, *right_position);
+          while (function_policy(pivot_value, *--right_position))
+          {
+            ;
+          }
+          while (!function_policy(pivot_value, *++left_position))
+          {
+            ;
+          }
+        }
+      }
+      catch (...)
+      {
+        *first = std::move(pivot_value);
+        throw;
+      }
+      *first = std::move(*right_position);
+      *right_position = std::move(pivot_value);
+      return right_position;
+    }
+    inline constexpr uint64_t insertion_sort_threshold = 24;
+    inline uint64_t floor_log2(uint64_t value_data) noexcept
+    {
+      uint64_t log_value = 0;
+      while (value_data >>= 1)
+      {
+        ++log_value;
+      }
+      return log_value;
+    }
+    template <typename random_iterator, typename comparators>
+    void pattern_defeating_sort(random_iterator first, random_iterator last, comparators &function_policy, uint64_t bad_partition_allowed, bool leftmost_range)
+    {
+      while (true)
+      {
+        const uint64_t element_count = static_cast<uint64_t>(last - first);
+        if (element_count < insertion_sort_threshold)
+        {
+          if (leftmost_range)
+          {
+            insertion_sort(first, last, function_policy);
+          }
+          else
+          {
+            unguarded_insertion_sort(first, last, function_policy);
+          }
+          return;
+        }
+        choose_pivot(first, last, function_policy);
+        if (!leftmost_range && !function_policy(*(first - 1), *first))
+        {
+          // 枢轴等于左侧已排好的最大值，整段等值元素一次处理完
+          first = partition_left(first, last, function_policy) + 1;
+          continue;
+        }
+        bool already_partitioned = false;
+        random_iterator pivot_position = partition_right(first, last, function_policy, already_partitioned);
+        const uint64_t left_count = static_cast<uint64_t>(pivot_position - first);
+        const uint64_t right_count = static_cast<uint64_t>(last - (pivot_position + 1));
+        if (left_count < element_count / 8 || right_count < element_count / 8)
+        {
+          // 划分严重失衡，次数用完就退回堆排序保证 O(n log n)，否则打乱几个位置破坏输入规律
+          if (--bad_partition_allowed == 0)
+          {
+            heap_sort(first, last, function_policy);
+            return;
+          }
+          if (left_count >= insertion_sort_threshold)
+          {
+            standard_con::algorithm::swap(*first, *(first + left_count / 4));
+            standard_con::algorithm::swap(*(pivot_position - 1), *(pivot_position - left_count / 4));
+          }
+          if (right_count >= insertion_sort_threshold)
+          {
+            standard_con::algorithm::swap(*(pivot_position + 1), *(pivot_position + (1 + right_count / 4)));
+            standard_con::algorithm::swap(*(last - 1), *(last - right_count / 4));
+          }
+        }
+        else if (already_partitioned && partial_insertion_sort(first, pivot_position, function_policy) &&
+                 partial_insertion_sort(pivot_position + 1, last, function_policy))
+        {
+          return; // 输入已经（近乎）有序
+        }
+        pattern_defeating_sort(first, pivot_position, function_policy, bad_partition_allowed, leftmost_range);
+        first = pivot_position + 1;
+        leftmost_range = false;
+      }
+    }
+    template <typename left_iterator, typename right_iterator, typename output_iterator, typename comparators>
+    output_iterator move_merge(left_iterator left_first, left_iterator left_last, right_iterator right_first, right_iterator right_last,
+                               output_iterator output_position, comparators &function_policy)
+    {
+      // 相等时先取左段，保证稳定
+      try
+      {
+        while (left_first != left_last && right_first != right_last)
+        {
+          if (function_policy(*right_first, *left_first))
+          {
+            *output_position = std::move(*right_first);
+            ++right_first;
+          }
+          else
+          {
+            *output_position = std::move(*left_first);
+            ++left_first;
+          }
+          ++output_position;
+        }
+      }
+      catch (...)
+      {
+        // 比较器抛出异常：剩下的元素原样接到输出后面，输出区间仍然持有两段的全部元素
+        for (; left_first != left_last; ++left_first, ++output_position)
+        {
+          *output_position = std::move(*left_first);
+        }
+        for (; right_first != right_last; ++right_first, ++output_position)
+        {
+          *output_position = std::move(*right_first);
+        }
+        throw;
+      }
+      for (; left_first != left_last; ++left_first, ++output_position)
+      {
+        *output_position = std::move(*left_first);
+      }
+      for (; right_first != right_last; ++right_first, ++output_position)
+      {
+        *output_position = std::move(*right_first);
+      }
+      return output_position;
+    }
+    template <typename random_iterator, typename buffer_type, typename comparators>
+    void merge_sort(random_iterator first, random_iterator last, buffer_type *buffer_data, comparators &function_policy)
+    {
+      const uint64_t element_count = static_cast<uint64_t>(last - first);
+      if (element_count <= insertion_sort_threshold)
+      {
+        insertion_sort(first, last, function_policy);
+        return;
+      }
+      const uint64_t middle_count = element_count / 2;
+      random_iterator middle_position = first + middle_count;
+      merge_sort(first, middle_position, buffer_data, function_policy);
+      merge_sort(middle_position, last, buffer_data, function_policy);
+      if (!function_policy(*middle_position, *(middle_position - 1)))
+      {
+        return; // 两段首尾已经有序
+      }
+      // 左半段移到缓冲区，再与右半段归并回原区间；输出位置永远不会越过右段的读位置
+      buffer_type *buffer_position = buffer_data;
+      for (random_iterator move_position = first; move_position != middle_position; ++move_position, ++buffer_position)
+      {
+        *buffer_position = std::move(*move_position);
+      }
+      buffer_type *left_position = buffer_data;
+      buffer_type *left_last = buffer_data + middle_count;
+      random_iterator right_position = middle_position;
+      random_iterator output_position = first;
+      try
+      {
+        while (left_position != left_last)
+        {
+          // 左段取完后右段剩余元素已经在最终位置上，不能再自我移动赋值
+          if (right_position != last && function_policy(*right_position, *left_position))
+          {
+            *output_position = std::move(*right_position);
+            ++right_position;
+          }
+          else
+          {
+            *output_position = std::move(*left_position);
+            ++left_position;
+          }
+          ++output_position;
+        }
+      }
+      catch (...)
+      {
+        // 比较器抛出异常：缓冲区里剩下的左段元素正好填满输出位置和右段读位置之间的空位
+        for (; left_position != left_last; ++left_position, ++output_position)
+        {
+          *output_position = std::move(*left_position);
+        }
+        throw;
+      }
+    }
+    // 缓冲区元素先从区间移入再移回，只为得到已构造的对象
+    template <typename random_iterator>
+    void fill_buffer(temporary_buffer<std::iter_value_t<random_iterator>> &buffer_object, random_iterator first, const uint64_t element_count)
+    {
+      for (uint64_t fill_position = 0; fill_position < element_count; ++fill_position)
+      {
+        buffer_object.emplace_back(std::move(first[fill_position]));
+        first[fill_position] = std::move(buffer_object.data()[fill_position]);
+      }
+    }
+    template <typename key_type>
+    auto radix_key(const key_type &key_data) noexcept
+    {
+      using unsigned_key = std::make_unsigned_t<key_type>;
+      if constexpr (std::is_signed_v<key_type>)
+      {
+        // 翻转符号位，负数排在正数前面
+        return static_cast<unsigned_key>(static_cast<unsigned_key>(key_data) ^ (unsigned_key(1) << (sizeof(key_type) * 8 - 1)));
+      }
+      else
+      {
+        return static_cast<unsigned_key>(key_data);
+      }
+    }
+    struct identity_key
+    {
+      template <typename value_type>
+      const value_type &operator()(const value_type &value_data) const noexcept
+      {
+        return value_data;
+      }
+    };
+    inline uint64_t parallel_task_count(const uint64_t &requested_count) noexcept
+    {
+      if (requested_count != 0)
+      {
+        return requested_count;
+      }
+      const uint64_t hardware_count = std::thread::hardware_concurrency();
+      return hardware_count == 0 ? 1 : hardware_count;
+    }
+    inline uint64_t parallel_chunk_count(const uint64_t &element_count, const uint64_t &task_count, const uint64_t &minimum_grain) noexcept
+    {
+      const uint64_t grain_count = element_count / minimum_grain;
+      const uint64_t chunk_count = task_count < grain_count ? task_count : grain_count;
+      return chunk_count == 0 ? 1 : chunk_count;
+    }
+    /*
+     * 把 [0, element_count) 平均切成 `chunk_count` 段，前 `chunk_count - 1` 段提交给执行器，最后一段在调用线程执行
+
+     * 所有任务结束后才返回；任何一段抛出的异常会在全部任务完成后重新抛出，保证任务不会访问已经失效的栈上数据
+    */
+    template <typename executor_type, typename chunk_function>
+    void run_chunks(executor_type &executor, const uint64_t element_count, const uint64_t chunk_count, chunk_function &chunk_body)
+    {
+      auto make_task = [&chunk_body, element_count, chunk_count](const uint64_t chunk_index)
+      {
+        return [&chunk_body, element_count, chunk_count, chunk_index]()
+        {
+          chunk_body(chunk_index, element_count * chunk_index / chunk_count, element_count * (chunk_index + 1) / chunk_count);
+        };
+      };
+      if (chunk_count <= 1)
+      {
+        make_task(0)();
+        return;
+      }
+      using future_type = decltype(executor.submit(make_task(0)));
+      temporary_buffer<future_type> pending_futures(chunk_count - 1);
+      std::exception_ptr first_exception;
+      try
+      {
+        for (uint64_t chunk_index = 0; chunk_index + 1 < chunk_count; ++chunk_index)
+        {
+          pending_futures.emplace_back(executor.submit(make_task(chunk_index)));
+        }
+        make_task(chunk_count - 1)();
+      }
+      catch (...)
+      {
+        first_exception = std::current_exception();
+      }
+      for (uint64_t future_index = 0; future_index < pending_futures.size(); ++future_index)
+      {
+        try
+        {
+          pending_futures.data()[future_index].get();
+        }
+        catch (...)
+        {
+          if (!first_exception)
+          {
+            first_exception = std::current_exception();
+          }
+        }
+      }
+      if (first_exception)
+      {
+        std::rethrow_exception(first_exception);
+      }
+    }
+    struct merge_piece
+    {
+      uint64_t left_begin;
+      uint64_t left_end;
+      uint64_t right_begin;
+      uint64_t right_end;
+      uint64_t output_begin;
+      bool merge_started; // 开始归并后无论是否抛出异常，这一片的元素都会全部落在目标区间
+    };
+    /*
+     * 一轮并行归并：相邻两段有序区间合成一段，结果写到目标区间的相同位置
+
+     * 每对区间再按较长一段的等分点切成若干片，另一段用二分找到对应切点，各片互不重叠、可以独立归并，且保持稳定
+
+     * 抛出异常时所有元素都已经搬到目标区间（顺序未定），调用方只需记住数据在哪一边
+    */
+    template <typename executor_type, typename source_iterator, typename target_iterator, typename comparators>
+    void parallel_merge_round(executor_type &executor, source_iterator source_first, target_iterator target_first,
+                              const uint64_t *run_boundaries, const uint64_t run_count, const uint64_t task_count, comparators &function_policy)
+    {
+      const uint64_t pair_count = run_count / 2;
+      const uint64_t pieces_per_pair = pair_count >= task_count ? 1 : task_count / pair_count;
+      temporary_buffer<merge_piece> merge_pieces(pair_count * pieces_per_pair + 1);
+      merge_piece *piece_data = merge_pieces.data();
+      bool pieces_ready = false;
+      try
+      {
+        for (uint64_t pair_index = 0; pair_index < pair_count; ++pair_index)
+        {
+          const uint64_t left_begin = run_boundaries[2 * pair_index];
+          const uint64_t middle_boundary = run_boundaries[2 * pair_index + 1];
+          const uint64_t right_end = run_boundaries[2 * pair_index + 2];
+          const bool split_left = middle_boundary - left_begin >= right_end - middle_boundary;
+          uint64_t previous_left = left_begin;
+          uint64_t previous_right = middle_boundary;
+          for (uint64_t piece_index = 1; piece_index <= pieces_per_pair; ++piece_index)
+          {
+            uint64_t next_left = middle_boundary;
+            uint64_t next_right = right_end;
+            if (piece_index != pieces_per_pair)
+            {
+              if (split_left)
+              {
+                // 左段切点的值 v，右段取第一个不小于 v 的位置
+                next_left = left_begin + (middle_boundary - left_begin) * piece_index / pieces_per_pair;
+                uint64_t search_low = previous_right;
+                uint64_t search_high = right_end;
+                while (search_low < search_high)
+                {
+                  const uint64_t search_middle = search_low + (search_high - search_low) / 2;
+                  if (function_policy(source_first[search_middle], source_first[next_left]))
+                  {
+                    search_low = search_middle + 1;
+                  }
+                  else
+                  {
+                    search_high = search_middle;
+                  }
+                }
+                next_right = search_low;
+              }
+              else
+              {
+                // 右段切点的值 v，左段取第一个大于 v 的位置，相等元素留在左边的片里
+                next_right = middle_boundary + (right_end - middle_boundary) * piece_index / pieces_per_pair;
+                uint64_t search_low = previous_left;
+                uint64_t search_high = middle_boundary;
+                while (search_low < search_high)
+                {
+                  const uint64_t search_middle = search_low + (search_high - search_low) / 2;
+                  if (!function_policy(source_first[next_right], source_first[search_middle]))
+                  {
+                    search_low = search_middle + 1;
+                  }
+                  else
+                  {
+                    search_high = search_middle;
+                  }
+                }
+                next_left = search_low;
+              }
+            }
+            merge_pieces.emplace_back(merge_piece{previous_left, next_left, previous_right, next_right,
+                                                  previous_left + (previous_right - middle_boundary), false});
+            previous_left = next_left;
+            previous_right = next_right;
+          }
+        }
+        if (run_count % 2 == 1)
+        {
+          // 落单的最后一段原样搬过去
+          const uint64_t tail_begin = run_boundaries[run_count - 1];
+          const uint64_t tail_end = run_boundaries[run_count];
+          merge_pieces.emplace_back(merge_piece{tail_begin, tail_end, tail_end, tail_end, tail_begin, false});
+        }
+        auto merge_body = [&](uint64_t, const uint64_t piece_begin, const uint64_t piece_end)
+        {
+          comparators local_policy = function_policy;
+          for (uint64_t piece_index = piece_begin; piece_index < piece_end; ++piece_index)
+          {
+            merge_piece &current_piece = piece_data[piece_index];
+            current_piece.merge_started = true;
+            move_merge(source_first + current_piece.left_begin, source_first + current_piece.left_end,
+                       source_first + current_piece.right_begin, source_first + current_piece.right_end,
+                       target_first + current_piece.output_begin, local_policy);
+          }
+        };
+        pieces_ready = true;
+        run_chunks(executor, merge_pieces.size(), merge_pieces.size(), merge_body);
+      }
+      catch (...)
+      {
+        // 切分时比较器抛出异常，或者任务没能提交：还没开始归并的元素原样搬到目标区间
+        if (!pieces_ready)
+        {
+          for (uint64_t move_position = run_boundaries[0]; move_position < run_boundaries[run_count]; ++move_position)
+          {
+            target_first[move_position] = std::move(source_first[move_position]);
+          }
+          throw;
+        }
+        for (uint64_t piece_index = 0; piece_index < merge_pieces.size(); ++piece_index)
+        {
+          const merge_piece &current_piece = piece_data[piece_index];
+          if (!current_piece.merge_started)
+          {
+            uint64_t output_position = current_piece.output_begin;
+            for (uint64_t move_position = current_piece.left_begin; move_position < current_piece.left_end; ++move_position, ++output_position)
+            {
+              target_first[output_position] = std::move(source_first[move_position]);
+            }
+            for (uint64_t move_position = current_piece.right_begin; move_position < current_piece.right_end; ++move_position, ++output_position)
+            {
+              target_first[output_position] = std::move(source_first[move_position]);
+            }
+          }
+        }
+        throw;
+      }
+    }
+    template <bool stable_order, typename executor_type, typename random_iterator, typename comparators>
+    void parallel_sort_dispatch(executor_type &executor, random_iterator first, random_iterator last, comparators &function_policy, const uint64_t requested_tasks)
+    {
+      using value_type = std::iter_value_t<random_iterator>;
+      const uint64_t element_count = static_cast<uint64_t>(last - first);
+      const uint64_t task_count = parallel_task_count(requested_tasks);
+      const uint64_t chunk_count = parallel_chunk_count(element_count, task_count, uint64_t(1) << 14);
+      auto sort_range = [](auto range_first, auto range_last, comparators &range_policy)
+      {
+        if constexpr (stable_order)
+        {
+          const uint64_t range_count = static_cast<uint64_t>(range_last - range_first);
+          temporary_buffer<std::iter_value_t<decltype(range_first)>> merge_buffer(range_count / 2);
+          fill_buffer(merge_buffer, range_first, range_count / 2);
+          merge_sort(range_first, range_last, merge_buffer.data(), range_policy);
+        }
+        else
+        {
+          if (range_last - range_first > 1)
+          {
+            pattern_defeating_sort(range_first, range_last, range_policy, floor_log2(static_cast<uint64_t>(range_last - range_first)), true);
+          }
+        }
+      };
+      if (chunk_count <= 1)
+      {
+        sort_range(first, last, function_policy);
+        return;
+      }
+      // 数据先整体移进缓冲区，各段在缓冲区里并行排序，然后在缓冲区和原区间之间来回归并
+      temporary_buffer<value_type> sort_buffer(element_count);
+      temporary_buffer<uint64_t> run_boundaries(chunk_count + 1);
+      for (uint64_t chunk_index = 0; chunk_index <= chunk_count; ++chunk_index)
+      {
+        run_boundaries.emplace_back(element_count * chunk_index / chunk_count);
+      }
+      value_type *buffer_data = sort_buffer.data();
+      // 每一轮归并中途抛出异常时，元素全部落在这一轮的目标区间（见 move_merge），所以只需记住数据当前在哪一边
+      bool data_in_buffer = true;
+      try
+      {
+        for (random_iterator move_position = first; move_position != last; ++move_position)
+        {
+          sort_buffer.emplace_back(std::move(*move_position));
+        }
+        auto sort_body = [&](uint64_t, const uint64_t chunk_begin, const uint64_t chunk_end)
+        {
+          comparators local_policy = function_policy;
+          sort_range(buffer_data + chunk_begin, buffer_data + chunk_end, local_policy);
+        };
+        run_chunks(executor, element_count, chunk_count, sort_body);
+        uint64_t run_count = chunk_count;
+        uint64_t *boundary_data = run_boundaries.data();
+        while (run_count > 1)
+        {
+          data_in_buffer = !data_in_buffer;
+          if (data_in_buffer)
+          {
+            parallel_merge_round(executor, first, buffer_data, boundary_data, run_count, task_count, function_policy);
+          }
+          else
+          {
+            parallel_merge_round(executor, buffer_data, first, boundary_data, run_count, task_count, function_policy);
+          }
+          // 合并后的边界是原来的偶数位边界，落单段的右边界保留
+          const uint64_t next_run_count = (run_count + 1) / 2;
+          for (uint64_t boundary_index = 1; boundary_index <= next_run_count; ++boundary_index)
+          {
+            boundary_data[boundary_index] = boundary_data[boundary_index * 2 > run_count ? run_count : boundary_index * 2];
+          }
+          run_count = next_run_count;
+        }
+      }
+      catch (...)
+      {
+        // 元素还在缓冲区里时搬回原区间再抛出，原区间保留全部元素（顺序未定）
+        if (data_in_buffer)
+        {
+          for (uint64_t move_position = 0; move_position < sort_buffer.size(); ++move_position)
+          {
+            first[move_position] = std::move(buffer_data[move_position]);
+          }
+        }
+        throw;
+      }
+      if (data_in_buffer)
+      {
+        auto move_body = [&](uint64_t, const uint64_t chunk_begin, const uint64_t chunk_end)
+        {
+          for (uint64_t move_position = chunk_begin; move_position < chunk_end; ++move_position)
+          {
+            first[move_position] = std::move(buffer_data[move_position]);
+          }
+        };
+        run_chunks(executor, element_count, chunk_count, move_body);
+      }
+    }
+  }
+  /*
+   * @brief  #### `sort` 函数模板
+
+      *   - 不稳定排序，pattern-defeating quicksort（内省排序的改进版）
+
+      *   - 九数取中选枢轴；大量重复元素一次划分收尾；近乎有序的区间提前结束；划分持续失衡时退回堆排序，最坏 O(n log n)
+
+      * 模板参数:
+
+      * * - `random_iterator`: 随机访问迭代器（含原生指针）
+      *
+      * * - `comparators`: 严格弱序比较器，默认为 `standard_con::less`
+
+      * 注意事项:
+
+      * * - 元素类型需要可移动构造和移动赋值
+  */
+  template <typename random_iterator, typename comparators = standard_con::less<std::iter_value_t<random_iterator>>>
+  void sort(random_iterator first, random_iterator last, comparators function_policy = comparators())
+  {
+    if (last - first < 2)
+    {
+      return;
+    }
+    internals::pattern_defeating_sort(first, last, function_policy, internals::floor_log2(static_cast<uint64_t>(last - first)), true);
+  }
+  /*
+   * @brief  #### `stable_sort` 函数模板
+
+      *   - 稳定排序，自顶向下归并排序，短区间插入排序，借用 n/2 个元素的临时缓冲区，O(n log n)
+
+      *   - 等价元素保持原有的相对顺序
+  */
+  template <typename random_iterator, typename comparators = standard_con::less<std::iter_value_t<random_iterator>>>
+  void stable_sort(random_iterator first, random_iterator last, comparators function_policy = comparators())
+  {
+    const uint64_t element_count = static_cast<uint64_t>(last - first);
+    if (element_count < 2)
+    {
+      return;
+    }
+    internals::temporary_buffer<std::iter_value_t<random_iterator>> merge_buffer(element_count / 2);
+    internals::fill_buffer(merge_buffer, first, element_count / 2);
+    internals::merge_sort(first, last, merge_buffer.data(), function_policy);
+  }
+  /*
+   * @brief  #### `radix_sort` 函数模板
+
+      *   - 按整数键的 LSD 基数排序，每轮 8 位，稳定，O(n * sizeof(key))，不做元素比较
+
+      *   - 一次扫描统计所有轮次的直方图，某一位上所有键都相同时跳过该轮
+
+      * 参数:
+
+      * * - `key_function`: 从元素取出整数键的函数对象，默认取元素本身；有符号键按数值顺序排列
+
+      * 注意事项:
+
+      * * - 需要与输入等长的临时缓冲区，适合大批量的整数或带整数键的记录（时间戳、ID）
+  */
+  template <typename random_iterator, typename key_extractor = internals::identity_key>
+  void radix_sort(random_iterator first, random_iterator last, key_extractor key_function = key_extractor())
+  {
+    using value_type = std::iter_value_t<random_iterator>;
+    using key_type = std::remove_cvref_t<std::invoke_result_t<key_extractor &, const value_type &>>;
+    static_assert(std::is_integral_v<key_type>, "radix_sort requires an integral key");
+    constexpr uint64_t digit_count = sizeof(key_type);
+    const uint64_t element_count = static_cast<uint64_t>(last - first);
+    if (element_count < 2)
+    {
+      return;
+    }
+    if (element_count <= internals::insertion_sort_threshold)
+    {
+      auto key_less = [&key_function](const value_type &left_value, const value_type &right_value)
+      {
+        return internals::radix_key(key_function(left_value)) < internals::radix_key(key_function(right_value));
+      };
+      internals::insertion_sort(first, last, key_less);
+      return;
+    }
+    uint64_t digit_histogram[digit_count][256] = {};
+    for (random_iterator count_position = first; count_position != last; ++count_position)
+    {
+      auto unsigned_key = internals::radix_key(key_function(*count_position));
+      for (uint64_t digit_index = 0; digit_index < digit_count; ++digit_index)
+      {
+        ++digit_histogram[digit_index][(unsigned_key >> (digit_index * 8)) & 0xFF];
+      }
+    }
+    internals::temporary_buffer<value_type> sort_buffer(element_count);
+    value_type *buffer_data = sort_buffer.data();
+    bool buffer_constructed = false;
+    bool data_in_buffer = false;
+    for (uint64_t digit_index = 0; digit_index < digit_count; ++digit_index)
+    {
+      uint64_t *bucket_count = digit_histogram[digit_index];
+      bool single_bucket = false;
+      uint64_t bucket_offset = 0;
+      for (uint64_t bucket_index = 0; bucket_index < 256; ++bucket_index)
+      {
+        const uint64_t current_count = bucket_count[bucket_index];
+        single_bucket = single_bucket || current_count == element_count;
+        bucket_count[bucket_index] = bucket_offset;
+        bucket_offset += current_count;
+      }
+      if (single_bucket)
+      {
+        continue; // 这一位所有键都相同
+      }
+      if (!buffer_constructed)
+      {
+        buffer_constructed = true;
+        if constexpr (std::is_nothrow_move_constructible_v<value_type>)
+        {
+          // 第一轮直接分发到未构造的缓冲区，每个位置恰好构造一次
+          for (random_iterator scatter_position = first; scatter_position != last; ++scatter_position)
+          {
+            const uint64_t bucket_index = (internals::radix_key(key_function(*scatter_position)) >> (digit_index * 8)) & 0xFF;
+            std::construct_at(buffer_data + bucket_count[bucket_index]++, std::move(*scatter_position));
+          }
+          sort_buffer.assume_constructed(element_count);
+          data_in_buffer = true;
+          continue;
+        }
+        else
+        {
+          internals::fill_buffer(sort_buffer, first, element_count);
+        }
+      }
+      if (data_in_buffer)
+      {
+        for (uint64_t scatter_index = 0; scatter_index < element_count; ++scatter_index)
+        {
+          const uint64_t bucket_index = (internals::radix_key(key_function(buffer_data[scatter_index])) >> (digit_index * 8)) & 0xFF;
+          first[bucket_count[bucket_index]++] = std::move(buffer_data[scatter_index]);
+        }
+      }
+      else
+      {
+        for (random_iterator scatter_position = first; scatter_position != last; ++scatter_position)
+        {
+          const uint64_t bucket_index = (internals::radix_key(key_function(*scatter_position)) >> (digit_index * 8)) & 0xFF;
+          buffer_data[bucket_count[bucket_index]++] = std::move(*scatter_position);
+        }
+      }
+      data_in_buffer = !data_in_buffer;
+    }
+    if (data_in_buffer)
+    {
+      for (uint64_t move_index = 0; move_index < element_count; ++move_index)
+      {
+        first[move_index] = std::move(buffer_data[move_index]);
+      }
+    }
+  }
+  /*
+   * @brief  #### `partial_sort` 函数模板
+
+      *   - 把整个区间中最小的 `middle - first` 个元素按顺序放到 [first, middle)，其余元素顺序不定
+
+      *   - 在前段维护大顶堆，O(n log k)，适合从大批数据中取 top-k
+  */
+  template <typename random_iterator, typename comparators = standard_con::less<std::iter_value_t<random_iterator>>>
+  void partial_sort(random_iterator first, random_iterator middle, random_iterator last, comparators function_policy = comparators())
+  {
+    const uint64_t heap_size = static_cast<uint64_t>(middle - first);
+    if (heap_size == 0)
+    {
+      return;
+    }
+    internals::make_heap(first, heap_size, function_policy);
+    for (random_iterator scan_position = middle; scan_position != last; ++scan_position)
+    {
+      if (function_policy(*scan_position, *first))
+      {
+        auto hole_value = std::move(*scan_position);
+        *scan_position = std::move(*first);
+        internals::sift_down(first, 0, heap_size, std::move(hole_value), function_policy);
+      }
+    }
+    internals::sort_heap(first, heap_size, function_policy);
+  }
+  /*
+   * @brief  #### `nth_element` 函数模板
+
+      *   - 重排区间使 `*nth` 等于完整排序后该位置的元素，左侧元素都不大于它，右侧都不小于它
+
+      *   - 内省选择：快速选择平均 O(n)，划分次数超出限制时退回堆排序剩余区间
+  */
+  template <typename random_iterator, typename comparators = standard_con::less<std::iter_value_t<random_iterator>>>
+  void nth_element(random_iterator first, random_iterator nth, random_iterator last, comparators function_policy = comparators())
+  {
+    if (nth == last)
+    {
+      return;
+    }
+    uint64_t depth_limit = 2 * internals::floor_log2(static_cast<uint64_t>(last - first) + 1);
+    while (static_cast<uint64_t>(last - first) > internals::insertion_sort_threshold)
+    {
+      if (depth_limit-- == 0)
+      {
+        internals::heap_sort(first, last, function_policy);
+        return;
+      }
+      internals::choose_pivot(first, last, function_policy);
+      bool already_partitioned = false;
+      random_iterator pivot_position = internals::partition_right(first, last, function_policy, already_partitioned);
+      if (pivot_position == nth)
+      {
+        return;
+      }
+      if (nth < pivot_position)
+      {
+        last = pivot_position;
+      }
+      else
+      {
+        first = pivot_position + 1;
+      }
+    }
+    internals::insertion_sort(first, last, function_policy);
+  }
+  /*
+   * @brief  #### 并行算法
+
+      *   - `executor` 是任意提供 `submit(callable)` 并返回可 `get()` 的 future 的执行器，例如 `wan::pool::thread_pool`
+
+      *   - `task_count` 为期望的并行度，0 表示 `std::thread::hardware_concurrency()`；区间太小时直接在调用线程执行
+
+      *   - 调用线程也执行一段任务并等待其余任务结束，不要在执行器自己的线程里调用，否则线程占满时可能死锁
+
+      *   - 任务抛出的异常在所有任务结束后重新抛给调用方
+  */
+  template <typename executor_type>
+  concept task_executor = requires(executor_type &executor, void (*task_function)()) { executor.submit(task_function).get(); };
+
+  /*
+   * @brief  #### `parallel_sort` 函数模板
+
+      *   - 各段并行做 `sort`，再逐轮并行归并；每对归并按切点分成多片，最后一轮也能用满所有任务
+
+      *   - 需要与输入等长的临时缓冲区；结果与 `sort` 相同（等价元素顺序不定）
+  */
+  template <task_executor executor_type, typename random_iterator, typename comparators = standard_con::less<std::iter_value_t<random_iterator>>>
+  void parallel_sort(executor_type &executor, random_iterator first, random_iterator last, comparators function_policy = comparators(), const uint64_t task_count = 0)
+  {
+    internals::parallel_sort_dispatch<false>(executor, first, last, function_policy, task_count);
   }
-}
\ No newline at end of file
+  /*
+   * @brief  #### `parallel_stable_sort` 函数模板
+
+      *   - 与 `parallel_sort` 相同，但各段使用 `stable_sort`，归并也保持稳定
+  */
+  template <task_executor executor_type, typename random_iterator, typename comparators = standard_con::less<std::iter_value_t<random_iterator>>>
+  void parallel_stable_sort(executor_type &executor, random_iterator first, random_iterator last, comparators function_policy = comparators(), const uint64_t task_count = 0)
+  {
+    internals::parallel_sort_dispatch<true>(executor, first, last, function_policy, task_count);
+  }
+  /*
+   * @brief  #### `parallel_for_each` 函数模板
+
+      *   - 把区间分段并行地对每个元素调用 `element_function`，每段使用函数对象的一份拷贝
+  */
+  template <task_executor executor_type, typename random_iterator, typename function_type>
+  void parallel_for_each(executor_type &executor, random_iterator first, random_iterator last, function_type element_function, const uint64_t task_count = 0)
+  {
+    const uint64_t element_count = static_cast<uint64_t>(last - first);
+    const uint64_t chunk_count = internals::parallel_chunk_count(element_count, internals::parallel_task_count(task_count), 2048);
+    auto chunk_body = [&](uint64_t, const uint64_t chunk_begin, const uint64_t chunk_end)
+    {
+      function_type local_function = element_function;
+      for (uint64_t element_index = chunk_begin; element_index < chunk_end; ++element_index)
+      {
+        local_function(first[element_index]);
+      }
+    };
+    internals::run_chunks(executor, element_count, chunk_count, chunk_body);
+  }
+  /*
+   * @brief  #### `parallel_transform` 函数模板
+
+      *   - 并行计算 `output[i] = transform_function(first[i])`，返回输出区间的尾后位置
+
+      *   - 输出迭代器必须是随机访问的，且输出区间已有足够的元素
+  */
+  template <task_executor executor_type, typename random_iterator, typename output_iterator, typename function_type>
+  output_iterator parallel_transform(executor_type &executor, random_iterator first, random_iterator last, output_iterator output_first,
+                                     function_type transform_function, const uint64_t task_count = 0)
+  {
+    const uint64_t element_count = static_cast<uint64_t>(last - first);
+    const uint64_t chunk_count = internals::parallel_chunk_count(element_count, internals::parallel_task_count(task_count), 2048);
+    auto chunk_body = [&](uint64_t, const uint64_t chunk_begin, const uint64_t chunk_end)
+    {
+      function_type local_function = transform_function;
+      for (uint64_t element_index = chunk_begin; element_index < chunk_end; ++element_index)
+      {
+        output_first[element_index] = local_function(first[element_index]);
+      }
+    };
+    internals::run_chunks(executor, element_count, chunk_count, chunk_body);
+    return output_first + element_count;
+  }
+  /*
+   * @brief  #### `parallel_reduce` 函数模板
+
+      *   - 各段并行归约，再按段的顺序把部分结果与 `initial_value` 合并
+
+      *   - `reduce_function` 必须满足结合律；不要求交换律，各段结果按原顺序合并
+
+      *   - 每段以该段第一个元素作为初值，元素类型需要能构造出 `result_type`
+  */
+  template <task_executor executor_type, typename random_iterator, typename result_type, typename function_type>
+  result_type parallel_reduce(executor_type &executor, random_iterator first, random_iterator last, result_type initial_value,
+                              function_type reduce_function, const uint64_t task_count = 0)
+  {
+    const uint64_t element_count = static_cast<uint64_t>(last - first);
+    if (element_count == 0)
+    {
+      return initial_value;
+    }
+    const uint64_t chunk_count = internals::parallel_chunk_count(element_count, internals::parallel_task_count(task_count), 2048);
+    internals::temporary_buffer<result_type> partial_results(chunk_count);
+    for (uint64_t chunk_index = 0; chunk_index < chunk_count; ++chunk_index)
+    {
+      partial_results.emplace_back(initial_value);
+    }
+    result_type *partial_data = partial_results.data();
+    auto chunk_body = [&](const uint64_t chunk_index, const uint64_t chunk_begin, const uint64_t chunk_end)
+    {
+      function_type local_function = reduce_function;
+      result_type chunk_result(first[chunk_begin]);
+      for (uint64_t element_index = chunk_begin + 1; element_index < chunk_end; ++element_index)
+      {
+        chunk_result = local_function(std::move(chunk_result), first[element_index]);
+      }
+      partial_data[chunk_index] = std::move(chunk_result);
+    };
+    internals::run_chunks(executor, element_count, chunk_count, chunk_body);
+    for (uint64_t chunk_index = 0; chunk_index < chunk_count; ++chunk_index)
+    {
+      initial_value = reduce_function(std::move(initial_value), std::move(partial_data[chunk_index]));
+    }
+    return initial_value;
+  }
+}
@@ -1,4 +1,11 @@
 #pragma once
+#include <bit>
+#include <iterator>
+#include <memory>
+#include <new>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
 #include "simulate_stack.hpp"
 #include "simulate_vector.hpp"
 #include "simulate_algorithm.hpp"
@@ -8,6 +15,155 @@
 #include "simulate_hash.hpp"
 namespace base_container
 {
+  /*
+      * @brief  #### `node_pool` 类模板
+
+      *   - 节点容器专用的分块内存池：节点从成批申请的连续内存块（slab）里切出来，释放的节点挂到空闲链表上复用
+
+      *   - 由容器独占持有，`release_all()` 一次性归还全部内存块，不需要逐个节点 delete
+
+      * 模板参数:
+
+      * * - `pool_node_type`: 节点类型
+
+      * 主要方法:
+
+      * * - `create(args...)`: 取一个槽位并原地构造节点，构造抛异常时槽位会退回
+      *
+      * * - `destroy(node)`: 析构节点并把槽位挂回空闲链表
+      *
+      * * - `reserve(count)`: 保证之后 count 个 `create()` 落在同一块连续内存里（空闲链表为空时）
+      *
+      * * - `release_all()`: 归还所有内存块，调用前节点必须已经析构或为平凡析构类型
+
+      * 特性:
+
+      * * - 内存块容量从 32 个槽位开始翻倍，上限 4096，之后每块固定 4096 个槽位
+      *
+      * * - 不可拷贝，可移动和交换，交换后节点仍由原来的内存块承载
+  */
+  template <typename pool_node_type>
+  class node_pool
+  {
+    union pool_slot
+    {
+      pool_slot *next_free_slot;
+      alignas(pool_node_type) unsigned char node_storage[sizeof(pool_node_type)];
+    };
+    static constexpr uint64_t minimum_slab_slots = 32;
+    static constexpr uint64_t maximum_slab_slots = 4096;
+    standard_con::vector<standard_con::pair<pool_slot *, uint64_t>> slab_table; // 内存块首地址和槽位数
+    pool_slot *free_slot_list;
+    pool_slot *bump_position; // 当前内存块中下一个未切出的槽位
+    pool_slot *bump_end;
+    void append_slab(const uint64_t &slot_count)
+    {
+      std::allocator<pool_slot> slot_allocator;
+      pool_slot *new_slab = slot_allocator.allocate(slot_count);
+      try
+      {
+        slab_table.push_back(standard_con::pair<pool_slot *, uint64_t>(new_slab, slot_count));
+      }
+      catch (...)
+      {
+        slot_allocator.deallocate(new_slab, slot_count);
+        throw;
+      }
+      bump_position = new_slab;
+      bump_end = new_slab + slot_count;
+    }
+    [[nodiscard]] pool_slot *take_slot()
+    {
+      if (free_slot_list != nullptr)
+      {
+        pool_slot *reuse_slot = free_slot_list;
+        free_slot_list = free_slot_list->next_free_slot;
+        return reuse_slot;
+      }
+      if (bump_position == bump_end)
+      {
+        const uint64_t last_slots = slab_table.size() == 0 ? 0 : slab_table.back().second;
+        uint64_t next_slots = last_slots * 2;
+        next_slots = next_slots < minimum_slab_slots ? minimum_slab_slots : next_slots;
+        next_slots = next_slots > maximum_slab_slots ? maximum_slab_slots : next_slots;
+        append_slab(next_slots);
+      }
+      return bump_position++;
+    }
+    void give_back_slot(pool_slot *slot_pointer) noexcept
+    {
+      slot_pointer->next_free_slot = free_slot_list;
+      free_slot_list = slot_pointer;
+    }
+
+  public:
+    node_pool() noexcept
+        : free_slot_list(nullptr), bump_position(nullptr), bump_end(nullptr) { ; }
+    node_pool(const node_pool &) = delete;
+    node_pool &operator=(const node_pool &) = delete;
+    node_pool(node_pool &&node_pool_data) noexcept
+        : slab_table(std::move(node_pool_data.slab_table)), free_slot_list(node_pool_data.free_slot_list),
+          bump_position(node_pool_data.bump_position), bump_end(node_pool_data.bump_end)
+    {
+      node_pool_data.free_slot_list = node_pool_data.bump_position = node_pool_data.bump_end = nullptr;
+    }
+    node_pool &operator=(node_pool &&node_pool_data) noexcept
+    {
+      if (this != &node_pool_data)
+      {
+        release_all();
+        swap(node_pool_data);
+      }
+      return *this;
+    }
+    ~node_pool() noexcept
+    {
+      release_all();
+    }
+    template <typename... construct_arguments>
+    [[nodiscard]] pool_node_type *create(construct_arguments &&...node_arguments)
+    {
+      pool_slot *slot_pointer = take_slot();
+      try
+      {
+        return ::new (static_cast<void *>(slot_pointer->node_storage)) pool_node_type(std::forward<construct_arguments>(node_arguments)...);
+      }
+      catch (...)
+      {
+        give_back_slot(slot_pointer);
+        throw;
+      }
+    }
+    void destroy(pool_node_type *node_pointer) noexcept
+    {
+      node_pointer->~pool_node_type();
+      give_back_slot(reinterpret_cast<pool_slot *>(node_pointer));
+    }
+    void reserve(const uint64_t &node_count)
+    {
+      if (free_slot_list == nullptr && static_cast<uint64_t>(bump_end - bump_position) < node_count)
+      {
+        append_slab(node_count);
+      }
+    }
+    void release_all() noexcept
+    {
+      std::allocator<pool_slot> slot_allocator;
+      for (auto &slab_traversal : slab_table)
+      {
+        slot_allocator.deallocate(slab_traversal.first, slab_traversal.second);
+      }
+      slab_table.clear();
+      free_slot_list = bump_position = bump_end = nullptr;
+    }
+    void swap(node_pool &node_pool_data) noexcept
+    {
+      slab_table.swap(node_pool_data.slab_table);
+      standard_con::algorithm::swap(free_slot_list, node_pool_data.free_slot_list);
+      standard_con::algorithm::swap(bump_position, node_pool_data.bump_position);
+      standard_con::algorithm::swap(bump_end, node_pool_data.bump_end);
+    }
+  };
   /*
       * @brief  #### `red_black_tree` 类模板
 
@@ -51,12 +207,20 @@ namespace base_container
       *
       * * - 移动构造函数: 接管另一个临时红黑树的资源，原树根节点置空
       *
-      * * - 拷贝构造函数: 深拷贝另一个红黑树，复制节点数据、颜色和父子关系
+      * * - 拷贝构造函数: 按源树的中序序列 O(n) 重建一棵完全平衡的树，不逐个插入
+      *
+      * * - 有序区间构造: 从按比较器严格递增的区间 O(n) 建树，区间无序或有重复时抛出异常
 
       * 析构函数:
 
       * * - 调用 `clear(_root)` 释放所有节点资源
 
+      * 节点内存:
+
+      * * - 节点由树独占的 `node_pool` 分配，批量建树时节点连续存放
+      *
+      * * - `clear()` 析构全部节点后一次性归还所有内存块
+
       * 主要操作方法:
 
       * * - `push()`: 插入值节点（支持拷贝和移动语义）
@@ -72,10 +236,20 @@ namespace base_container
       *
       * * - `find(const rb_tree_type_value& val_data)`: 查找指定值的节点，返回迭代器（找到）或 `end()`（未找到）
       *
-      * * - `size()`: 返回节点总数（常量和非常量版本）
+      * * - `size()`: 返回节点总数，O(1)
+      *
+      * * - `lower_bound()` / `upper_bound()` / `equal_range()`: 按键做区间查找
+      *
+      * * - `select(k)` / `rank(key)`: 第 k 小的元素 / 严格小于 key 的元素个数，O(log n)
+      *
+      * * - `count_range(low, high)`: `[low, high)` 内的元素个数，O(log n)
       *
       * * - `empty()`: 判断树是否为空（根节点为 `nullptr` 则返回 `true`）
       *
+      * * - `assign_sorted(first, last)`: 用严格递增区间整体替换树的内容，O(n)，出错时原树不变
+      *
+      * * - `clear()`: 清空树并归还节点内存池
+      *
       *
       *   - `middle_order_traversal()`: 中序遍历，打印节点数据（结果为有序序列）
       *
@@ -95,6 +269,8 @@ namespace base_container
       *
       * * - 红黑特性: 严格遵守五大红黑树特性，保证任意路径的黑节点数相同，避免失衡
       *
+      * * - 子树大小: 每个节点记录子树节点数，插入删除沿路径加减，旋转时只重算两个节点
+      *
       * * - 迭代器有效性: 插入和删除操作可能改变结构，但迭代器仍能正确遍历
       *
       * * - 支持移动语义: 减少不必要的拷贝，提高插入和赋值效率
@@ -128,14 +304,15 @@ namespace base_container
       rb_tree_node *_left;
       rb_tree_node *_right;
       rb_tree_node *_parent;
+      uint64_t _subtree_size; // 以该节点为根的子树节点数，用于按名次查找
       rb_tree_color _color;
       explicit rb_tree_node(const rb_tree_type_value &val_data = rb_tree_type_value())
-          : _data(val_data), _left(nullptr), _right(nullptr), _parent(nullptr), _color(rb_tree_color::red)
+          : _data(val_data), _left(nullptr), _right(nullptr), _parent(nullptr), _subtree_size(1), _color(rb_tree_color::red)
       {
         ;
       }
       explicit rb_tree_node(rb_tree_type_value &&val_data) noexcept
-          : _data(std::move(val_data)), _left(nullptr), _right(nullptr), _parent(nullptr), _color(rb_tree_color::red)
+          : _data(std::move(val_data)), _left(nullptr), _right(nullptr), _parent(nullptr), _subtree_size(1), _color(rb_tree_color::red)
       {
       }
     };
@@ -301,8 +478,25 @@ namespace base_container
     };
     using container_node = rb_tree_node;
     container_node *_root;
-    container_imitate_function_visit element;
-    container_imitate_function function_policy;
+    mutable container_imitate_function_visit element; // 仿函数的 operator() 不一定是 const，查询接口是 const 的
+    mutable container_imitate_function function_policy;
+    node_pool<container_node> node_allocator; // 节点内存池，clear 时整体归还
+    static inline uint64_t subtree_size(const container_node *subtree_node) noexcept
+    {
+      return subtree_node == nullptr ? 0 : subtree_node->_subtree_size;
+    }
+    static inline void update_subtree_size(container_node *subtree_node) noexcept
+    {
+      subtree_node->_subtree_size = subtree_size(subtree_node->_left) + subtree_size(subtree_node->_right) + 1;
+    }
+    static inline void adjust_path_size(container_node *lowest_node, const bool increase) noexcept
+    {
+      // 插入或摘除一个节点后，沿父指针把路径上每个祖先的子树大小加一或减一
+      for (; lowest_node != nullptr; lowest_node = lowest_node->_parent)
+      {
+        increase ? ++lowest_node->_subtree_size : --lowest_node->_subtree_size;
+      }
+    }
     void left_revolve(container_node *subtree_node)
     {
       try
@@ -352,6 +546,9 @@ namespace base_container
         }
         sub_tree_right_node->_parent = parent_node;
       }
+      // 旋转只影响这两个节点的子树大小，先算下面的再算上面的
+      update_subtree_size(subtree_node);
+      update_subtree_size(sub_tree_right_node);
     }
     void right_revolve(container_node *subtree_node)
     {
@@ -397,33 +594,135 @@ namespace base_container
         }
         sub_tree_left_node->_parent = parent_node;
       }
+      update_subtree_size(subtree_node);
+      update_subtree_size(sub_tree_left_node);
+    }
+    void destroy_subtree(container_node *subtree_node) noexcept
+    {
+      // 借父指针做后序遍历，不需要额外的栈；平凡析构的节点不用逐个析构，直接等内存池整体归还
+      if constexpr (!std::is_trivially_destructible_v<container_node>)
+      {
+        while (subtree_node != nullptr)
+        {
+          if (subtree_node->_left != nullptr)
+          {
+            container_node *child_node = subtree_node->_left;
+            subtree_node->_left = nullptr;
+            subtree_node = child_node;
+          }
+          else if (subtree_node->_right != nullptr)
+          {
+            container_node *child_node = subtree_node->_right;
+            subtree_node->_right = nullptr;
+            subtree_node = child_node;
+          }
+          else
+          {
+            container_node *parent_node = subtree_node->_parent;
+            node_allocator.destroy(subtree_node);
+            subtree_node = parent_node;
+          }
+        }
+      }
+      else
+      {
+        (void)subtree_node;
+      }
     }
     void clear(container_node *clear_node_ptr) noexcept
     {
-      if (clear_node_ptr == nullptr)
+      // 树被 pop 空后根为空，但内存块还在池里，同样要归还
+      if (clear_node_ptr != nullptr)
+      {
+        clear_node_ptr->_parent = nullptr;
+        destroy_subtree(clear_node_ptr);
+      }
+      node_allocator.release_all();
+      _root = nullptr;
+    }
+    template <typename value_producer>
+    container_node *build_balanced(const uint64_t &node_count, const uint64_t &node_depth, const uint64_t &red_depth, value_producer &producer)
+    {
+      // 按中序消费有序输入：左右子树节点数最多差 1，除最深一层外每层都是满的
+      // 最深一层染红，其余染黑，每条路径的黑节点数相同
+      if (node_count == 0)
+      {
+        return nullptr;
+      }
+      const uint64_t left_count = (node_count - 1) / 2;
+      container_node *left_node = build_balanced(left_count, node_depth + 1, red_depth, producer);
+      container_node *middle_node = nullptr;
+      try
+      {
+        middle_node = node_allocator.create(producer());
+      }
+      catch (...)
+      {
+        destroy_subtree(left_node);
+        throw;
+      }
+      middle_node->_color = node_depth == red_depth ? rb_tree_color::red : rb_tree_color::black;
+      middle_node->_subtree_size = node_count;
+      middle_node->_left = left_node;
+      if (left_node != nullptr)
+      {
+        left_node->_parent = middle_node;
+      }
+      try
+      {
+        middle_node->_right = build_balanced(node_count - 1 - left_count, node_depth + 1, red_depth, producer);
+      }
+      catch (...)
+      {
+        destroy_subtree(middle_node);
+        throw;
+      }
+      if (middle_node->_right != nullptr)
+      {
+        middle_node->_right->_parent = middle_node;
+      }
+      return middle_node;
+    }
+    template <typename value_producer>
+    void build_from_producer(const uint64_t &node_count, value_producer &producer)
+    {
+      // 只在空树上调用，节点一次性落在同一块连续内存里
+      if (node_count == 0)
       {
         return;
       }
-      else
+      node_allocator.reserve(node_count);
+      _root = build_balanced(node_count, 0, static_cast<uint64_t>(std::bit_width(node_count)) - 1, producer);
+      _root->_parent = nullptr;
+      _root->_color = rb_tree_color::black;
+    }
+    template <typename sorted_iterator>
+    void build_from_sorted(sorted_iterator first_iterator, sorted_iterator last_iterator)
+    {
+      // 先过一遍输入：计数并确认按比较器严格递增，不满足时树保持不变
+      uint64_t node_count = 0;
+      try
       {
-        standard_con::stack<container_node *> resource_cleanup_stack;
-        resource_cleanup_stack.push(clear_node_ptr);
-        while (!resource_cleanup_stack.empty())
+        sorted_iterator previous_iterator = first_iterator;
+        for (sorted_iterator check_iterator = first_iterator; check_iterator != last_iterator; ++check_iterator, ++node_count)
         {
-          clear_node_ptr = resource_cleanup_stack.top();
-          resource_cleanup_stack.pop();
-          if (clear_node_ptr->_right != nullptr)
-          {
-            resource_cleanup_stack.push(clear_node_ptr->_right);
-          }
-          if (clear_node_ptr->_left != nullptr)
+          if (node_count != 0 && !function_policy(element(*previous_iterator), element(*check_iterator)))
           {
-            resource_cleanup_stack.push(clear_node_ptr->_left);
+            throw custom_exception::fault("输入序列不是严格递增的", "red_black_tree::assign_sorted", __LINE__);
           }
-          delete clear_node_ptr;
+          previous_iterator = check_iterator;
         }
-        _root = nullptr;
       }
+      catch (const custom_exception::fault &process)
+      {
+        std::cerr << process.what() << " " << process.function_name_get() << " " << process.line_number_get() << std::endl;
+        throw;
+      }
+      auto producer = [&first_iterator]() -> decltype(auto)
+      {
+        return *first_iterator++;
+      };
+      build_from_producer(node_count, producer);
     }
     void interior_middle_order_traversal(container_node *intermediate_traversal_node)
     {
@@ -487,32 +786,97 @@ namespace base_container
     {
       return get_color(current_node) == rb_tree_color::black;
     }
-    [[nodiscard]] uint64_t _size() const
+    template <typename lookup_type>
+    [[nodiscard]] container_node *lower_bound_node(const lookup_type &key_data) const
     {
-      uint64_t size = 0;
-      if (_root == nullptr)
+      // 第一个不小于 key_data 的节点
+      container_node *reference_node = _root;
+      container_node *candidate_node = nullptr;
+      while (reference_node != nullptr)
       {
-        return size;
+        if (function_policy(element(reference_node->_data), key_data))
+        {
+          reference_node = reference_node->_right;
+        }
+        else
+        {
+          candidate_node = reference_node;
+          reference_node = reference_node->_left;
+        }
       }
+      return candidate_node;
+    }
+    template <typename lookup_type>
+    [[nodiscard]] container_node *upper_bound_node(const lookup_type &key_data) const
+    {
+      // 第一个大于 key_data 的节点
       container_node *reference_node = _root;
-      standard_con::stack<container_node *> interior_stack;
-      interior_stack.push(reference_node);
-      while (!interior_stack.empty())
+      container_node *candidate_node = nullptr;
+      while (reference_node != nullptr)
       {
-        reference_node = interior_stack.top();
-        interior_stack.pop();
-
-        size++;
-        if (reference_node->_right != nullptr)
+        if (function_policy(key_data, element(reference_node->_data)))
         {
-          interior_stack.push(reference_node->_right);
+          candidate_node = reference_node;
+          reference_node = reference_node->_left;
         }
-        if (reference_node->_left != nullptr)
+        else
         {
-          interior_stack.push(reference_node->_left);
+          reference_node = reference_node->_right;
+        }
+      }
+      return candidate_node;
+    }
+    template <typename lookup_type>
+    [[nodiscard]] container_node *find_node(const lookup_type &key_data) const
+    {
+      container_node *candidate_node = lower_bound_node(key_data);
+      if (candidate_node != nullptr && !function_policy(key_data, element(candidate_node->_data)))
+      {
+        return candidate_node;
+      }
+      return nullptr;
+    }
+    template <typename lookup_type>
+    [[nodiscard]] uint64_t count_less(const lookup_type &key_data) const
+    {
+      // 往右走时左子树和当前节点都排在前面，一次下降累加出名次
+      uint64_t less_count = 0;
+      container_node *reference_node = _root;
+      while (reference_node != nullptr)
+      {
+        if (function_policy(element(reference_node->_data), key_data))
+        {
+          less_count += subtree_size(reference_node->_left) + 1;
+          reference_node = reference_node->_right;
+        }
+        else
+        {
+          reference_node = reference_node->_left;
+        }
+      }
+      return less_count;
+    }
+    [[nodiscard]] container_node *select_node(uint64_t order_index) const
+    {
+      container_node *reference_node = _root;
+      while (reference_node != nullptr)
+      {
+        const uint64_t left_size = subtree_size(reference_node->_left);
+        if (order_index < left_size)
+        {
+          reference_node = reference_node->_left;
+        }
+        else if (order_index == left_size)
+        {
+          return reference_node;
+        }
+        else
+        {
+          order_index -= left_size + 1;
+          reference_node = reference_node->_right;
         }
       }
-      return size;
+      return nullptr;
     }
 
   public:
@@ -529,16 +893,26 @@ namespace base_container
     }
     explicit red_black_tree(const rb_tree_type_value &rb_tree_data)
     {
-      _root = new container_node(rb_tree_data);
+      _root = node_allocator.create(rb_tree_data);
       _root->_color = rb_tree_color::black;
     }
     explicit red_black_tree(rb_tree_type_value &&rb_tree_data) noexcept
     {
-      _root = new container_node(std::forward<rb_tree_type_value>(rb_tree_data));
+      _root = node_allocator.create(std::forward<rb_tree_type_value>(rb_tree_data));
       _root->_color = rb_tree_color::black;
     }
+    /*
+     * 从按比较器严格递增的序列 O(n) 建树，不做任何旋转，序列无序或有重复时抛出异常
+     */
+    template <std::forward_iterator sorted_iterator>
+    red_black_tree(sorted_iterator first_iterator, sorted_iterator last_iterator)
+        : _root(nullptr)
+    {
+      build_from_sorted(first_iterator, last_iterator);
+    }
     red_black_tree(red_black_tree &&rb_tree_data) noexcept
-        : element(rb_tree_data.element), function_policy(rb_tree_data.function_policy)
+        : element(rb_tree_data.element), function_policy(rb_tree_data.function_policy),
+          node_allocator(std::move(rb_tree_data.node_allocator))
     {
       _root = std::move(rb_tree_data._root);
       rb_tree_data._root = nullptr;
@@ -546,99 +920,59 @@ namespace base_container
     red_black_tree(const red_black_tree &rb_tree_data)
         : _root(nullptr), element(rb_tree_data.element), function_policy(rb_tree_data.function_policy)
     {
-      if (rb_tree_data._root == nullptr)
+      // 源树的中序序列本身有序，直接按有序序列建树，节点连续存放
+      const_iterator source_iterator = rb_tree_data.cbegin();
+      auto producer = [&source_iterator]() -> const rb_tree_type_value &
       {
-        _root = nullptr;
-      }
-      else
-      {
-        // 使用单栈，存储源节点和目标父节点（均为一级指针）
-        standard_con::stack<standard_con::pair<container_node *, container_node *>> stack;
-
-        // 创建根节点
-        _root = new container_node(rb_tree_data._root->_data);
-        _root->_color = rb_tree_data._root->_color;
-        _root->_parent = nullptr; // 根节点的父节点为nullptr
-
-        // 初始化栈，将根节点的子节点压入（注意：这里父节点是 _ROOT，一级指针）
-        if (rb_tree_data._root->_right != nullptr)
-        {
-          stack.push(standard_con::pair<container_node *, container_node *>(rb_tree_data._root->_right, _root));
-        }
-        if (rb_tree_data._root->_left != nullptr)
-        {
-          stack.push(standard_con::pair<container_node *, container_node *>(rb_tree_data._root->_left, _root));
-        }
-
-        // 遍历并复制剩余节点
-        while (!stack.empty())
-        {
-          auto [first_node, parent_node] = stack.top();
-          stack.pop();
-
-          // 创建新节点并复制数据
-          auto *new_structure_node = new container_node(first_node->_data);
-          new_structure_node->_color = first_node->_color;
-
-          // 设置父节点关系（注意：parent_node 是一级指针）
-          new_structure_node->_parent = parent_node;
-
-          // 判断源节点在原树中是左子还是右子
-          bool isleft_child = false;
-          if (first_node->_parent != nullptr)
-          {
-            isleft_child = (first_node->_parent->_left == first_node);
-          }
-
-          // 将新节点链接到父节点的正确位置（注意：直接使用 parent_node）
-          if (isleft_child)
-          {
-            parent_node->_left = new_structure_node;
-          }
-          else
-          {
-            parent_node->_right = new_structure_node;
-          }
-
-          // 处理子节点（注意：压栈时父节点是 new_node，一级指针）
-          if (first_node->_right != nullptr)
-          {
-            stack.push(standard_con::pair<container_node *, container_node *>(first_node->_right, new_structure_node));
-          }
-          if (first_node->_left != nullptr)
-          {
-            stack.push(standard_con::pair<container_node *, container_node *>(first_node->_left, new_structure_node));
-          }
-        }
-      }
+        const rb_tree_type_value &source_value = *source_iterator;
+        ++source_iterator;
+        return source_value;
+      };
+      build_from_producer(rb_tree_data.size(), producer);
     }
-    red_black_tree &operator=(const red_black_tree rb_tree_data)
+    red_black_tree &operator=(const red_black_tree &rb_tree_data)
     {
-      if (this == &rb_tree_data)
-      {
-        return *this;
-      }
-      else
+      if (this != &rb_tree_data)
       {
-        clear(_root);
-        standard_con::algorithm::swap(rb_tree_data._root, _root);
-        standard_con::algorithm::swap(rb_tree_data.element, element);
-        standard_con::algorithm::swap(rb_tree_data.function_policy, function_policy);
-        return *this;
+        red_black_tree temporary_tree(rb_tree_data);
+        swap(temporary_tree);
       }
+      return *this;
     }
     red_black_tree &operator=(red_black_tree &&rb_tree_data) noexcept
     {
       if (this != &rb_tree_data)
       {
-        clear();
+        clear(_root);
         function_policy = std::move(rb_tree_data.function_policy);
         element = std::move(rb_tree_data.element);
+        node_allocator = std::move(rb_tree_data.node_allocator);
         _root = std::move(rb_tree_data._root);
         rb_tree_data._root = nullptr;
       }
       return *this;
     }
+    void swap(red_black_tree &rb_tree_data) noexcept
+    {
+      standard_con::algorithm::swap(_root, rb_tree_data._root);
+      standard_con::algorithm::swap(element, rb_tree_data.element);
+      standard_con::algorithm::swap(function_policy, rb_tree_data.function_policy);
+      node_allocator.swap(rb_tree_data.node_allocator);
+    }
+    void clear() noexcept
+    {
+      clear(_root);
+    }
+    template <std::forward_iterator sorted_iterator>
+    void assign_sorted(sorted_iterator first_iterator, sorted_iterator last_iterator)
+    {
+      // 先在临时树上建好再交换，出错时原树不变
+      red_black_tree temporary_tree;
+      temporary_tree.element = element;
+      temporary_tree.function_policy = function_policy;
+      temporary_tree.build_from_sorted(first_iterator, last_iterator);
+      swap(temporary_tree);
+    }
     ~red_black_tree() noexcept
     {
       clear(_root);
@@ -647,7 +981,7 @@ namespace base_container
     {
       if (_root == nullptr)
       {
-        _root = new container_node(value_data);
+        _root = node_allocator.create(value_data);
         _root->_color = rb_tree_color::black;
         return return_pair_value(iterator(_root), true);
       }
@@ -674,7 +1008,7 @@ namespace base_container
           }
         }
         // 找到插入位置
-        reference_node = new container_node(value_data);
+        reference_node = node_allocator.create(value_data);
         if (function_policy(element(parent_node->_data), element(reference_node->_data)))
         {
           parent_node->_right = reference_node;
@@ -685,6 +1019,7 @@ namespace base_container
         }
         reference_node->_color = rb_tree_color::red;
         reference_node->_parent = parent_node;
+        adjust_path_size(parent_node, true);
         container_node *return_push_node = reference_node;
         // 保存节点
         // 开始调整，向上调整颜色节点
@@ -763,7 +1098,7 @@ namespace base_container
     {
       if (_root == nullptr)
       {
-        _root = new container_node(std::forward<rb_tree_type_value>(value_data));
+        _root = node_allocator.create(std::forward<rb_tree_type_value>(value_data));
         _root->_color = rb_tree_color::black;
         return return_pair_value(iterator(_root), true);
       }
@@ -790,7 +1125,7 @@ namespace base_container
           }
         }
         // 找到插入位置
-        reference_node = new container_node(std::forward<rb_tree_type_value>(value_data));
+        reference_node = node_allocator.create(std::forward<rb_tree_type_value>(value_data));
         if (function_policy(element(parent_node->_data), element(reference_node->_data)))
         {
           parent_node->_right = reference_node;
@@ -801,6 +1136,7 @@ namespace base_container
         }
         reference_node->_color = rb_tree_color::red;
         reference_node->_parent = parent_node;
+        adjust_path_size(parent_node, true);
         container_node *return_push_node = reference_node;
         // 保存节点
         // 开始调整，向上调整颜色节点
@@ -900,63 +1236,48 @@ namespace base_container
     */
     void delete_adjust(container_node *current_node, container_node *parent)
     {
-      // cur为被删节点的替代节点
+      // cur为被删节点的替代节点，可能为空，所以父节点单独传入
       if (current_node == nullptr && parent == nullptr)
       {
         return;
       }
-      while (current_node != _root && (current_node == nullptr || black_get(current_node)))
+      while (current_node != _root && black_get(current_node))
       {
-        if (current_node == _root)
-        {
-          break;
-        }
         if (parent->_left == current_node)
         {
           container_node *brother = parent->_right;
           if (red_get(brother))
           {
-            // 情况1：兄弟节点为红
+            // 情况1：兄弟节点为红，转成兄弟为黑的情况
             brother->_color = rb_tree_color::black;
             parent->_color = rb_tree_color::red;
             left_revolve(parent);
-            // 调整后，兄弟节点为黑
-            // 继续向下调整
             brother = parent->_right;
           }
-          if ((brother != nullptr && black_get(brother)) && (brother->_left == nullptr || (brother->_left)) &&
-              (brother->_right == nullptr || black_get(brother->_right)))
+          if (black_get(brother->_left) && black_get(brother->_right))
           {
-            // 情况2：兄弟节点为黑，且兄弟节点两个子节点都为黑
+            // 情况2：兄弟节点为黑，且兄弟节点两个子节点都为黑，问题上移到父节点
             brother->_color = rb_tree_color::red;
             current_node = parent;
             parent = current_node->_parent;
-            if (current_node->_color == rb_tree_color::red)
-            {
-              current_node->_color = rb_tree_color::black;
-              break;
-            }
-          }
-          else if ((brother != nullptr && black_get(brother)) && (brother->_right == nullptr || black_get(brother->_right)) &&
-                   (brother->_left != nullptr && red_get(brother->_left)))
-          {
-            // 情况3：兄弟节点为黑，兄弟节点左节点为红，右节点为黑
-            brother->_left->_color = rb_tree_color::black;
-            brother->_color = rb_tree_color::red;
-            right_revolve(brother);
-            // 调整后，兄弟节点为黑，兄弟节点右节点为红
-            // 继续向下调整
-            brother = parent->_right;
           }
-          else if ((brother != nullptr || black_get(brother)) && (brother->_right != nullptr && red_get(brother->_right)))
+          else
           {
+            if (black_get(brother->_right))
+            {
+              // 情况3：兄弟节点为黑，兄弟节点左节点为红，右节点为黑，转成情况4
+              brother->_left->_color = rb_tree_color::black;
+              brother->_color = rb_tree_color::red;
+              right_revolve(brother);
+              brother = parent->_right;
+            }
             // 情况4：兄弟节点为黑，兄弟节点右节点为红
             brother->_color = parent->_color;
             parent->_color = rb_tree_color::black;
             brother->_right->_color = rb_tree_color::black;
             left_revolve(parent);
             current_node = _root;
-            parent = current_node->_parent;
+            break;
           }
         }
         else
@@ -968,42 +1289,32 @@ namespace base_container
             brother->_color = rb_tree_color::black;
             parent->_color = rb_tree_color::red;
             right_revolve(parent);
-            // 调整后，兄弟节点为黑
             brother = parent->_left;
           }
-          if (brother != nullptr && black_get(brother) && (brother->_left == nullptr || black_get(brother->_left)) &&
-              (brother->_right == nullptr || black_get(brother->_right)))
+          if (black_get(brother->_left) && black_get(brother->_right))
           {
             // 情况2：兄弟节点为黑，且兄弟节点两个子节点都为黑
             brother->_color = rb_tree_color::red;
             current_node = parent;
             parent = current_node->_parent;
-            if (current_node->_color == rb_tree_color::red)
-            {
-              current_node->_color = rb_tree_color::black;
-              break;
-            }
-          }
-          else if (brother != nullptr && black_get(brother) && (brother->_right != nullptr && red_get(brother->_right)) &&
-                   (brother->_left == nullptr || black_get(brother->_left)))
-          {
-            // 情况3：兄弟节点为黑，兄弟节点左节点为红，右节点为黑
-            brother->_right->_color = rb_tree_color::black;
-            brother->_color = rb_tree_color::red;
-            left_revolve(brother);
-            // 调整后，兄弟节点为黑，兄弟节点右节点为红
-            // 继续向下调整
-            brother = parent->_left;
           }
-          else if (brother != nullptr && black_get(brother) && brother->_left != nullptr && red_get(brother->_left))
+          else
           {
-            // 情况4：兄弟节点为黑，兄弟节点右节点为红
+            if (black_get(brother->_left))
+            {
+              // 情况3：兄弟节点为黑，兄弟节点右节点为红，左节点为黑
+              brother->_right->_color = rb_tree_color::black;
+              brother->_color = rb_tree_color::red;
+              left_revolve(brother);
+              brother = parent->_left;
+            }
+            // 情况4：兄弟节点为黑，兄弟节点左节点为红
             brother->_color = parent->_color;
             parent->_color = rb_tree_color::black;
             brother->_left->_color = rb_tree_color::black;
             right_revolve(parent);
             current_node = _root;
-            parent = current_node->_parent;
+            break;
           }
         }
       }
@@ -1073,7 +1384,7 @@ namespace base_container
           }
           adjust_node = reference_node->_right;
           adjust_parent_node = parent_node;
-          delete reference_node;
+          node_allocator.destroy(reference_node);
           reference_node = nullptr;
         }
         else if (reference_node->_right == nullptr)
@@ -1101,7 +1412,7 @@ namespace base_container
           }
           adjust_node = reference_node->_left;
           adjust_parent_node = parent_node;
-          delete reference_node;
+          node_allocator.destroy(reference_node);
           reference_node = nullptr;
         }
         else if (reference_node->_right != nullptr && reference_node->_left != nullptr)
@@ -1115,9 +1426,8 @@ namespace base_container
           }
           delete_color = right_subtree_smallest_node->_color;
 
-          // 交换数据 AND 交换颜色
+          // 只交换数据，颜色留在原位置上，真正摘掉的是后继节点，调整按后继节点的颜色进行
           standard_con::algorithm::swap(right_subtree_smallest_node->_data, reference_node->_data);
-          standard_con::algorithm::swap(right_subtree_smallest_node->_color, reference_node->_color);
 
           // 然后正确地把后继节点的位置接到它父节点上：
           if (smallest_parent_node->_left == right_subtree_smallest_node)
@@ -1136,9 +1446,11 @@ namespace base_container
           adjust_parent_node = smallest_parent_node;
 
           // 最后再 delete 那个后继节点
-          delete right_subtree_smallest_node;
+          node_allocator.destroy(right_subtree_smallest_node);
           right_subtree_smallest_node = nullptr;
         }
+        // 先修正子树大小，调整阶段的旋转依赖孩子的子树大小是正确的
+        adjust_path_size(adjust_parent_node, false);
         // 更新颜色
         if (delete_color == rb_tree_color::black)
         {
@@ -1149,43 +1461,110 @@ namespace base_container
         {
           _root->_color = rb_tree_color::black;
         }
-        return return_pair_value(iterator(nullptr), false);
+        return return_pair_value(iterator(nullptr), true);
       }
     }
     iterator find(const rb_tree_type_value &val_data)
     {
-      if (_root == nullptr)
-      {
-        return iterator(nullptr);
-      }
-      else
-      {
-        container_node *root_find_node = _root;
-        while (root_find_node != nullptr)
-        {
-          if (!function_policy(element(root_find_node->_data), element(val_data)))
-          {
-            return iterator(root_find_node);
-          }
-          else if (function_policy(element(root_find_node->_data), element(val_data)))
-          {
-            root_find_node = root_find_node->_right;
-          }
-          else
-          {
-            root_find_node = root_find_node->_left;
-          }
-        }
-        return iterator(nullptr);
-      }
+      return iterator(find_node(element(val_data)));
     }
-    uint64_t size()
+    /*
+     * 以下按键查询，均为一次自顶向下的 O(log n) 下降
+     *
+     * rank(key) 为严格小于 key 的元素个数；select(k) 为第 k 小（从 0 开始）的元素，k 越界时返回 end()
+     *
+     * count_range(low, high) 为落在 [low, high) 内的元素个数
+     */
+    iterator lower_bound(const rb_tree_type_key &key_data)
+    {
+      return iterator(lower_bound_node(key_data));
+    }
+    const_iterator lower_bound(const rb_tree_type_key &key_data) const
     {
-      return _size();
+      return const_iterator(lower_bound_node(key_data));
     }
-    [[nodiscard]] uint64_t size() const
+    iterator upper_bound(const rb_tree_type_key &key_data)
+    {
+      return iterator(upper_bound_node(key_data));
+    }
+    const_iterator upper_bound(const rb_tree_type_key &key_data) const
+    {
+      return const_iterator(upper_bound_node(key_data));
+    }
+    standard_con::pair<iterator, iterator> equal_range(const rb_tree_type_key &key_data)
+    {
+      return standard_con::pair<iterator, iterator>(lower_bound(key_data), upper_bound(key_data));
+    }
+    [[nodiscard]] bool contains(const rb_tree_type_key &key_data) const
+    {
+      return find_node(key_data) != nullptr;
+    }
+    [[nodiscard]] uint64_t rank(const rb_tree_type_key &key_data) const
+    {
+      return count_less(key_data);
+    }
+    iterator find_key(const rb_tree_type_key &key_data)
+    {
+      return iterator(find_node(key_data));
+    }
+    /*
+     * 异构查找：比较器带有 `is_transparent` 时，按键查询接受任意能与键比较的类型（如用 `std::string_view` 查 `string` 键），不构造临时键
+     */
+    template <typename lookup_type>
+      requires standard_con::transparent_function<container_imitate_function>
+    iterator find_key(const lookup_type &key_data)
+    {
+      return iterator(find_node(key_data));
+    }
+    template <typename lookup_type>
+      requires standard_con::transparent_function<container_imitate_function>
+    iterator lower_bound(const lookup_type &key_data)
+    {
+      return iterator(lower_bound_node(key_data));
+    }
+    template <typename lookup_type>
+      requires standard_con::transparent_function<container_imitate_function>
+    iterator upper_bound(const lookup_type &key_data)
+    {
+      return iterator(upper_bound_node(key_data));
+    }
+    template <typename lookup_type>
+      requires standard_con::transparent_function<container_imitate_function>
+    standard_con::pair<iterator, iterator> equal_range(const lookup_type &key_data)
+    {
+      return standard_con::pair<iterator, iterator>(lower_bound(key_data), upper_bound(key_data));
+    }
+    template <typename lookup_type>
+      requires standard_con::transparent_function<container_imitate_function>
+    [[nodiscard]] bool contains(const lookup_type &key_data) const
+    {
+      return find_node(key_data) != nullptr;
+    }
+    template <typename lookup_type>
+      requires standard_con::transparent_function<container_imitate_function>
+    [[nodiscard]] uint64_t rank(const lookup_type &key_data) const
+    {
+      return count_less(key_data);
+    }
+    iterator select(const uint64_t order_index)
     {
-      return _size();
+      return iterator(select_node(order_index));
+    }
+    const_iterator select(const uint64_t order_index) const
+    {
+      return const_iterator(select_node(order_index));
+    }
+    [[nodiscard]] uint64_t count_range(const rb_tree_type_key &low_key, const rb_tree_type_key &high_key) const
+    {
+      if (!function_policy(low_key, high_key))
+      {
+        return 0;
+      }
+      return count_less(high_key) - count_less(low_key);
+    }
+    [[nodiscard]] uint64_t size() const noexcept
+    {
+      return subtree_size(_root);
     }
     bool empty()
     {
@@ -1318,9 +1697,20 @@ namespace base_container
 
       *    返回指向元素的迭代器（找到）或 `end()`（未找到）
       *
+      * * - `insert()`: 插入元素，返回 `pair<iterator, bool>`，键已存在时迭代器指向已有元素
+      *
+      * * - `clear()`: 释放所有元素，保留桶数组容量
+      *
+      * * - `erase(iterator)`: 按迭代器删除，不再计算哈希值，返回下一个元素的迭代器
+      *
+      * * - `move_to_back()` / `move_to_front()` / `move_after(position, anchor)`: O(1) 调整元素在全局链表中的位置，
+      *     供 `lru_cache` / `lfu_cache` 把全局链表当作淘汰顺序使用
+      *
       * * - `operator[](const hash_table_type_key& key_value)`: 通过键查找元素
       *     计算键的哈希值找到对应桶，遍历桶内链表比较键，返回指向元素的迭代器（找到）或 `end()`（未找到）
       *
+      * * - `contains(key)`: 判断键是否存在；`hash_function` 带有 `is_transparent` 时 `operator[]` / `contains` 接受任意可与键比较的查找类型
+      *
       *   - `size()`: 返回元素数量（常量和非常量版本）
       *
       *   - `empty()`: 判断哈希表是否为空（`_size == 0`）
@@ -1328,6 +1718,10 @@ namespace base_container
       *   - `capacity()`: 返回当前容量（常量和非常量版本）
       *
       *   - `change_load_factor(const uint64_t& new_load_factor)`: 修改负载因子（新值需 ≥1，返回修改是否成功）
+      *
+      *   - `change_migration_step(const uint64_t& new_migration_step)`: 开启渐进式扩容，每次插入或删除迁移指定数量的旧桶（0 表示关闭）
+      *
+      *   - `migrating()`: 判断是否有尚未完成的渐进式迁移
 
       * 特性:
 
@@ -1337,6 +1731,10 @@ namespace base_container
       *
       * * - 自动扩容: 基于负载因子动态调整容量（翻倍），避免哈希冲突过于频繁
       *
+      * * - 原地重挂: 扩容时节点不重新分配，按缓存的哈希值直接挂到新桶上，插入顺序链表保持不变
+      *
+      * * - 渐进式扩容: 开启后旧桶数组暂时保留，后续每次插入或删除只迁移少量桶，避免单次插入长时间停顿
+      *
       * * - 支持移动语义: 减少插入和赋值时的拷贝开销，提高性能
       *
       * * - 唯一性: 不允许插入重复元素（通过仿函数比较键判断）
@@ -1345,11 +1743,13 @@ namespace base_container
 
       * * - 负载因子: 默认值为7（即负载率70%），可通过 `change_load_factor` 调整，值越小冲突越少但空间开销越大
       *
-      * * - 扩容机制: 扩容时会重新哈希所有元素，可能导致迭代器失效
+      * * - 扩容机制: 扩容只移动节点在桶间的链接，迭代器和元素地址保持有效
       *
       * * - 全局链表: 用于维持插入顺序，迭代器遍历依赖此链表，删除元素时需同步维护链表指针
       *
       * * - 仿函数要求: `container_imitate_function` 需能从值中提取键（如 `std::get<0>` 用于键值对），否则比较逻辑失效
+      *
+      * * - 哈希函数只作用于键（`hash_function(container_imitate_function(value))`），同键元素必然落在同一个桶里
 
       * 详细请参考 https://github.com/Hatedatastructures/Custom-libraries/blob/main/template_container.md
   */
@@ -1361,23 +1761,20 @@ namespace base_container
     {
     public:
       hash_table_type_value _data;
+      uint64_t _hash_value; // 缓存完整哈希值，扩容时不必重新计算，查找时先比较哈希值再比较键
       hash_table_node *_next;
       hash_table_node *overall_list_prev;
       // 全局链表指针，方便按照插入的顺序有序遍历哈希表
       hash_table_node *overall_list_next;
-      explicit hash_table_node(const hash_table_type_value &hash_table_value_data)
+      hash_table_node(const hash_table_type_value &hash_table_value_data, const uint64_t hash_value)
+          : _data(hash_table_value_data), _hash_value(hash_value), _next(nullptr), overall_list_prev(nullptr), overall_list_next(nullptr)
       {
-        _data = hash_table_value_data;
-        _next = nullptr;
-        overall_list_prev = nullptr;
-        overall_list_next = nullptr;
+        ;
       }
-      explicit hash_table_node(hash_table_type_value &&hash_table_value_data)
+      hash_table_node(hash_table_type_value &&hash_table_value_data, const uint64_t hash_value)
+          : _data(std::move(hash_table_value_data)), _hash_value(hash_value), _next(nullptr), overall_list_prev(nullptr), overall_list_next(nullptr)
       {
-        _data = std::move(hash_table_value_data);
-        _next = nullptr;
-        overall_list_prev = nullptr;
-        overall_list_next = nullptr;
+        ;
       }
     };
     using container_node = hash_table_node;
@@ -1397,6 +1794,14 @@ namespace base_container
 
     container_node *overall_list_head_node = nullptr; // 全局头数据
 
+    standard_con::vector<container_node *> migrating_hash_table; // 渐进式扩容时尚未迁移完的旧桶数组
+
+    uint64_t migrating_capacity = 0; // 旧桶数组容量，为 0 表示当前没有进行中的迁移
+
+    uint64_t migration_position = 0; // 旧桶数组中下标小于该值的桶已经迁移完毕
+
+    uint64_t migration_step = 0; // 每次插入或删除时迁移的旧桶数量，为 0 表示扩容时一次性迁移
+
     template <typename iterator_type_key, typename iterator_type_val>
     class hash_iterator
     {
@@ -1407,6 +1812,8 @@ namespace base_container
       iterator_node *hash_table_iterator_node;
 
     public:
+      hash_iterator() : hash_table_iterator_node(nullptr) { ; }
+
       hash_iterator(iterator_node *iterator_ptr_node) { hash_table_iterator_node = iterator_ptr_node; }
 
       Ref operator*() { return hash_table_iterator_node->_data; }
@@ -1428,23 +1835,211 @@ namespace base_container
         hash_table_iterator_node = hash_table_iterator_node->overall_list_next;
         return *this;
       }
+      self operator--()
+      {
+        // 全局链表是双向的，可以回退；不能从 end() 回退
+        hash_table_iterator_node = hash_table_iterator_node->overall_list_prev;
+        return *this;
+      }
+      self operator--(int)
+      {
+        self iterator_data = *this;
+        hash_table_iterator_node = hash_table_iterator_node->overall_list_prev;
+        return iterator_data;
+      }
       iterator_node *get_node()
       {
         return hash_table_iterator_node;
       }
     };
-    void hash_chain_adjustment(container_node *&provisional_parent_node, container_node *&provisional_node, uint64_t &hash_map_location)
+    container_node *&bucket_head(const uint64_t hash_value)
+    {
+      // 迁移过程中，旧桶下标不小于 migration_position 的元素仍留在旧桶数组里
+      if (migrating_capacity != 0)
+      {
+        const uint64_t migrating_location = hash_value % migrating_capacity;
+        if (migrating_location >= migration_position)
+        {
+          return migrating_hash_table[migrating_location];
+        }
+      }
+      return vector_hash_table[hash_value % hash_capacity];
+    }
+    void migrate_buckets(uint64_t bucket_count)
+    {
+      // 把旧桶里的节点原样挂到新桶上，不重新分配节点，也不重新计算哈希值
+      while (migrating_capacity != 0 && bucket_count-- > 0)
+      {
+        container_node *migrating_node = migrating_hash_table[migration_position];
+        migrating_hash_table[migration_position] = nullptr;
+        while (migrating_node != nullptr)
+        {
+          container_node *next_node = migrating_node->_next;
+          container_node *&new_bucket_node = vector_hash_table[migrating_node->_hash_value % hash_capacity];
+          migrating_node->_next = new_bucket_node;
+          new_bucket_node = migrating_node;
+          migrating_node = next_node;
+        }
+        if (++migration_position == migrating_capacity)
+        {
+          standard_con::vector<container_node *> released_hash_table;
+          migrating_hash_table.swap(released_hash_table);
+          migrating_capacity = 0;
+          migration_position = 0;
+        }
+      }
+    }
+    void finish_migration()
+    {
+      if (migrating_capacity != 0)
+      {
+        migrate_buckets(migrating_capacity - migration_position);
+      }
+    }
+    void rehash(const uint64_t new_container_capacity)
+    {
+      finish_migration();
+      standard_con::vector<container_node *> new_vector_hash_table;
+      new_vector_hash_table.resize(new_container_capacity, nullptr);
+      if (migration_step == 0)
+      {
+        // 一次性迁移：原有节点直接重新挂到新桶上，插入顺序链表保持不变
+        for (uint64_t bucket_traversal = 0; bucket_traversal < hash_capacity; ++bucket_traversal)
+        {
+          container_node *hash_bucket_node = vector_hash_table[bucket_traversal];
+          while (hash_bucket_node != nullptr)
+          {
+            container_node *next_node = hash_bucket_node->_next;
+            container_node *&new_bucket_node = new_vector_hash_table[hash_bucket_node->_hash_value % new_container_capacity];
+            hash_bucket_node->_next = new_bucket_node;
+            new_bucket_node = hash_bucket_node;
+            hash_bucket_node = next_node;
+          }
+        }
+        vector_hash_table.swap(new_vector_hash_table);
+      }
+      else
+      {
+        // 渐进式迁移：旧桶数组保留下来，之后每次插入或删除搬运 migration_step 个桶
+        migrating_hash_table.swap(vector_hash_table);
+        vector_hash_table.swap(new_vector_hash_table);
+        migrating_capacity = hash_capacity;
+        migration_position = 0;
+      }
+      hash_capacity = new_container_capacity;
+    }
+    void overall_list_append(container_node *new_mapping_data) noexcept
+    {
+      if (overall_list_head_node == nullptr)
+      {
+        new_mapping_data->overall_list_prev = nullptr;
+        overall_list_head_node = overall_list_before_node = new_mapping_data;
+      }
+      else
+      {
+        new_mapping_data->overall_list_prev = overall_list_before_node;
+        overall_list_before_node->overall_list_next = new_mapping_data;
+        overall_list_before_node = new_mapping_data;
+      }
+    }
+    void overall_list_unlink(container_node *hash_bucket_node) noexcept
+    {
+      if (hash_bucket_node->overall_list_prev != nullptr)
+      {
+        hash_bucket_node->overall_list_prev->overall_list_next = hash_bucket_node->overall_list_next;
+      }
+      else
+      {
+        overall_list_head_node = hash_bucket_node->overall_list_next;
+      }
+      if (hash_bucket_node->overall_list_next != nullptr)
+      {
+        hash_bucket_node->overall_list_next->overall_list_prev = hash_bucket_node->overall_list_prev;
+      }
+      else
+      {
+        overall_list_before_node = hash_bucket_node->overall_list_prev;
+      }
+    }
+    void overall_list_link_after(container_node *hash_bucket_node, container_node *anchor_node) noexcept
     {
-      if (provisional_parent_node != nullptr)
+      // 把已摘下的节点挂到 anchor_node 之后，anchor_node 为空时挂到链表头
+      hash_bucket_node->overall_list_prev = anchor_node;
+      hash_bucket_node->overall_list_next = anchor_node != nullptr ? anchor_node->overall_list_next : overall_list_head_node;
+      if (hash_bucket_node->overall_list_next != nullptr)
       {
-        // 父亲节点不为空，防止空指针错误
-        provisional_parent_node->_next = provisional_node->_next;
+        hash_bucket_node->overall_list_next->overall_list_prev = hash_bucket_node;
       }
       else
       {
-        // 父亲节点为空，直接将映射位置置空
-        vector_hash_table[hash_map_location] = nullptr;
+        overall_list_before_node = hash_bucket_node;
+      }
+      if (anchor_node != nullptr)
+      {
+        anchor_node->overall_list_next = hash_bucket_node;
+      }
+      else
+      {
+        overall_list_head_node = hash_bucket_node;
+      }
+    }
+    template <typename lookup_type>
+    container_node *find_node(const lookup_type &key_value, const uint64_t hash_value)
+    {
+      container_node *hash_bucket_node = bucket_head(hash_value);
+      while (hash_bucket_node != nullptr)
+      {
+        if (hash_bucket_node->_hash_value == hash_value && value_imitation_functions(hash_bucket_node->_data) == key_value)
+        {
+          return hash_bucket_node;
+        }
+        hash_bucket_node = hash_bucket_node->_next;
+      }
+      return nullptr;
+    }
+    template <typename insert_value_type>
+    standard_con::pair<container_node *, bool> insert_node(insert_value_type &&hash_table_value_data)
+    {
+      migrate_buckets(migration_step);
+      // 哈希值只由键计算，同键不同值的元素落在同一个桶里才能判重
+      const uint64_t hash_mapping_value = hash_function_object(value_imitation_functions(hash_table_value_data));
+      if (_size != 0)
+      {
+        container_node *existing_node = find_node(value_imitation_functions(hash_table_value_data), hash_mapping_value);
+        if (existing_node != nullptr)
+        {
+          return standard_con::pair<container_node *, bool>(existing_node, false);
+        }
+      }
+      // 判断扩容
+      if (_size * 10 >= hash_capacity * load_factor && migrating_capacity == 0)
+      {
+        rehash((hash_capacity == 0 && vector_hash_table.empty()) ? 10 : hash_capacity * 2);
+      }
+      auto *new_mapping_data = new container_node(std::forward<insert_value_type>(hash_table_value_data), hash_mapping_value);
+      container_node *&hash_bucket_node = bucket_head(hash_mapping_value);
+      new_mapping_data->_next = hash_bucket_node;
+      hash_bucket_node = new_mapping_data;
+      overall_list_append(new_mapping_data);
+      _size++;
+      return standard_con::pair<container_node *, bool>(new_mapping_data, true);
+    }
+    template <typename insert_value_type>
+    bool insert_value(insert_value_type &&hash_table_value_data)
+    {
+      return insert_node(std::forward<insert_value_type>(hash_table_value_data)).second;
+    }
+    void release_nodes() noexcept
+    {
+      container_node *release_node = overall_list_head_node;
+      while (release_node != nullptr)
+      {
+        container_node *next_node = release_node->overall_list_next;
+        delete release_node;
+        release_node = next_node;
       }
+      overall_list_head_node = overall_list_before_node = nullptr;
+      _size = 0;
     }
 
   public:
@@ -1455,7 +2050,7 @@ namespace base_container
       _size = 0;
       load_factor = 7;
       hash_capacity = 10;
-      vector_hash_table.resize(hash_capacity);
+      vector_hash_table.resize(hash_capacity, nullptr);
     }
 
     explicit hash_table(const uint64_t new_hash_table_capacity)
@@ -1463,89 +2058,85 @@ namespace base_container
       _size = 0;
       load_factor = 7;
       hash_capacity = new_hash_table_capacity;
-      vector_hash_table.resize(hash_capacity);
+      vector_hash_table.resize(hash_capacity, nullptr);
     }
     hash_table(const hash_table &hash_table_data)
-        : value_imitation_functions(hash_table_data.value_imitation_functions), _size(hash_table_data._size), load_factor(hash_table_data.load_factor),
-          hash_capacity(hash_table_data.hash_capacity), overall_list_before_node(nullptr),
-          overall_list_head_node(nullptr)
+        : value_imitation_functions(hash_table_data.value_imitation_functions), _size(0), load_factor(hash_table_data.load_factor),
+          hash_capacity(hash_table_data.hash_capacity), hash_function_object(hash_table_data.hash_function_object),
+          overall_list_before_node(nullptr), overall_list_head_node(nullptr), migration_step(hash_table_data.migration_step)
     {
-      if (hash_capacity == 0)
-      {
-        return;
-      }
       // 1. 分配同样大小的桶数组，所有桶初始为空
       vector_hash_table.resize(hash_capacity, nullptr);
-
-      // 2. 遍历原表的每一个桶
-      for (uint64_t new_hash_container_capacity = 0; new_hash_container_capacity < hash_capacity; ++new_hash_container_capacity)
+      // 2. 按插入顺序逐节点深拷贝，复用缓存的哈希值，源表是否处于迁移中不影响结果
+      try
       {
-        container_node *src_bucket_node = hash_table_data.vector_hash_table[new_hash_container_capacity];
-        // 桶内新表的尾节点（用于串联 _next）
-        container_node *last_in_bucket = nullptr;
-
-        // 逐节点深拷贝
-        while (src_bucket_node)
+        for (container_node *src_node = hash_table_data.overall_list_head_node; src_node != nullptr; src_node = src_node->overall_list_next)
         {
-          // 2.1 创建新节点并拷贝数据
-          auto *new_structure_node = new container_node(src_bucket_node->_data);
-          // 2.2 插入到“桶内部”链表
-          if (last_in_bucket != nullptr)
-          {
-            last_in_bucket->_next = new_structure_node;
-          }
-          else
-          {
-            vector_hash_table[new_hash_container_capacity] = new_structure_node;
-          }
-          last_in_bucket = new_structure_node;
-
-          // 2.3 插入到全局插入
-          if (overall_list_before_node != nullptr)
-          {
-            overall_list_before_node->overall_list_next = new_structure_node;
-            new_structure_node->overall_list_prev = overall_list_before_node;
-          }
-          else
-          {
-            // 第一个节点就是全局链表的头
-            overall_list_head_node = new_structure_node;
-          }
-          overall_list_before_node = new_structure_node;
-
-          // 继续下一个源节点
-          src_bucket_node = src_bucket_node->_next;
+          auto *new_structure_node = new container_node(src_node->_data, src_node->_hash_value);
+          container_node *&hash_bucket_node = vector_hash_table[src_node->_hash_value % hash_capacity];
+          new_structure_node->_next = hash_bucket_node;
+          hash_bucket_node = new_structure_node;
+          overall_list_append(new_structure_node);
+          ++_size;
         }
       }
-      if (overall_list_before_node != nullptr)
+      catch (...)
       {
-        overall_list_before_node->overall_list_next = nullptr;
+        // 构造函数没有完成，析构函数不会运行，已经拷贝好的节点要在这里释放
+        release_nodes();
+        throw;
       }
     }
     hash_table(hash_table &&hash_table_data) noexcept
-    {
-      vector_hash_table = std::move(hash_table_data.vector_hash_table);
-      _size = hash_table_data._size;
-      load_factor = hash_table_data.load_factor;
-      hash_capacity = hash_table_data.hash_capacity;
-      hash_function_object = std::move(hash_table_data.hash_function_object);
-      overall_list_before_node = std::move(hash_table_data.overall_list_before_node);
-      overall_list_head_node = std::move(hash_table_data.overall_list_head_node);
-      value_imitation_functions = std::move(hash_table_data.value_imitation_functions);
+        : value_imitation_functions(std::move(hash_table_data.value_imitation_functions)), _size(hash_table_data._size),
+          load_factor(hash_table_data.load_factor), hash_capacity(hash_table_data.hash_capacity),
+          vector_hash_table(std::move(hash_table_data.vector_hash_table)), hash_function_object(std::move(hash_table_data.hash_function_object)),
+          overall_list_before_node(hash_table_data.overall_list_before_node), overall_list_head_node(hash_table_data.overall_list_head_node),
+          migrating_hash_table(std::move(hash_table_data.migrating_hash_table)), migrating_capacity(hash_table_data.migrating_capacity),
+          migration_position(hash_table_data.migration_position), migration_step(hash_table_data.migration_step)
+    {
+      // 原表交出全部节点，之后只能析构或重新赋值
+      hash_table_data.overall_list_head_node = hash_table_data.overall_list_before_node = nullptr;
+      hash_table_data._size = hash_table_data.hash_capacity = 0;
+      hash_table_data.migrating_capacity = hash_table_data.migration_position = 0;
     }
     ~hash_table() noexcept
     {
-      for (uint64_t i = 0; i < vector_hash_table.size(); ++i)
+      // 所有节点都在插入顺序链表上，沿链表释放即可覆盖新旧两个桶数组
+      release_nodes();
+    }
+    void swap(hash_table &hash_table_data) noexcept
+    {
+      standard_con::algorithm::swap(value_imitation_functions, hash_table_data.value_imitation_functions);
+      standard_con::algorithm::swap(_size, hash_table_data._size);
+      standard_con::algorithm::swap(load_factor, hash_table_data.load_factor);
+      standard_con::algorithm::swap(hash_capacity, hash_table_data.hash_capacity);
+      vector_hash_table.swap(hash_table_data.vector_hash_table);
+      standard_con::algorithm::swap(hash_function_object, hash_table_data.hash_function_object);
+      standard_con::algorithm::swap(overall_list_before_node, hash_table_data.overall_list_before_node);
+      standard_con::algorithm::swap(overall_list_head_node, hash_table_data.overall_list_head_node);
+      migrating_hash_table.swap(hash_table_data.migrating_hash_table);
+      standard_con::algorithm::swap(migrating_capacity, hash_table_data.migrating_capacity);
+      standard_con::algorithm::swap(migration_position, hash_table_data.migration_position);
+      standard_con::algorithm::swap(migration_step, hash_table_data.migration_step);
+    }
+    hash_table &operator=(const hash_table &hash_table_data)
+    {
+      if (this != &hash_table_data)
       {
-        container_node *hash_bucket_delete = vector_hash_table[i];
-        while (hash_bucket_delete != nullptr)
-        {
-          container_node *hash_bucket_prev_node = hash_bucket_delete;
-          hash_bucket_delete = hash_bucket_delete->_next;
-          delete hash_bucket_prev_node;
-          hash_bucket_prev_node = nullptr;
-        }
+        hash_table copy_object(hash_table_data);
+        swap(copy_object);
+      }
+      return *this;
+    }
+    hash_table &operator=(hash_table &&hash_table_data) noexcept
+    {
+      if (this != &hash_table_data)
+      {
+        hash_table move_object(std::move(hash_table_data));
+        swap(move_object);
       }
+      return *this;
     }
     bool change_load_factor(const uint64_t &new_load_factor) // 作用：改变负载因子大小
     {
@@ -1556,28 +2147,48 @@ namespace base_container
       load_factor = new_load_factor;
       return true;
     }
+    void change_migration_step(const uint64_t &new_migration_step) // 作用：设置渐进式扩容每次迁移的桶数，0 表示关闭
+    {
+      migration_step = new_migration_step;
+      if (migration_step == 0)
+      {
+        finish_migration();
+      }
+    }
+    [[nodiscard]] bool migrating() const
+    {
+      return migrating_capacity != 0;
+    }
     iterator operator[](const hash_table_type_key &key_value)
     {
       if (_size == 0)
       {
         return iterator(nullptr);
       }
-      else
+      return iterator(find_node(key_value, hash_function_object(key_value)));
+    }
+    /*
+     * 异构查找：哈希函数带有 `is_transparent` 时，按键查询接受任意与键哈希一致、可用 `==` 比较的类型，不构造临时键
+     */
+    template <typename lookup_type>
+      requires standard_con::transparent_function<hash_function>
+    iterator operator[](const lookup_type &key_value)
+    {
+      if (_size == 0)
       {
-        uint64_t hash_value = value_imitation_functions(key_value);
-        uint64_t hash_map_location = hash_value % hash_capacity;
-        // 找到映射位置
-        container_node *bucket_node = vector_hash_table[hash_map_location];
-        while (bucket_node != nullptr)
-        {
-          if (value_imitation_functions(bucket_node->_data) == value_imitation_functions(key_value))
-          {
-            return iterator(bucket_node);
-          }
-          bucket_node = bucket_node->_next;
-        }
         return iterator(nullptr);
       }
+      return iterator(find_node(key_value, hash_function_object(key_value)));
+    }
+    [[nodiscard]] bool contains(const hash_table_type_key &key_value)
+    {
+      return operator[](key_value) != end();
+    }
+    template <typename lookup_type>
+      requires standard_con::transparent_function<hash_function>
+    [[nodiscard]] bool contains(const lookup_type &key_value)
+    {
+      return operator[](key_value) != end();
     }
     iterator begin() { return iterator(overall_list_head_node); }
 
@@ -1614,393 +2225,1165 @@ namespace base_container
 
     bool push(const hash_table_type_value &hash_table_value_data)
     {
-      if (find(hash_table_value_data).get_node() != nullptr)
+      return insert_value(hash_table_value_data);
+    }
+    bool push(hash_table_type_value &&hash_table_value_data)
+    {
+      return insert_value(std::move(hash_table_value_data));
+    }
+    bool pop(const hash_table_type_value &hash_table_value_data)
+    {
+      // 空表判断
+      if (_size == 0)
       {
         return false;
       }
-      // 判断扩容
-      if (_size * 10 >= hash_capacity * load_factor)
-      {
-        // 扩容
-        uint64_t new_container_capacity = (hash_capacity == 0 && vector_hash_table.empty()) ? 10 : hash_capacity * 2;
-        // 新容量
-        standard_con::vector<container_node *> new_vector_hash_table;
-        new_vector_hash_table.resize(new_container_capacity, nullptr);
-        uint64_t new_size = 0;
-        // 重新映射,按照插入链表顺序
-        container_node *regional_list_head_node = nullptr;            // 临时新哈希表全局头指针
-        container_node *regional_list_previous_node = nullptr;        // 临时新哈希表全局上一个插入数据指针
-        container_node *start_position_node = overall_list_head_node; // 全局链表头指针赋值
-        while (start_position_node != nullptr)
-        {
-          uint64_t new_mapping_value = hash_function_object(start_position_node->_data) % new_container_capacity;
-          // 重新计算映射值
-          container_node *hash_bucket_node = new_vector_hash_table[new_mapping_value];
-          if (hash_bucket_node == nullptr)
-          {
-            auto *new_mapping_data = new container_node(start_position_node->_data);
-            if (regional_list_head_node == nullptr)
-            {
-              new_mapping_data->overall_list_prev = nullptr;
-              new_mapping_data->overall_list_next = nullptr;
-              regional_list_head_node = regional_list_previous_node = new_mapping_data;
-            }
-            else
-            {
-              new_mapping_data->overall_list_prev = regional_list_previous_node;
-              regional_list_previous_node->overall_list_next = new_mapping_data;
-              regional_list_previous_node = new_mapping_data;
-            }
-            new_vector_hash_table[new_mapping_value] = new_mapping_data;
-            // 保存之前的遍历链表信息
-          }
-          else
-          {
-            auto *new_mapping_data = new container_node(start_position_node->_data);
-            if (regional_list_head_node == nullptr)
-            {
-              new_mapping_data->overall_list_prev = nullptr;
-              regional_list_head_node = regional_list_previous_node = new_mapping_data;
-            }
-            else
-            {
-              new_mapping_data->overall_list_prev = regional_list_previous_node;
-              regional_list_previous_node->overall_list_next = new_mapping_data;
-              regional_list_previous_node = new_mapping_data;
-            }
-            new_mapping_data->_next = hash_bucket_node;
-            new_vector_hash_table[new_mapping_value] = new_mapping_data;
-            // 头插节点
-          }
-          ++new_size;
-          start_position_node = start_position_node->overall_list_next;
-        }
-        // 释放旧哈希表
-        for (uint64_t delete_traversal = 0; delete_traversal < vector_hash_table.size(); ++delete_traversal)
+      migrate_buckets(migration_step);
+      const uint64_t hash_mapping_value = hash_function_object(value_imitation_functions(hash_table_value_data));
+      container_node **hash_bucket_link = &bucket_head(hash_mapping_value); // 指向上一个节点的 _next（或桶头），方便摘除节点
+      while (*hash_bucket_link != nullptr)
+      {
+        container_node *hash_bucket_node = *hash_bucket_link;
+        // 找到位置
+        if (hash_bucket_node->_hash_value == hash_mapping_value &&
+            value_imitation_functions(hash_bucket_node->_data) == value_imitation_functions(hash_table_value_data))
         {
-          container_node *hash_bucket_delete = vector_hash_table[delete_traversal];
-          while (hash_bucket_delete != nullptr)
-          {
-            container_node *hash_bucket_prev_node = hash_bucket_delete;
-            hash_bucket_delete = hash_bucket_delete->_next;
-            delete hash_bucket_prev_node;
-            hash_bucket_prev_node = nullptr;
-          }
+          *hash_bucket_link = hash_bucket_node->_next;
+          overall_list_unlink(hash_bucket_node);
+          delete hash_bucket_node;
+          --_size;
+          return true;
         }
-        _size = new_size;
-        vector_hash_table.swap(new_vector_hash_table);
-        hash_capacity = new_container_capacity;
-        overall_list_head_node = regional_list_head_node;
-        overall_list_before_node = regional_list_previous_node;
-        // 重新映射,按照插入链表顺序
+        hash_bucket_link = &hash_bucket_node->_next;
+        // 向下遍历
       }
-      uint64_t hash_mapping_value = hash_function_object(hash_table_value_data);
-      uint64_t hash_map_location = hash_mapping_value % hash_capacity;
-      // 找到映射位置
-      container_node *hash_bucket_node = vector_hash_table[hash_map_location];
-
-      auto *new_mapping_data = new container_node(hash_table_value_data);
-      new_mapping_data->_next = hash_bucket_node;
-      vector_hash_table[hash_map_location] = new_mapping_data;
-      if (_size == 0 && overall_list_head_node == nullptr)
-      {
-        new_mapping_data->overall_list_prev = nullptr;
-        overall_list_head_node = overall_list_before_node = new_mapping_data;
+      return false;
+    }
+    iterator find(const hash_table_type_value &hash_table_value_data)
+    {
+      if (_size == 0)
+      {
+        return iterator(nullptr);
       }
-      else
+      return operator[](value_imitation_functions(hash_table_value_data));
+    }
+    standard_con::pair<iterator, bool> insert(const hash_table_type_value &hash_table_value_data)
+    {
+      standard_con::pair<container_node *, bool> insert_result = insert_node(hash_table_value_data);
+      return standard_con::pair<iterator, bool>(iterator(insert_result.first), insert_result.second);
+    }
+    standard_con::pair<iterator, bool> insert(hash_table_type_value &&hash_table_value_data)
+    {
+      standard_con::pair<container_node *, bool> insert_result = insert_node(std::move(hash_table_value_data));
+      return standard_con::pair<iterator, bool>(iterator(insert_result.first), insert_result.second);
+    }
+    void clear() noexcept
+    {
+      // 保留当前桶数组的容量，只清空桶头；未迁移完的旧桶数组直接丢弃
+      release_nodes();
+      for (uint64_t bucket_position = 0; bucket_position < hash_capacity; ++bucket_position)
       {
-        new_mapping_data->overall_list_prev = overall_list_before_node;
-        overall_list_before_node->overall_list_next = new_mapping_data;
-        overall_list_before_node = new_mapping_data;
+        vector_hash_table[bucket_position] = nullptr;
       }
-      _size++;
-      return true;
+      standard_con::vector<container_node *> released_hash_table;
+      migrating_hash_table.swap(released_hash_table);
+      migrating_capacity = 0;
+      migration_position = 0;
     }
-    bool push(hash_table_type_value &&hash_table_value_data) noexcept
+    iterator erase(iterator erase_position)
+    {
+      // 按节点删除，节点里缓存了哈希值，不必再从值里取键计算；返回全局链表中的下一个元素
+      container_node *erase_node = erase_position.get_node();
+      container_node *next_node = erase_node->overall_list_next;
+      migrate_buckets(migration_step);
+      container_node **hash_bucket_link = &bucket_head(erase_node->_hash_value);
+      while (*hash_bucket_link != erase_node)
+      {
+        hash_bucket_link = &(*hash_bucket_link)->_next;
+      }
+      *hash_bucket_link = erase_node->_next;
+      overall_list_unlink(erase_node);
+      delete erase_node;
+      --_size;
+      return iterator(next_node);
+    }
+    /*
+     * 调整全局链表中的顺序，只改链表指针，O(1)；不影响哈希桶，迭代器和元素地址保持有效
+     */
+    void move_to_back(iterator move_position) noexcept
     {
-      if (find(hash_table_value_data).get_node() != nullptr)
+      container_node *move_node = move_position.get_node();
+      if (move_node != overall_list_before_node)
       {
-        return false;
+        overall_list_unlink(move_node);
+        overall_list_link_after(move_node, overall_list_before_node);
       }
-      // 判断扩容
-      if (_size * 10 >= hash_capacity * load_factor)
-      {
-        // 扩容
-        uint64_t new_container_capacity = (hash_capacity == 0 && vector_hash_table.empty()) ? 10 : hash_capacity * 2;
-        // 新容量
-        standard_con::vector<container_node *> new_vector_hash_table;
-        new_vector_hash_table.resize(new_container_capacity, nullptr);
-        uint64_t new_size = 0;
-        // 重新映射,按照插入链表顺序
-        container_node *regional_list_head_node = nullptr;            // 临时新哈希表全局头指针
-        container_node *regional_list_previous_node = nullptr;        // 临时新哈希表全局上一个插入数据指针
-        container_node *start_position_node = overall_list_head_node; // 全局链表头指针赋值
-        while (start_position_node != nullptr)
-        {
-          uint64_t new_mapping_value = hash_function_object(start_position_node->_data) % new_container_capacity;
-          // 重新计算映射值
-          container_node *hash_bucket_node = new_vector_hash_table[new_mapping_value];
-          if (hash_bucket_node == nullptr)
-          {
-            auto *new_mapping_data = new container_node(std::forward<hash_table_type_value>(start_position_node->_data));
-            if (regional_list_head_node == nullptr)
-            {
-              new_mapping_data->overall_list_prev = nullptr;
-              new_mapping_data->overall_list_next = nullptr;
-              regional_list_head_node = regional_list_previous_node = new_mapping_data;
-            }
-            else
-            {
-              new_mapping_data->overall_list_prev = regional_list_previous_node;
-              regional_list_previous_node->overall_list_next = new_mapping_data;
-              regional_list_previous_node = new_mapping_data;
-            }
-            new_vector_hash_table[new_mapping_value] = new_mapping_data;
-            // 保存之前的遍历链表信息
-          }
-          else
+    }
+    void move_to_front(iterator move_position) noexcept
+    {
+      container_node *move_node = move_position.get_node();
+      if (move_node != overall_list_head_node)
+      {
+        overall_list_unlink(move_node);
+        overall_list_link_after(move_node, nullptr);
+      }
+    }
+    void move_after(iterator move_position, iterator anchor_position) noexcept
+    {
+      // anchor_position 为 end() 时移到链表头
+      container_node *move_node = move_position.get_node();
+      container_node *anchor_node = anchor_position.get_node();
+      if (move_node == anchor_node || move_node->overall_list_prev == anchor_node)
+      {
+        return;
+      }
+      overall_list_unlink(move_node);
+      overall_list_link_after(move_node, anchor_node);
+    }
+  };
+  /*
+      * @brief  #### `flat_hash_table` 类模板
+
+      *   - 自定义开放寻址哈希表容器，采用控制字节（Swiss table）布局解决哈希冲突
+
+      *   - 元素连续存放在一块槽位数组中，每个槽位对应一个控制字节，查找时按 16 个控制字节为一组并行探测
+
+      *   - 与 `hash_table` 并列提供，适用于查找密集、对缓存命中率敏感的场景
+
+      * 模板参数:
+
+      * * - `flat_hash_table_type_key`: 键的类型，用于哈希映射和比较的依据
+      *
+      * * - `flat_hash_table_type_value`: 哈希表中存储的元素类型（通常为键值对）
+      *
+      * * - `container_imitate_function`: 仿函数类型，用于从值中提取键
+      *
+      * * - `hash_function`: 哈希函数类型，默认为 `standard_con::hash_imitation_functions`
+      *   作用于提取出的键，结果再经过一次混合，高 57 位决定探测起点，低 7 位存入控制字节
+
+      * 控制字节:
+
+      * * - `control_empty`（-128）: 空槽位，探测遇到空槽位所在的组即可停止
+      *
+      * * - `control_deleted`（-2）: 删除标记，探测时跳过，插入时可复用
+      *
+      * * - `0 ~ 127`: 已占用槽位，保存哈希值的低 7 位，用于在比较键之前快速过滤
+
+      * 迭代器相关方法:
+
+      * * - `begin()`/`cbegin()`: 返回指向第一个已占用槽位的迭代器（按槽位顺序遍历，不保证插入顺序）
+      *
+      * * - `end()`/`cend()`: 返回槽位数组末尾的迭代器
+
+      * 主要操作方法:
+
+      * * - `push()`: 插入元素（支持拷贝和移动语义），键已存在时返回 `false`
+      *
+      * * - `pop(const flat_hash_table_type_value&)`: 删除指定元素，槽位标记为 `control_deleted`
+      *
+      * * - `find(const flat_hash_table_type_value&)`: 查找指定元素，返回迭代器（找到）或 `end()`（未找到）
+      *
+      * * - `operator[](const flat_hash_table_type_key&)`: 通过键查找元素
+      *
+      * * - `reserve(uint64_t)`: 预留可容纳指定数量元素的空间，避免插入过程中扩容
+      *
+      * * - `clear()`: 析构所有元素，保留槽位数组
+
+      * 特性:
+
+      * * - 连续存储: 元素与控制字节各占一块连续内存，没有逐元素的节点分配
+      *
+      * * - 组探测: 支持 `SSE2` 时一次比较 16 个控制字节，否则退化为逐字节比较
+      *
+      * * - 自动扩容: 容量为 2 的幂，最大负载率 7/8，删除标记过多时原地重建
+
+      * 注意事项:
+
+      * * - 扩容和重建会移动元素，所有迭代器和元素地址失效
+      *
+      * * - 元素类型需支持移动构造
+  */
+  template <typename flat_hash_table_type_key, typename flat_hash_table_type_value, typename container_imitate_function,
+            typename hash_function = standard_con::hash_imitation_functions>
+  class flat_hash_table
+  {
+    using control_byte = int8_t;
+    using slot_allocator = std::allocator<flat_hash_table_type_value>;
+    static constexpr control_byte control_empty = -128;
+    static constexpr control_byte control_deleted = -2;
+    static constexpr uint64_t group_width = 16;
+    static constexpr uint64_t minimum_capacity = 16;
+    class control_group
+    {
+#if defined(__SSE2__)
+      __m128i group_bytes;
+
+    public:
+      explicit control_group(const control_byte *group_position) noexcept
+          : group_bytes(_mm_loadu_si128(reinterpret_cast<const __m128i *>(group_position)))
+      {
+        ;
+      }
+      [[nodiscard]] uint32_t match(const control_byte hash_fragment) const noexcept
+      {
+        return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(hash_fragment), group_bytes)));
+      }
+      [[nodiscard]] uint32_t match_empty() const noexcept
+      {
+        return match(control_empty);
+      }
+      [[nodiscard]] uint32_t match_empty_or_deleted() const noexcept
+      {
+        // 空槽位和删除标记都小于 -1，已占用槽位均为非负数
+        return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(-1), group_bytes)));
+      }
+#else
+      const control_byte *group_position;
+
+    public:
+      explicit control_group(const control_byte *group_position_data) noexcept
+          : group_position(group_position_data)
+      {
+        ;
+      }
+      [[nodiscard]] uint32_t match(const control_byte hash_fragment) const noexcept
+      {
+        uint32_t match_mask = 0;
+        for (uint64_t group_traversal = 0; group_traversal < group_width; ++group_traversal)
+        {
+          if (group_position[group_traversal] == hash_fragment)
           {
-            auto *new_mapping_data = new container_node(std::forward<hash_table_type_value>(start_position_node->_data));
-            if (regional_list_head_node == nullptr)
-            {
-              new_mapping_data->overall_list_prev = nullptr;
-              regional_list_head_node = regional_list_previous_node = new_mapping_data;
-            }
-            else
-            {
-              new_mapping_data->overall_list_prev = regional_list_previous_node;
-              regional_list_previous_node->overall_list_next = new_mapping_data;
-              regional_list_previous_node = new_mapping_data;
-            }
-            new_mapping_data->_next = hash_bucket_node;
-            new_vector_hash_table[new_mapping_value] = new_mapping_data;
-            // 头插节点
+            match_mask |= (1u << group_traversal);
           }
-          ++new_size;
-          start_position_node = start_position_node->overall_list_next;
         }
-        // 释放旧哈希表
-        for (uint64_t delete_traversal = 0; delete_traversal < vector_hash_table.size(); ++delete_traversal)
+        return match_mask;
+      }
+      [[nodiscard]] uint32_t match_empty() const noexcept
+      {
+        return match(control_empty);
+      }
+      [[nodiscard]] uint32_t match_empty_or_deleted() const noexcept
+      {
+        uint32_t match_mask = 0;
+        for (uint64_t group_traversal = 0; group_traversal < group_width; ++group_traversal)
         {
-          container_node *hash_bucket_delete = vector_hash_table[delete_traversal];
-          while (hash_bucket_delete != nullptr)
+          if (group_position[group_traversal] < -1)
           {
-            container_node *hash_bucket_prev_node = hash_bucket_delete;
-            hash_bucket_delete = hash_bucket_delete->_next;
-            delete hash_bucket_prev_node;
-            hash_bucket_prev_node = nullptr;
+            match_mask |= (1u << group_traversal);
           }
         }
-        _size = new_size;
-        vector_hash_table.swap(new_vector_hash_table);
-        hash_capacity = new_container_capacity;
-        overall_list_head_node = regional_list_head_node;
-        overall_list_before_node = regional_list_previous_node;
-        // 重新映射,按照插入链表顺序
+        return match_mask;
+      }
+#endif
+    };
+    template <typename iterator_type_val>
+    class flat_hash_iterator
+    {
+      using Ref = iterator_type_val &;
+      using Ptr = iterator_type_val *;
+      using self = flat_hash_iterator<iterator_type_val>;
+      const control_byte *control_position;
+      flat_hash_table_type_value *slot_position;
+      flat_hash_table_type_value *slot_terminal;
+      void skip_vacant_slots() noexcept
+      {
+        while (slot_position != slot_terminal && *control_position < 0)
+        {
+          ++control_position;
+          ++slot_position;
+        }
       }
-      uint64_t hash_mapping_value = hash_function_object(hash_table_value_data);
-      uint64_t hash_map_location = hash_mapping_value % hash_capacity;
-      // 找到映射位置
-      container_node *hash_bucket_node = vector_hash_table[hash_map_location];
 
-      auto *new_mapping_data = new container_node(std::forward<hash_table_type_value>(hash_table_value_data));
-      new_mapping_data->_next = hash_bucket_node;
-      vector_hash_table[hash_map_location] = new_mapping_data;
-      if (_size == 0 && overall_list_head_node == nullptr)
+    public:
+      flat_hash_iterator(const control_byte *control_data, flat_hash_table_type_value *slot_data, flat_hash_table_type_value *slot_terminal_data) noexcept
+          : control_position(control_data), slot_position(slot_data), slot_terminal(slot_terminal_data)
       {
-        new_mapping_data->overall_list_prev = nullptr;
-        overall_list_head_node = overall_list_before_node = new_mapping_data;
+        skip_vacant_slots();
       }
-      else
+
+      Ref operator*() { return *slot_position; }
+
+      Ptr operator->() { return slot_position; }
+
+      bool operator!=(const self &iterator_data) const { return slot_position != iterator_data.slot_position; }
+
+      bool operator==(const self &iterator_data) const { return slot_position == iterator_data.slot_position; }
+
+      self operator++(int)
       {
-        new_mapping_data->overall_list_prev = overall_list_before_node;
-        overall_list_before_node->overall_list_next = new_mapping_data;
-        overall_list_before_node = new_mapping_data;
+        self iterator_data = *this;
+        ++(*this);
+        return iterator_data;
       }
-      _size++;
-      return true;
+      self &operator++()
+      {
+        ++control_position;
+        ++slot_position;
+        skip_vacant_slots();
+        return *this;
+      }
+    };
+    container_imitate_function value_imitation_functions; // 仿函数
+
+    hash_function hash_function_object; // 哈希函数
+
+    slot_allocator slot_allocator_object; // 槽位分配器
+
+    control_byte *control_array = nullptr; // 控制字节数组，末尾额外复制前 group_width - 1 个字节，方便越界读取一整组
+
+    flat_hash_table_type_value *slot_array = nullptr; // 槽位数组
+
+    uint64_t _size = 0; // 元素个数
+
+    uint64_t hash_capacity = 0; // 槽位数量，始终为 0 或 2 的幂
+
+    uint64_t growth_left = 0; // 扩容前还能占用的空槽位数量
+
+    static constexpr uint64_t capacity_to_growth(const uint64_t slot_capacity) noexcept
+    {
+      return slot_capacity - slot_capacity / 8;
     }
-    bool pop(const hash_table_type_value &hash_table_value_data)
+    static constexpr uint64_t hash_mixing(uint64_t hash_value) noexcept
+    {
+      // 对外部哈希值再做一次混合，保证整数等恒等哈希的低 7 位和高位都足够分散
+      hash_value ^= hash_value >> 33;
+      hash_value *= 0xff51afd7ed558ccdULL;
+      hash_value ^= hash_value >> 33;
+      hash_value *= 0xc4ceb9fe1a85ec53ULL;
+      hash_value ^= hash_value >> 33;
+      return hash_value;
+    }
+    static constexpr control_byte hash_fragment(const uint64_t hash_value) noexcept
     {
-      // 空表判断
-      if (find(hash_table_value_data).get_node() == nullptr)
+      return static_cast<control_byte>(hash_value & 0x7F);
+    }
+    template <typename key_type>
+    uint64_t key_hash(const key_type &key_value)
+    {
+      return hash_mixing(hash_function_object(key_value));
+    }
+    void set_control(const uint64_t slot_location, const control_byte control_value) noexcept
+    {
+      control_array[slot_location] = control_value;
+      if (slot_location < group_width - 1)
       {
-        return false;
+        control_array[hash_capacity + slot_location] = control_value;
       }
-      uint64_t hash_mapping_value = hash_function_object(hash_table_value_data);
-      uint64_t hash_map_location = hash_mapping_value % hash_capacity;
-      // 找到映射位置
-      container_node *hash_bucket_node = vector_hash_table[hash_map_location]; // 桶头节点赋值
-      container_node *hash_bucket_parent_node = nullptr;                       // 保存上一个节点方便修改next指针的指向
-      while (hash_bucket_node != nullptr)
+    }
+    template <typename key_type>
+    uint64_t locate(const key_type &key_value, const uint64_t hash_value)
+    {
+      // 返回键所在的槽位，未找到返回 hash_capacity
+      if (hash_capacity == 0)
       {
-        // 找到位置
-        if (value_imitation_functions(hash_bucket_node->_data) == value_imitation_functions(hash_table_value_data))
+        return hash_capacity;
+      }
+      const uint64_t capacity_mask = hash_capacity - 1;
+      uint64_t probe_offset = (hash_value >> 7) & capacity_mask;
+      uint64_t probe_index = 0;
+      while (true)
+      {
+        control_group group(control_array + probe_offset);
+        for (uint32_t match_mask = group.match(hash_fragment(hash_value)); match_mask != 0; match_mask &= match_mask - 1)
         {
-          if (overall_list_head_node == hash_bucket_node)
-          {
-            // 头节点删除情况
-            if (hash_bucket_node == overall_list_before_node)
-            {
-              // 只有一个节点
-              overall_list_head_node = overall_list_before_node = nullptr;
-              hash_chain_adjustment(hash_bucket_parent_node, hash_bucket_node, hash_map_location);
-            } // hash_chain_adjustment函数作用：检查hash_bucket_node节点是否哈希桶头结点，是则置空
-            else // 不是则将hash_bucket_node的_next节点赋值给hash_bucket_parent_node的_next指针，因为删除的是hash_bucket_node节点
-            {
-              // 是头节点，不是尾节点
-              hash_chain_adjustment(hash_bucket_parent_node, hash_bucket_node, hash_map_location);
-              overall_list_head_node = overall_list_head_node->overall_list_next;
-              overall_list_head_node->overall_list_prev = nullptr;
-            }
-          }
-          else if (hash_bucket_node == overall_list_before_node)
+          const uint64_t slot_location = (probe_offset + static_cast<uint64_t>(std::countr_zero(match_mask))) & capacity_mask;
+          if (value_imitation_functions(slot_array[slot_location]) == key_value)
           {
-            // 尾节点删除情况
-            hash_chain_adjustment(hash_bucket_parent_node, hash_bucket_node, hash_map_location);
-            overall_list_before_node = overall_list_before_node->overall_list_prev;
-            overall_list_before_node->overall_list_next = nullptr;
+            return slot_location;
           }
-          else
+        }
+        if (group.match_empty() != 0)
+        {
+          return hash_capacity;
+        }
+        // 三角数步长探测，容量为 2 的幂时可以覆盖所有组
+        probe_index += group_width;
+        probe_offset = (probe_offset + probe_index) & capacity_mask;
+      }
+    }
+    uint64_t find_insert_slot(const uint64_t hash_value) const noexcept
+    {
+      const uint64_t capacity_mask = hash_capacity - 1;
+      uint64_t probe_offset = (hash_value >> 7) & capacity_mask;
+      uint64_t probe_index = 0;
+      while (true)
+      {
+        control_group group(control_array + probe_offset);
+        const uint32_t match_mask = group.match_empty_or_deleted();
+        if (match_mask != 0)
+        {
+          return (probe_offset + static_cast<uint64_t>(std::countr_zero(match_mask))) & capacity_mask;
+        }
+        probe_index += group_width;
+        probe_offset = (probe_offset + probe_index) & capacity_mask;
+      }
+    }
+    void release_storage() noexcept
+    {
+      if (slot_array != nullptr)
+      {
+        for (uint64_t slot_traversal = 0; slot_traversal < hash_capacity; ++slot_traversal)
+        {
+          if (control_array[slot_traversal] >= 0)
           {
-            // 中间节点删除情况
-            hash_chain_adjustment(hash_bucket_parent_node, hash_bucket_node, hash_map_location);
-            hash_bucket_node->overall_list_prev->overall_list_next = hash_bucket_node->overall_list_next;
-            hash_bucket_node->overall_list_next->overall_list_prev = hash_bucket_node->overall_list_prev;
+            slot_array[slot_traversal].~flat_hash_table_type_value();
           }
-          delete hash_bucket_node;
-          hash_bucket_node = nullptr;
-          --_size;
-          return true;
         }
-        hash_bucket_parent_node = hash_bucket_node;
-        hash_bucket_node = hash_bucket_node->_next;
-        // 向下遍历
+        slot_allocator_object.deallocate(slot_array, hash_capacity);
       }
-      return false;
+      delete[] control_array;
+      control_array = nullptr;
+      slot_array = nullptr;
+      hash_capacity = 0;
+      growth_left = 0;
+      _size = 0;
     }
-    iterator find(const hash_table_type_value &hash_table_value_data)
+    void allocate_storage(const uint64_t new_slot_capacity)
     {
-      if (_size == 0)
+      control_array = new control_byte[new_slot_capacity + group_width];
+      std::memset(control_array, static_cast<unsigned char>(control_empty), new_slot_capacity + group_width);
+      slot_array = slot_allocator_object.allocate(new_slot_capacity);
+      hash_capacity = new_slot_capacity;
+      growth_left = capacity_to_growth(new_slot_capacity);
+    }
+    void rehash(const uint64_t new_slot_capacity)
+    {
+      // 重新分配槽位数组并把旧元素移动过去，同时清除所有删除标记
+      control_byte *old_control_array = control_array;
+      flat_hash_table_type_value *old_slot_array = slot_array;
+      const uint64_t old_slot_capacity = hash_capacity;
+      allocate_storage(new_slot_capacity);
+      for (uint64_t slot_traversal = 0; slot_traversal < old_slot_capacity; ++slot_traversal)
       {
-        return iterator(nullptr);
+        if (old_control_array[slot_traversal] >= 0)
+        {
+          flat_hash_table_type_value &old_slot = old_slot_array[slot_traversal];
+          const uint64_t hash_value = key_hash(value_imitation_functions(old_slot));
+          const uint64_t slot_location = find_insert_slot(hash_value);
+          set_control(slot_location, hash_fragment(hash_value));
+          ::new (static_cast<void *>(slot_array + slot_location)) flat_hash_table_type_value(std::move(old_slot));
+          old_slot.~flat_hash_table_type_value();
+          --growth_left;
+        }
+      }
+      if (old_slot_array != nullptr)
+      {
+        slot_allocator_object.deallocate(old_slot_array, old_slot_capacity);
+      }
+      delete[] old_control_array;
+    }
+    void grow_if_needed()
+    {
+      if (growth_left != 0)
+      {
+        return;
+      }
+      if (hash_capacity == 0)
+      {
+        rehash(minimum_capacity);
+      }
+      else if (_size * 2 <= capacity_to_growth(hash_capacity))
+      {
+        // 空间主要被删除标记占用，原地重建即可
+        rehash(hash_capacity);
       }
       else
       {
-        uint64_t hash_mapping_value = hash_function_object(hash_table_value_data);
-        uint64_t hash_map_location = hash_mapping_value % hash_capacity;
-        // 找到映射位置
-        container_node *hash_bucket_node = vector_hash_table[hash_map_location];
-        while (hash_bucket_node != nullptr)
+        rehash(hash_capacity * 2);
+      }
+    }
+    template <typename insert_value_type>
+    bool insert_value(insert_value_type &&flat_hash_table_value_data)
+    {
+      uint64_t hash_value = key_hash(value_imitation_functions(flat_hash_table_value_data));
+      if (locate(value_imitation_functions(flat_hash_table_value_data), hash_value) != hash_capacity)
+      {
+        return false;
+      }
+      grow_if_needed();
+      const uint64_t slot_location = find_insert_slot(hash_value);
+      if (control_array[slot_location] == control_empty)
+      {
+        // 复用删除标记不消耗增长额度
+        --growth_left;
+      }
+      set_control(slot_location, hash_fragment(hash_value));
+      ::new (static_cast<void *>(slot_array + slot_location)) flat_hash_table_type_value(std::forward<insert_value_type>(flat_hash_table_value_data));
+      ++_size;
+      return true;
+    }
+
+  public:
+    using iterator = flat_hash_iterator<flat_hash_table_type_value>;
+    using const_iterator = flat_hash_iterator<const flat_hash_table_type_value>;
+    flat_hash_table() = default;
+
+    explicit flat_hash_table(const uint64_t new_hash_table_capacity)
+    {
+      reserve(new_hash_table_capacity);
+    }
+    flat_hash_table(const flat_hash_table &flat_hash_table_data)
+        : value_imitation_functions(flat_hash_table_data.value_imitation_functions),
+          hash_function_object(flat_hash_table_data.hash_function_object)
+    {
+      if (flat_hash_table_data.hash_capacity == 0)
+      {
+        return;
+      }
+      allocate_storage(flat_hash_table_data.hash_capacity);
+      // 槽位布局完全相同，直接复制控制字节并逐个拷贝构造元素
+      std::memcpy(control_array, flat_hash_table_data.control_array, hash_capacity + group_width);
+      uint64_t slot_traversal = 0;
+      try
+      {
+        for (; slot_traversal < hash_capacity; ++slot_traversal)
         {
-          if (value_imitation_functions(hash_bucket_node->_data) == value_imitation_functions(hash_table_value_data))
+          if (control_array[slot_traversal] >= 0)
           {
-            return iterator(hash_bucket_node);
+            ::new (static_cast<void *>(slot_array + slot_traversal)) flat_hash_table_type_value(flat_hash_table_data.slot_array[slot_traversal]);
           }
-          hash_bucket_node = hash_bucket_node->_next;
         }
-        return iterator(nullptr);
       }
+      catch (...)
+      {
+        // 析构函数不会运行：析构已构造的元素，把控制字节全部置空后释放存储，再把异常抛出去
+        for (uint64_t built_slot = 0; built_slot < slot_traversal; ++built_slot)
+        {
+          if (control_array[built_slot] >= 0)
+          {
+            slot_array[built_slot].~flat_hash_table_type_value();
+          }
+        }
+        std::memset(control_array, static_cast<unsigned char>(control_empty), hash_capacity + group_width);
+        release_storage();
+        throw;
+      }
+      _size = flat_hash_table_data._size;
+      growth_left = flat_hash_table_data.growth_left;
+    }
+    flat_hash_table(flat_hash_table &&flat_hash_table_data) noexcept
+        : value_imitation_functions(std::move(flat_hash_table_data.value_imitation_functions)),
+          hash_function_object(std::move(flat_hash_table_data.hash_function_object)),
+          control_array(flat_hash_table_data.control_array), slot_array(flat_hash_table_data.slot_array),
+          _size(flat_hash_table_data._size), hash_capacity(flat_hash_table_data.hash_capacity),
+          growth_left(flat_hash_table_data.growth_left)
+    {
+      flat_hash_table_data.control_array = nullptr;
+      flat_hash_table_data.slot_array = nullptr;
+      flat_hash_table_data._size = flat_hash_table_data.hash_capacity = flat_hash_table_data.growth_left = 0;
+    }
+    ~flat_hash_table() noexcept
+    {
+      release_storage();
+    }
+    void swap(flat_hash_table &flat_hash_table_data) noexcept
+    {
+      standard_con::algorithm::swap(value_imitation_functions, flat_hash_table_data.value_imitation_functions);
+      standard_con::algorithm::swap(hash_function_object, flat_hash_table_data.hash_function_object);
+      standard_con::algorithm::swap(control_array, flat_hash_table_data.control_array);
+      standard_con::algorithm::swap(slot_array, flat_hash_table_data.slot_array);
+      standard_con::algorithm::swap(_size, flat_hash_table_data._size);
+      standard_con::algorithm::swap(hash_capacity, flat_hash_table_data.hash_capacity);
+      standard_con::algorithm::swap(growth_left, flat_hash_table_data.growth_left);
+    }
+    flat_hash_table &operator=(const flat_hash_table &flat_hash_table_data)
+    {
+      if (this != &flat_hash_table_data)
+      {
+        flat_hash_table copy_object(flat_hash_table_data);
+        swap(copy_object);
+      }
+      return *this;
+    }
+    flat_hash_table &operator=(flat_hash_table &&flat_hash_table_data) noexcept
+    {
+      if (this != &flat_hash_table_data)
+      {
+        release_storage();
+        swap(flat_hash_table_data);
+      }
+      return *this;
+    }
+    iterator begin() { return iterator(control_array, slot_array, slot_array + hash_capacity); }
+
+    iterator end() { return iterator(control_array + hash_capacity, slot_array + hash_capacity, slot_array + hash_capacity); }
+
+    const_iterator cbegin() const { return const_iterator(control_array, slot_array, slot_array + hash_capacity); }
+
+    const_iterator cend() const { return const_iterator(control_array + hash_capacity, slot_array + hash_capacity, slot_array + hash_capacity); }
+
+    [[nodiscard]] uint64_t size() const
+    {
+      return _size;
+    }
+
+    [[nodiscard]] bool empty() const
+    {
+      return _size == 0;
+    }
+
+    [[nodiscard]] uint64_t capacity() const
+    {
+      return hash_capacity;
+    }
+
+    void reserve(const uint64_t element_count)
+    {
+      uint64_t new_slot_capacity = minimum_capacity;
+      while (capacity_to_growth(new_slot_capacity) < element_count)
+      {
+        new_slot_capacity *= 2;
+      }
+      if (new_slot_capacity > hash_capacity)
+      {
+        rehash(new_slot_capacity);
+      }
+    }
+    void clear() noexcept
+    {
+      for (uint64_t slot_traversal = 0; slot_traversal < hash_capacity; ++slot_traversal)
+      {
+        if (control_array[slot_traversal] >= 0)
+        {
+          slot_array[slot_traversal].~flat_hash_table_type_value();
+        }
+      }
+      if (control_array != nullptr)
+      {
+        std::memset(control_array, static_cast<unsigned char>(control_empty), hash_capacity + group_width);
+      }
+      _size = 0;
+      growth_left = capacity_to_growth(hash_capacity);
+    }
+    bool push(const flat_hash_table_type_value &flat_hash_table_value_data)
+    {
+      return insert_value(flat_hash_table_value_data);
+    }
+    bool push(flat_hash_table_type_value &&flat_hash_table_value_data)
+    {
+      return insert_value(std::move(flat_hash_table_value_data));
+    }
+    bool pop(const flat_hash_table_type_value &flat_hash_table_value_data)
+    {
+      const uint64_t hash_value = key_hash(value_imitation_functions(flat_hash_table_value_data));
+      const uint64_t slot_location = locate(value_imitation_functions(flat_hash_table_value_data), hash_value);
+      if (slot_location == hash_capacity)
+      {
+        return false;
+      }
+      slot_array[slot_location].~flat_hash_table_type_value();
+      set_control(slot_location, control_deleted);
+      --_size;
+      return true;
+    }
+    iterator find(const flat_hash_table_type_value &flat_hash_table_value_data)
+    {
+      return operator[](value_imitation_functions(flat_hash_table_value_data));
+    }
+    iterator operator[](const flat_hash_table_type_key &key_value)
+    {
+      const uint64_t slot_location = locate(key_value, key_hash(key_value));
+      if (slot_location == hash_capacity)
+      {
+        return end();
+      }
+      return iterator(control_array + slot_location, slot_array + slot_location, slot_array + hash_capacity);
+    }
+    // 哈希函数带有 `is_transparent` 时接受任意可与键比较的查找类型
+    template <typename lookup_type>
+      requires standard_con::transparent_function<hash_function>
+    iterator operator[](const lookup_type &key_value)
+    {
+      const uint64_t slot_location = locate(key_value, key_hash(key_value));
+      if (slot_location == hash_capacity)
+      {
+        return end();
+      }
+      return iterator(control_array + slot_location, slot_array + slot_location, slot_array + hash_capacity);
+    }
+    [[nodiscard]] bool contains(const flat_hash_table_type_key &key_value)
+    {
+      return locate(key_value, key_hash(key_value)) != hash_capacity;
+    }
+    template <typename lookup_type>
+      requires standard_con::transparent_function<hash_function>
+    [[nodiscard]] bool contains(const lookup_type &key_value)
+    {
+      return locate(key_value, key_hash(key_value)) != hash_capacity;
     }
   };
   /**
    * @brief 位集合（BitSet）类实现
    *
-   * 这是一个自定义的位集合类，使用`standard_con::vector<int>`存储位数据，
+   * 使用`standard_con::vector<uint64_t>`按 64 位字存储位数据，每个字存 64 个布尔值（0或1）。
    *
-   * 每个int（通常32位）可以存储32个布尔值（0或1）。
+   * 位集合可以高效地处理大量布尔值，常用于槽位分配、去重标记、集合运算等场景。
    *
-   * 位集合可以高效地处理大量布尔值，常用于需要节省空间的场景，
+   * 主要功能包括：
    *
-   * 如数据过滤、标记、集合运算等。
+   * - 设置 / 重置 / 翻转 / 测试指定位置的位（set、reset、flip、test）
    *
-   * 主要功能包括：
+   * - `size()` / `count()`：当前为 1 的位数（增量维护，O(1)），`capacity()`：位集合总位数
    *
-   * - 设置指定位置的位（set）
+   * - `find_first` / `find_next` / `find_first_zero` / `find_next_zero`：按字跳过全 0（或全 1）的字，字内用 ctz 定位，不逐位循环
    *
-   * - 重置指定位置的位（reset）
+   * - `rank(pos)`：[0, pos) 中 1 的个数，`select(k)`：第 k 个（从 0 开始）1 的位置；
    *
-   * - 测试指定位置的位是否设置（test）
+   *   调用一次 `build_rank_index()` 启用每 512 位一个的累计计数索引，之后 rank 为 O(1)、select 为 O(log n)；
    *
-   * - 调整大小（resize）
+   *   索引启用后随 set / reset / flip、批量运算和 resize 同步维护，不会失效；代价是单个位的修改要调整其后的累计数，
    *
-   * - 拷贝构造和赋值操作
+   *   为 O(capacity / 512)。未启用时两者从头逐字 popcount，只做槽位分配的位集合不必付出维护代价。两者都是只读的，可以多线程同时调用
+   *
+   * - `&=`、`|=`、`^=`、`and_not`：整字批量运算，SSE2 下每次处理 128 位
+   *
+   * - 调整大小（resize，会清空所有位）、拷贝 / 移动构造和赋值
+   *
+   * 注意事项：
+   *
+   * - 越界的 `set` / `reset` / `flip` 会抛出异常，越界的 `test` 返回 false
+   *
+   * - 批量运算只作用于两个位集合重叠的部分，`&=` 会把超出对方长度的位清零
    */
   class bit_set
   {
-    standard_con::vector<int> vector_bit_set;
+    static constexpr uint64_t word_bits = 64;
+    static constexpr uint64_t superblock_words = 8;
+    standard_con::vector<uint64_t> vector_bit_set;
+    uint64_t _capacity;
     uint64_t _size;
+    standard_con::vector<uint64_t> rank_index; // 启用后为每个超级块之前 1 的个数，末尾多一个总数
+    bool rank_index_valid;
+    [[nodiscard]] uint64_t word_count() const noexcept
+    {
+      return vector_bit_set.size();
+    }
+    [[nodiscard]] uint64_t *word_data() noexcept
+    {
+      return vector_bit_set.data();
+    }
+    [[nodiscard]] const uint64_t *word_data() const noexcept
+    {
+      return vector_bit_set.data();
+    }
+    void allocate_words(const uint64_t &new_capacity)
+    {
+      standard_con::vector<uint64_t> new_bit_set;
+      const uint64_t new_word_count = (new_capacity + word_bits - 1) / word_bits;
+      new_bit_set.resize(new_word_count, 0);
+      vector_bit_set.swap(new_bit_set);
+      _capacity = new_capacity;
+      _size = 0;
+      if (rank_index_valid)
+      {
+        // 字数变了，索引按新的大小重建；重建时抛出异常则索引保持停用，rank / select 回到逐字扫描，结果仍然正确
+        rank_index_valid = false;
+        build_rank_index();
+      }
+    }
+    void refresh_rank_index() noexcept
+    {
+      // 字数不变时原地重算全部累计数，批量运算本身就是 O(n)，不额外分配内存
+      if (!rank_index_valid)
+      {
+        return;
+      }
+      const uint64_t *words = word_data();
+      uint64_t running_count = 0;
+      for (uint64_t word_position = 0; word_position < word_count(); ++word_position)
+      {
+        if (word_position % superblock_words == 0)
+        {
+          rank_index[word_position / superblock_words] = running_count;
+        }
+        running_count += static_cast<uint64_t>(std::popcount(words[word_position]));
+      }
+      rank_index[rank_index.size() - 1] = running_count;
+    }
+    void adjust_rank_index(const uint64_t &value_data, const bool bit_added) noexcept
+    {
+      // 单个位变化只影响它所在超级块之后的累计数
+      if (!rank_index_valid)
+      {
+        return;
+      }
+      for (uint64_t block_position = value_data / (word_bits * superblock_words) + 1; block_position < rank_index.size(); ++block_position)
+      {
+        bit_added ? ++rank_index[block_position] : --rank_index[block_position];
+      }
+    }
+    void check_position(const uint64_t &value_data, const char *function_name) const
+    {
+      try
+      {
+        if (value_data >= _capacity)
+        {
+          throw custom_exception::fault("位集合访问越界！", function_name, __LINE__);
+        }
+      }
+      catch (const custom_exception::fault &process)
+      {
+        std::cerr << process.what() << " " << process.function_name_get() << " " << process.line_number_get() << std::endl;
+        throw;
+      }
+    }
+    void trim_tail() noexcept
+    {
+      // 最后一个字中超出 capacity 的位始终保持为 0，find_next_zero 和计数才不会算进去
+      if (_capacity % word_bits != 0 && word_count() != 0)
+      {
+        word_data()[word_count() - 1] &= (1ULL << (_capacity % word_bits)) - 1;
+      }
+    }
+    void recount() noexcept
+    {
+      const uint64_t *words = word_data();
+      _size = 0;
+      for (uint64_t word_position = 0; word_position < word_count(); ++word_position)
+      {
+        _size += static_cast<uint64_t>(std::popcount(words[word_position]));
+      }
+      refresh_rank_index();
+    }
+    template <bool find_set_bit>
+    [[nodiscard]] uint64_t scan_from(const uint64_t &start_position) const noexcept
+    {
+      if (start_position >= _capacity)
+      {
+        return npos;
+      }
+      const uint64_t *words = word_data();
+      uint64_t word_position = start_position / word_bits;
+      // 第一个字先屏蔽掉 start_position 之前的位
+      uint64_t current_word = (find_set_bit ? words[word_position] : ~words[word_position]) & (~0ULL << (start_position % word_bits));
+      while (true)
+      {
+        if (current_word != 0)
+        {
+          const uint64_t bit_position = word_position * word_bits + static_cast<uint64_t>(std::countr_zero(current_word));
+          return bit_position < _capacity ? bit_position : npos;
+        }
+        if (++word_position >= word_count())
+        {
+          return npos;
+        }
+        current_word = find_set_bit ? words[word_position] : ~words[word_position];
+      }
+    }
+    template <typename word_operation, typename lane_operation>
+    void bulk_apply(const bit_set &bit_set_data, word_operation word_operation_function, lane_operation lane_operation_function) noexcept
+    {
+      uint64_t *words = word_data();
+      const uint64_t *other_words = bit_set_data.word_data();
+      const uint64_t overlap_count = word_count() < bit_set_data.word_count() ? word_count() : bit_set_data.word_count();
+      uint64_t word_position = 0;
+#if defined(__SSE2__)
+      for (; word_position + 2 <= overlap_count; word_position += 2)
+      {
+        const __m128i self_lane = _mm_loadu_si128(reinterpret_cast<const __m128i *>(words + word_position));
+        const __m128i other_lane = _mm_loadu_si128(reinterpret_cast<const __m128i *>(other_words + word_position));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(words + word_position), lane_operation_function(self_lane, other_lane));
+      }
+#else
+      (void)lane_operation_function;
+#endif
+      for (; word_position < overlap_count; ++word_position)
+      {
+        words[word_position] = word_operation_function(words[word_position], other_words[word_position]);
+      }
+    }
 
   public:
-    bit_set() : _size(0) { ; }
-    explicit bit_set(const uint64_t &new_capacity)
+    static constexpr uint64_t npos = ~0ULL;
+    bit_set() : _capacity(0), _size(0), rank_index_valid(false) { ; }
+    explicit bit_set(const uint64_t &new_capacity) : _capacity(0), _size(0), rank_index_valid(false)
     {
-      _size = 0;
-      vector_bit_set.resize((new_capacity / 32) + 1, 0);
-      // 多开一个int的空间，防止不够
+      allocate_words(new_capacity);
     }
     void resize(const uint64_t &new_capacity)
     {
-      _size = 0;
-      vector_bit_set.resize((new_capacity / 32) + 1, 0);
+      allocate_words(new_capacity);
     }
     bit_set(const bit_set &bit_set_data)
+        : vector_bit_set(bit_set_data.vector_bit_set), _capacity(bit_set_data._capacity), _size(bit_set_data._size),
+          rank_index(bit_set_data.rank_index), rank_index_valid(bit_set_data.rank_index_valid)
     {
-      vector_bit_set = bit_set_data.vector_bit_set;
-      _size = bit_set_data._size;
+      ;
+    }
+    bit_set(bit_set &&bit_set_data) noexcept
+        : _capacity(bit_set_data._capacity), _size(bit_set_data._size), rank_index_valid(bit_set_data.rank_index_valid)
+    {
+      vector_bit_set.swap(bit_set_data.vector_bit_set);
+      rank_index.swap(bit_set_data.rank_index);
+      bit_set_data._capacity = 0;
+      bit_set_data._size = 0;
+      bit_set_data.rank_index_valid = false;
     }
     bit_set &operator=(const bit_set &bit_set_data)
     {
       if (this != &bit_set_data)
       {
-        vector_bit_set = bit_set_data.vector_bit_set;
-        _size = bit_set_data._size;
+        bit_set temp_bit_set(bit_set_data);
+        swap(temp_bit_set);
       }
       return *this;
     }
+    bit_set &operator=(bit_set &&bit_set_data) noexcept
+    {
+      if (this != &bit_set_data)
+      {
+        swap(bit_set_data);
+      }
+      return *this;
+    }
+    void swap(bit_set &bit_set_data) noexcept
+    {
+      vector_bit_set.swap(bit_set_data.vector_bit_set);
+      rank_index.swap(bit_set_data.rank_index);
+      standard_con::algorithm::swap(_capacity, bit_set_data._capacity);
+      standard_con::algorithm::swap(_size, bit_set_data._size);
+      standard_con::algorithm::swap(rank_index_valid, bit_set_data.rank_index_valid);
+    }
     void set(const uint64_t &value_data)
     {
-      // 把数映射到BitSet上的函数
-      uint64_t mapping_bit = value_data / 32; // 定位到BitSet的位置在哪个int上
-      uint64_t value_bit = value_data % 32;   // 定位到BitSet的位置在哪个int上的第几位
-      vector_bit_set[mapping_bit] = vector_bit_set[mapping_bit] | (1 << value_bit);
-      // 比较当前位置是否为1，若为1则不需要改变，若为0则需要改变，注意|只改变当前位不会改变其他位
-      //|是两个条件满足一个条件就行，&是两个条件都满足才行
-      // 其他位如果是1那么就还是1，如果是0那么就还是0，因为|是两个条件满足一个条件就行
-      _size++;
+      // 把数映射到BitSet上的函数：高位定位到哪个字，低 6 位定位到字里的第几位
+      check_position(value_data, "set");
+      uint64_t &mapping_word = word_data()[value_data / word_bits];
+      const uint64_t value_bit = 1ULL << (value_data % word_bits);
+      if ((mapping_word & value_bit) == 0)
+      {
+        ++_size;
+        adjust_rank_index(value_data, true);
+      }
+      mapping_word |= value_bit;
     }
     void reset(const uint64_t &value_data)
     {
-      // 删除映射的位置的函数
-      uint64_t mapping_bit = value_data / 32;
-      uint64_t value_bit = value_data % 32;
-      vector_bit_set[mapping_bit] = vector_bit_set[mapping_bit] & (~(1 << value_bit));
-      //&是两个条件都满足，~是取反，^是两个条件不同时满足
-      // 1取反关键位是0其他位是1，这样就成功与掉，&要求是两个条件都需要满足
-      // 其他位如果是1那么就不会改变原来的，如果是0那么还是为0，因为与是两个条件都需要满足
-      _size--;
+      // 删除映射的位置：1 左移后取反，只把关键位与掉
+      check_position(value_data, "reset");
+      uint64_t &mapping_word = word_data()[value_data / word_bits];
+      const uint64_t value_bit = 1ULL << (value_data % word_bits);
+      if ((mapping_word & value_bit) != 0)
+      {
+        --_size;
+        adjust_rank_index(value_data, false);
+      }
+      mapping_word &= ~value_bit;
     }
-    [[nodiscard]] uint64_t size() const
+    void flip(const uint64_t &value_data)
+    {
+      check_position(value_data, "flip");
+      uint64_t &mapping_word = word_data()[value_data / word_bits];
+      const uint64_t value_bit = 1ULL << (value_data % word_bits);
+      const bool bit_added = (mapping_word & value_bit) == 0;
+      bit_added ? ++_size : --_size;
+      adjust_rank_index(value_data, bit_added);
+      mapping_word ^= value_bit;
+    }
+    void clear() noexcept
     {
-      return _size;
+      uint64_t *words = word_data();
+      for (uint64_t word_position = 0; word_position < word_count(); ++word_position)
+      {
+        words[word_position] = 0;
+      }
+      _size = 0;
+      refresh_rank_index();
     }
-    bool test(const uint64_t &value_data)
+    [[nodiscard]] bool test(const uint64_t &value_data) const noexcept
     {
-      if (_size == 0)
+      if (value_data >= _capacity)
       {
         return false;
       }
-      uint64_t mapping_bit = value_data / 32;
-      uint64_t value_bit = value_data % 32;
-      bool return_bit_set = vector_bit_set[mapping_bit] & (1 << value_bit);
-      // 如果_BitSet[mapping_bit]里对应的位是1那么就返回true，否则返回false
-      return return_bit_set;
+      return (word_data()[value_data / word_bits] >> (value_data % word_bits)) & 1ULL;
+    }
+    [[nodiscard]] uint64_t size() const noexcept
+    {
+      return _size;
+    }
+    [[nodiscard]] uint64_t count() const noexcept
+    {
+      return _size;
+    }
+    [[nodiscard]] uint64_t capacity() const noexcept
+    {
+      return _capacity;
+    }
+    [[nodiscard]] bool any() const noexcept
+    {
+      return _size != 0;
+    }
+    [[nodiscard]] bool none() const noexcept
+    {
+      return _size == 0;
+    }
+    [[nodiscard]] uint64_t find_first() const noexcept
+    {
+      return scan_from<true>(0);
+    }
+    [[nodiscard]] uint64_t find_next(const uint64_t &value_data) const noexcept
+    {
+      // 返回严格大于 value_data 的第一个 1 的位置，没有则返回 npos
+      return value_data == npos ? npos : scan_from<true>(value_data + 1);
+    }
+    [[nodiscard]] uint64_t find_first_zero() const noexcept
+    {
+      return scan_from<false>(0);
+    }
+    [[nodiscard]] uint64_t find_next_zero(const uint64_t &value_data) const noexcept
+    {
+      return value_data == npos ? npos : scan_from<false>(value_data + 1);
+    }
+    void build_rank_index()
+    {
+      // 每 512 位（8 个字）记录一次之前所有 1 的个数，最后多存一个总数方便 select 二分；
+      // 放在非 const 方法里建好，之后由各个修改操作同步维护，const 的 rank / select 只读索引，多个线程可以同时查询
+      const uint64_t *words = word_data();
+      const uint64_t superblock_count = (word_count() + superblock_words - 1) / superblock_words;
+      standard_con::vector<uint64_t> new_rank_index;
+      new_rank_index.reserve(superblock_count + 1);
+      uint64_t running_count = 0;
+      for (uint64_t superblock_position = 0; superblock_position < superblock_count; ++superblock_position)
+      {
+        new_rank_index.push_back(running_count);
+        const uint64_t word_end = (superblock_position + 1) * superblock_words < word_count() ? (superblock_position + 1) * superblock_words : word_count();
+        for (uint64_t word_position = superblock_position * superblock_words; word_position < word_end; ++word_position)
+        {
+          running_count += static_cast<uint64_t>(std::popcount(words[word_position]));
+        }
+      }
+      new_rank_index.push_back(running_count);
+      rank_index.swap(new_rank_index);
+      rank_index_valid = true;
+    }
+    [[nodiscard]] uint64_t rank(const uint64_t &value_data) const
+    {
+      // [0, value_data) 中 1 的个数：索引启用时为超级块累计数 + 块内至多 8 个字的 popcount，否则从头逐字 popcount
+      const uint64_t rank_position = value_data > _capacity ? _capacity : value_data;
+      const uint64_t *words = word_data();
+      const uint64_t word_position = rank_position / word_bits;
+      uint64_t rank_value = 0;
+      uint64_t scan_begin = 0;
+      if (rank_index_valid)
+      {
+        rank_value = rank_index[word_position / superblock_words];
+        scan_begin = (word_position / superblock_words) * superblock_words;
+      }
+      for (uint64_t scan_position = scan_begin; scan_position < word_position; ++scan_position)
+      {
+        rank_value += static_cast<uint64_t>(std::popcount(words[scan_position]));
+      }
+      if (rank_position % word_bits != 0)
+      {
+        rank_value += static_cast<uint64_t>(std::popcount(words[word_position] & ((1ULL << (rank_position % word_bits)) - 1)));
+      }
+      return rank_value;
+    }
+    [[nodiscard]] uint64_t select(const uint64_t &rank_value) const
+    {
+      // 第 rank_value 个 1（从 0 开始）的位置：先在超级块累计数上二分，再在块内逐字扣减，最后在字内逐次清掉最低位
+      if (rank_value >= _size)
+      {
+        return npos;
+      }
+      uint64_t remaining_rank = rank_value;
+      uint64_t word_position = 0;
+      if (rank_index_valid)
+      {
+        uint64_t low_block = 0;
+        uint64_t high_block = rank_index.size() - 1;
+        while (high_block - low_block > 1)
+        {
+          const uint64_t middle_block = low_block + (high_block - low_block) / 2;
+          if (rank_index[middle_block] <= rank_value)
+          {
+            low_block = middle_block;
+          }
+          else
+          {
+            high_block = middle_block;
+          }
+        }
+        remaining_rank -= rank_index[low_block];
+        word_position = low_block * superblock_words;
+      }
+      const uint64_t *words = word_data();
+      while (true)
+      {
+        const auto word_count_value = static_cast<uint64_t>(std::popcount(words[word_position]));
+        if (remaining_rank < word_count_value)
+        {
+          break;
+        }
+        remaining_rank -= word_count_value;
+        ++word_position;
+      }
+      uint64_t current_word = words[word_position];
+      for (; remaining_rank > 0; --remaining_rank)
+      {
+        current_word &= current_word - 1;
+      }
+      return word_position * word_bits + static_cast<uint64_t>(std::countr_zero(current_word));
+    }
+    bit_set &operator&=(const bit_set &bit_set_data) noexcept
+    {
+#if defined(__SSE2__)
+      bulk_apply(bit_set_data, [](uint64_t self_word, uint64_t other_word) { return self_word & other_word; },
+                 [](__m128i self_lane, __m128i other_lane) { return _mm_and_si128(self_lane, other_lane); });
+#else
+      bulk_apply(bit_set_data, [](uint64_t self_word, uint64_t other_word) { return self_word & other_word; }, nullptr);
+#endif
+      uint64_t *words = word_data();
+      for (uint64_t word_position = bit_set_data.word_count(); word_position < word_count(); ++word_position)
+      {
+        words[word_position] = 0;
+      }
+      recount();
+      return *this;
+    }
+    bit_set &operator|=(const bit_set &bit_set_data) noexcept
+    {
+#if defined(__SSE2__)
+      bulk_apply(bit_set_data, [](uint64_t self_word, uint64_t other_word) { return self_word | other_word; },
+                 [](__m128i self_lane, __m128i other_lane) { return _mm_or_si128(self_lane, other_lane); });
+#else
+      bulk_apply(bit_set_data, [](uint64_t self_word, uint64_t other_word) { return self_word | other_word; }, nullptr);
+#endif
+      trim_tail();
+      recount();
+      return *this;
+    }
+    bit_set &operator^=(const bit_set &bit_set_data) noexcept
+    {
+#if defined(__SSE2__)
+      bulk_apply(bit_set_data, [](uint64_t self_word, uint64_t other_word) { return self_word ^ other_word; },
+                 [](__m128i self_lane, __m128i other_lane) { return _mm_xor_si128(self_lane, other_lane); });
+#else
+      bulk_apply(bit_set_data, [](uint64_t self_word, uint64_t other_word) { return self_word ^ other_word; }, nullptr);
+#endif
+      trim_tail();
+      recount();
+      return *this;
+    }
+    bit_set &and_not(const bit_set &bit_set_data) noexcept
+    {
+      // this &= ~bit_set_data，_mm_andnot_si128 是对第一个操作数取反，所以参数要反过来传
+#if defined(__SSE2__)
+      bulk_apply(bit_set_data, [](uint64_t self_word, uint64_t other_word) { return self_word & ~other_word; },
+                 [](__m128i self_lane, __m128i other_lane) { return _mm_andnot_si128(other_lane, self_lane); });
+#else
+      bulk_apply(bit_set_data, [](uint64_t self_word, uint64_t other_word) { return self_word & ~other_word; }, nullptr);
+#endif
+      recount();
+      return *this;
     }
   };
 }
 namespace standard_con
 {
   using base_container::bit_set;
+  using base_container::flat_hash_table;
   using base_container::hash_table;
   using base_container::red_black_tree;
 }
\ No newline at end of file
@@ -1,4 +1,9 @@
 #pragma once
+#include <cmath>
+#include <cstring>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
 #include "simulate_algorithm.hpp"
 #include "simulate_base.hpp"
 #include "simulate_imitate.hpp"
@@ -84,8 +89,283 @@ namespace bloom_filter_container
     }
     // 布隆过滤器只支持插入和查找，不支持删除
   };
+  /*
+   * @brief  #### `blocked_bloom_filter` 类模板
+
+   *   - 分块布隆过滤器：把位数组切成 64 字节（512 位）对齐的块，一个元素的 k 个探测位全部落在同一块内
+
+   *   - 每次 `test` / `set` 只访问一条缓存行，普通布隆过滤器则是 k 次随机访存
+
+   * 模板参数:
+
+   * * - `bloom_filter_type_value`: 存储的元素类型
+   *
+   * * - `bloom_filter_hash_functor`: 哈希函数对象类型，默认为 `standard_con::hash_function<bloom_filter_type_value>`，需提供 `hash_seeded`
+
+   * 构造:
+
+   * * - `blocked_bloom_filter(uint64_t expected_elements, double false_positive_rate = 0.01)`: 按预计元素个数和目标误判率计算位数和哈希个数 k
+
+   * 核心方法:
+
+   * * - `set(const value&)` / `test(const value&)`: 插入 / 查询
+   *
+   * * - `test_many(const value* values, uint64_t count, bool* results)`: 批量查询，先算出整批的块地址并预取，再逐个比较块掩码（SSE2 下 128 位一组比较）
+   *
+   * * - `clear()`、`size()`、`capacity()`、`hash_count()`、`block_count()`
+
+   * 注意事项:
+
+   * * - 同样位数下分块结构的误判率略高于普通布隆过滤器，构造时按块负载的泊松分布估算误判率，不达标就继续加位
+   *
+   * * - 元素个数超过 `expected_elements` 后误判率会快速上升，不支持删除
+  */
+  template <typename bloom_filter_type_value, typename bloom_filter_hash_functor = standard_con::hash_function<bloom_filter_type_value>>
+  class blocked_bloom_filter
+  {
+    struct alignas(64) bloom_block
+    {
+      uint64_t block_words[8];
+    };
+    static constexpr uint64_t block_bits = 512;
+    static constexpr uint64_t block_bit_mask = block_bits - 1;
+    static constexpr uint64_t batch_width = 16;
+    static constexpr uint64_t block_seed = 0x9e3779b97f4a7c15ULL;
+    bloom_filter_hash_functor hash_functions_object;
+    bloom_block *bloom_blocks;
+    uint64_t _block_count;
+    uint64_t _hash_count;
+    uint64_t _size;
+    [[nodiscard]] uint64_t block_index(uint64_t hash_value) const noexcept
+    {
+      // 乘法取高 64 位把哈希值映射到 [0, _block_count)，不要求块数是 2 的幂，也不需要取模
+      uint64_t block_count_value = _block_count;
+      hash::hash_multiply_wide(hash_value, block_count_value);
+      return block_count_value;
+    }
+    void block_mask(const uint64_t hash_value, uint64_t (&mask_words)[8]) const noexcept
+    {
+      // 块内的 k 个探测位取自哈希值再混合后的比特流，每 9 位给出一个块内位置，一个 64 位字可用 7 次
+      for (uint64_t word_position = 0; word_position < 8; ++word_position)
+      {
+        mask_words[word_position] = 0;
+      }
+      uint64_t bit_stream = 0;
+      for (uint64_t hash_position = 0; hash_position < _hash_count; ++hash_position)
+      {
+        if (hash_position % 7 == 0)
+        {
+          bit_stream = hash::hash_mixing(hash_value, block_seed + hash_position);
+        }
+        const uint64_t bit_position = bit_stream & block_bit_mask;
+        bit_stream >>= 9;
+        mask_words[bit_position >> 6] |= (1ULL << (bit_position & 63));
+      }
+    }
+    [[nodiscard]] static bool block_contains(const bloom_block &block_value, const uint64_t (&mask_words)[8]) noexcept
+    {
+#if defined(__SSE2__)
+      __m128i missing_bits = _mm_setzero_si128();
+      for (uint64_t word_position = 0; word_position < 8; word_position += 2)
+      {
+        const __m128i block_lane = _mm_load_si128(reinterpret_cast<const __m128i *>(block_value.block_words + word_position));
+        const __m128i mask_lane = _mm_loadu_si128(reinterpret_cast<const __m128i *>(mask_words + word_position));
+        missing_bits = _mm_or_si128(missing_bits, _mm_andnot_si128(block_lane, mask_lane));
+      }
+      return _mm_movemask_epi8(_mm_cmpeq_epi8(missing_bits, _mm_setzero_si128())) == 0xFFFF;
+#else
+      uint64_t missing_bits = 0;
+      for (uint64_t word_position = 0; word_position < 8; ++word_position)
+      {
+        missing_bits |= mask_words[word_position] & ~block_value.block_words[word_position];
+      }
+      return missing_bits == 0;
+#endif
+    }
+    static void prefetch_block(const bloom_block *block_pointer) noexcept
+    {
+#if defined(__GNUC__) || defined(__clang__)
+      __builtin_prefetch(block_pointer, 0, 3);
+#else
+      (void)block_pointer;
+#endif
+    }
+
+    [[nodiscard]] static uint64_t optimal_hash_count(const double bits_per_element) noexcept
+    {
+      const double hash_count_value = std::round(bits_per_element * std::log(2.0));
+      return hash_count_value < 1.0 ? 1 : (hash_count_value > 16.0 ? 16 : static_cast<uint64_t>(hash_count_value));
+    }
+    [[nodiscard]] static double estimate_false_positive_rate(const double block_load, const uint64_t hash_count_value) noexcept
+    {
+      // 每块元素个数近似服从均值为 block_load 的泊松分布，对各负载下单块的误判率加权求和
+      double poisson_probability = std::exp(-block_load);
+      double false_positive_value = 0.0;
+      const auto upper_load = static_cast<uint64_t>(block_load * 4.0) + 64;
+      for (uint64_t element_load = 0; element_load <= upper_load; ++element_load)
+      {
+        const double bit_zero_probability = std::pow(1.0 - 1.0 / static_cast<double>(block_bits), static_cast<double>(element_load * hash_count_value));
+        false_positive_value += poisson_probability * std::pow(1.0 - bit_zero_probability, static_cast<double>(hash_count_value));
+        poisson_probability *= block_load / static_cast<double>(element_load + 1);
+      }
+      return false_positive_value;
+    }
+
+  public:
+    explicit blocked_bloom_filter(const uint64_t expected_elements = 1000, const double false_positive_rate = 0.01)
+        : bloom_blocks(nullptr), _block_count(0), _hash_count(0), _size(0)
+    {
+      try
+      {
+        if (!(false_positive_rate > 0.0 && false_positive_rate < 1.0))
+        {
+          throw custom_exception::fault("误判率必须在(0,1)区间内！", "blocked_bloom_filter", __LINE__);
+        }
+      }
+      catch (const custom_exception::fault &process)
+      {
+        std::cerr << process.what() << " " << process.function_name_get() << " " << process.line_number_get() << std::endl;
+        throw;
+      }
+      const double element_count = expected_elements == 0 ? 1.0 : static_cast<double>(expected_elements);
+      // 先按普通布隆过滤器公式 m = -n * ln(p) / (ln2)^2 估算，分块后各块负载不均，误判率偏高，逐步加位直到估算值达标
+      double filter_bits = -element_count * std::log(false_positive_rate) / (std::log(2.0) * std::log(2.0));
+      while (true)
+      {
+        _hash_count = optimal_hash_count(filter_bits / element_count);
+        _block_count = static_cast<uint64_t>(std::ceil(filter_bits / static_cast<double>(block_bits)));
+        _block_count = _block_count == 0 ? 1 : _block_count;
+        if (estimate_false_positive_rate(element_count / static_cast<double>(_block_count), _hash_count) <= false_positive_rate)
+        {
+          break;
+        }
+        filter_bits *= 1.05;
+      }
+      bloom_blocks = new bloom_block[_block_count]();
+    }
+    blocked_bloom_filter(const blocked_bloom_filter &bloom_filter_data)
+        : hash_functions_object(bloom_filter_data.hash_functions_object), bloom_blocks(nullptr),
+          _block_count(bloom_filter_data._block_count), _hash_count(bloom_filter_data._hash_count), _size(bloom_filter_data._size)
+    {
+      // 被移动过的过滤器没有块数组，拷贝它得到的也是空过滤器
+      if (_block_count != 0)
+      {
+        bloom_blocks = new bloom_block[_block_count];
+        std::memcpy(bloom_blocks, bloom_filter_data.bloom_blocks, _block_count * sizeof(bloom_block));
+      }
+    }
+    blocked_bloom_filter(blocked_bloom_filter &&bloom_filter_data) noexcept
+        : hash_functions_object(std::move(bloom_filter_data.hash_functions_object)), bloom_blocks(bloom_filter_data.bloom_blocks),
+          _block_count(bloom_filter_data._block_count), _hash_count(bloom_filter_data._hash_count), _size(bloom_filter_data._size)
+    {
+      // 移动后源对象为空过滤器：查询返回 false，再次 set 时分配一个块，哈希个数沿用原值
+      bloom_filter_data.bloom_blocks = nullptr;
+      bloom_filter_data._block_count = 0;
+      bloom_filter_data._size = 0;
+    }
+    blocked_bloom_filter &operator=(blocked_bloom_filter bloom_filter_data) noexcept
+    {
+      swap(bloom_filter_data);
+      return *this;
+    }
+    ~blocked_bloom_filter() noexcept
+    {
+      delete[] bloom_blocks;
+    }
+    void swap(blocked_bloom_filter &bloom_filter_data) noexcept
+    {
+      standard_con::algorithm::swap(hash_functions_object, bloom_filter_data.hash_functions_object);
+      standard_con::algorithm::swap(bloom_blocks, bloom_filter_data.bloom_blocks);
+      standard_con::algorithm::swap(_block_count, bloom_filter_data._block_count);
+      standard_con::algorithm::swap(_hash_count, bloom_filter_data._hash_count);
+      standard_con::algorithm::swap(_size, bloom_filter_data._size);
+    }
+    void set(const bloom_filter_type_value &temp_bf_map_value)
+    {
+      if (bloom_blocks == nullptr)
+      {
+        bloom_blocks = new bloom_block[1]();
+        _block_count = 1;
+      }
+      const uint64_t hash_value = hash_functions_object.hash_seeded(temp_bf_map_value, 0);
+      bloom_block &target_block = bloom_blocks[block_index(hash_value)];
+      uint64_t mask_words[8];
+      block_mask(hash_value, mask_words);
+      for (uint64_t word_position = 0; word_position < 8; ++word_position)
+      {
+        target_block.block_words[word_position] |= mask_words[word_position];
+      }
+      ++_size;
+    }
+    [[nodiscard]] bool test(const bloom_filter_type_value &temp_bf_map_value)
+    {
+      if (_block_count == 0)
+      {
+        return false;
+      }
+      const uint64_t hash_value = hash_functions_object.hash_seeded(temp_bf_map_value, 0);
+      uint64_t mask_words[8];
+      block_mask(hash_value, mask_words);
+      return block_contains(bloom_blocks[block_index(hash_value)], mask_words);
+    }
+    void test_many(const bloom_filter_type_value *values_pointer, const uint64_t values_count, bool *results_pointer)
+    {
+      // 分批处理：第一遍算哈希并预取整批的块，第二遍再比较，让多个缓存未命中互相重叠
+      uint64_t batch_hashes[batch_width];
+      const bloom_block *batch_blocks[batch_width];
+      if (_block_count == 0)
+      {
+        for (uint64_t value_position = 0; value_position < values_count; ++value_position)
+        {
+          results_pointer[value_position] = false;
+        }
+        return;
+      }
+      for (uint64_t batch_begin = 0; batch_begin < values_count; batch_begin += batch_width)
+      {
+        const uint64_t batch_size = (values_count - batch_begin) < batch_width ? (values_count - batch_begin) : batch_width;
+        for (uint64_t batch_position = 0; batch_position < batch_size; ++batch_position)
+        {
+          batch_hashes[batch_position] = hash_functions_object.hash_seeded(values_pointer[batch_begin + batch_position], 0);
+          batch_blocks[batch_position] = bloom_blocks + block_index(batch_hashes[batch_position]);
+          prefetch_block(batch_blocks[batch_position]);
+        }
+        for (uint64_t batch_position = 0; batch_position < batch_size; ++batch_position)
+        {
+          uint64_t mask_words[8];
+          block_mask(batch_hashes[batch_position], mask_words);
+          results_pointer[batch_begin + batch_position] = block_contains(*batch_blocks[batch_position], mask_words);
+        }
+      }
+    }
+    void clear() noexcept
+    {
+      if (bloom_blocks != nullptr)
+      {
+        std::memset(static_cast<void *>(bloom_blocks), 0, _block_count * sizeof(bloom_block));
+      }
+      _size = 0;
+    }
+    [[nodiscard]] uint64_t size() const noexcept
+    {
+      return _size;
+    }
+    [[nodiscard]] uint64_t capacity() const noexcept
+    {
+      return _block_count * block_bits;
+    }
+    [[nodiscard]] uint64_t hash_count() const noexcept
+    {
+      return _hash_count;
+    }
+    [[nodiscard]] uint64_t block_count() const noexcept
+    {
+      return _block_count;
+    }
+  };
 }
 namespace standard_con
 {
   using bloom_filter_container::bloom_filter;
-}
\ No newline at end of file
+  using bloom_filter_container::blocked_bloom_filter;
+}
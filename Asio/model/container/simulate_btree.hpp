@@ -0,0 +1,1024 @@
+#pragma once
+#include <cstring>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include "simulate_algorithm.hpp"
+#include "simulate_imitate.hpp"
+#include "simulate_utility.hpp"
+namespace btree_container
+{
+  /*
+   * @brief  #### `b_plus_tree` 类模板
+
+      *   - B+ 树：所有元素都放在叶子里，内部节点只存分隔键和孩子指针，叶子之间用双向链表串起来
+
+      *   - 节点按约 512 字节（若干缓存行）定宽，一个节点装几十个元素，查找时每层只有一次随机访存，节点内二分
+
+      *   - 顺序遍历和区间扫描沿叶子链表走，不需要回到父节点
+
+      *   - `btree_map` 和 `btree_set` 的底层实现
+
+      * 模板参数:
+
+      * * - `btree_key_type`: 键类型
+      *
+      * * - `btree_value_type`: 叶子中存放的元素类型（map 为键值对，set 为键本身）
+      *
+      * * - `key_extractor`: 从元素中取键的仿函数
+      *
+      * * - `comparators`: 键的比较器，返回 `true` 表示左操作数小于右操作数
+
+      * 主要操作方法:
+
+      * * - `insert()`: 插入元素，键已存在时不插入，返回 `pair<iterator, bool>`
+      *
+      * * - `erase(key)`: 按键删除，节点不足半满时先向相邻兄弟借元素，借不到再与兄弟合并
+      *
+      * * - `find()` / `contains()` / `count()`: 按键查找
+      *
+      * * - `lower_bound()` / `upper_bound()` / `equal_range()`: 区间查找
+
+      * 特性:
+
+      * * - 分隔键取右子树的最小键，等于分隔键的键走右边
+      *
+      * * - 叶子满时一分为二；在最右叶子末尾追加时左半保持满载，顺序插入的叶子利用率接近 100%
+      *
+      * * - 插入需要的新节点在改动树之前一次申请好，申请失败时树保持不变
+      *
+      * * - `size()` 为 O(1)
+
+      * 注意事项:
+
+      * * - 插入和删除会使所有迭代器失效
+      *
+      * * - 元素在节点内按位置存放，插入删除会移动同一节点内的其他元素，不要保存元素地址
+  */
+  template <typename btree_key_type, typename btree_value_type, typename key_extractor, typename comparators>
+  class b_plus_tree
+  {
+    static constexpr uint64_t node_bytes = 512;
+    static constexpr uint64_t clamp_capacity(const uint64_t slot_count) noexcept
+    {
+      // 容量限制在 [8, 128] 且为偶数，保证分裂后两边都不少于一半
+      const uint64_t bounded_count = slot_count < 8 ? 8 : (slot_count > 128 ? 128 : slot_count);
+      return bounded_count & ~static_cast<uint64_t>(1);
+    }
+    static constexpr uint64_t leaf_capacity = clamp_capacity(node_bytes / sizeof(btree_value_type));
+    static constexpr uint64_t inner_capacity = clamp_capacity(node_bytes / (sizeof(btree_key_type) + sizeof(void *)));
+    static constexpr uint64_t leaf_minimum = leaf_capacity / 2;
+    static constexpr uint64_t inner_minimum = inner_capacity / 2;
+    static constexpr uint64_t maximum_depth = 64;
+    struct node_base
+    {
+      uint64_t count; // 叶子为元素个数，内部节点为分隔键个数（孩子数为 count + 1）
+      bool is_leaf;
+    };
+    struct leaf_node : node_base
+    {
+      leaf_node *prev_leaf;
+      leaf_node *next_leaf;
+      // 多留一个槽位：先插入再分裂
+      alignas(btree_value_type) unsigned char value_storage[(leaf_capacity + 1) * sizeof(btree_value_type)];
+      btree_value_type *values() noexcept
+      {
+        return reinterpret_cast<btree_value_type *>(value_storage);
+      }
+    };
+    struct inner_node : node_base
+    {
+      alignas(btree_key_type) unsigned char key_storage[(inner_capacity + 1) * sizeof(btree_key_type)];
+      node_base *children[inner_capacity + 2];
+      btree_key_type *keys() noexcept
+      {
+        return reinterpret_cast<btree_key_type *>(key_storage);
+      }
+    };
+    struct path_entry
+    {
+      inner_node *node;
+      uint64_t child_index;
+    };
+    node_base *_root;
+    leaf_node *first_leaf;
+    leaf_node *last_leaf;
+    uint64_t _size;
+    [[no_unique_address]] key_extractor element;
+    mutable comparators function_policy; // 比较器的 operator() 不一定是 const
+    template <typename element_type, typename source_type>
+    static void array_insert(element_type *element_array, const uint64_t &element_count, const uint64_t &insert_position, source_type &&source_data)
+    {
+      // 在 [0, element_count) 的 insert_position 处插入，element_count 处必须是未构造的槽位
+      if constexpr (std::is_trivially_copyable_v<element_type>)
+      {
+        element_type new_element(std::forward<source_type>(source_data));
+        std::memmove(static_cast<void *>(element_array + insert_position + 1), static_cast<const void *>(element_array + insert_position),
+                     (element_count - insert_position) * sizeof(element_type));
+        ::new (static_cast<void *>(element_array + insert_position)) element_type(std::move(new_element));
+      }
+      else
+      {
+        if (insert_position == element_count)
+        {
+          ::new (static_cast<void *>(element_array + element_count)) element_type(std::forward<source_type>(source_data));
+          return;
+        }
+        // 参数可能引用数组里的元素，先构造出来再挪位置
+        element_type new_element(std::forward<source_type>(source_data));
+        ::new (static_cast<void *>(element_array + element_count)) element_type(std::move(element_array[element_count - 1]));
+        for (uint64_t shift_position = element_count - 1; shift_position > insert_position; --shift_position)
+        {
+          element_array[shift_position] = std::move(element_array[shift_position - 1]);
+        }
+        element_array[insert_position] = std::move(new_element);
+      }
+    }
+    template <typename element_type>
+    static void array_erase(element_type *element_array, const uint64_t &element_count, const uint64_t &erase_position) noexcept
+    {
+      if constexpr (std::is_trivially_copyable_v<element_type>)
+      {
+        std::memmove(static_cast<void *>(element_array + erase_position), static_cast<const void *>(element_array + erase_position + 1),
+                     (element_count - erase_position - 1) * sizeof(element_type));
+      }
+      else
+      {
+        for (uint64_t shift_position = erase_position; shift_position + 1 < element_count; ++shift_position)
+        {
+          element_array[shift_position] = std::move(element_array[shift_position + 1]);
+        }
+        element_array[element_count - 1].~element_type();
+      }
+    }
+    template <typename element_type>
+    static void array_transfer(element_type *source_array, const uint64_t &element_count, element_type *destination_array) noexcept
+    {
+      // 把 element_count 个元素搬到未构造的目标位置，源位置随后析构
+      if constexpr (std::is_trivially_copyable_v<element_type>)
+      {
+        std::memcpy(static_cast<void *>(destination_array), static_cast<const void *>(source_array), element_count * sizeof(element_type));
+      }
+      else
+      {
+        for (uint64_t transfer_position = 0; transfer_position < element_count; ++transfer_position)
+        {
+          ::new (static_cast<void *>(destination_array + transfer_position)) element_type(std::move(source_array[transfer_position]));
+          source_array[transfer_position].~element_type();
+        }
+      }
+    }
+    template <typename element_type>
+    static void array_destroy(element_type *element_array, const uint64_t &element_count) noexcept
+    {
+      if constexpr (!std::is_trivially_destructible_v<element_type>)
+      {
+        for (uint64_t destroy_position = 0; destroy_position < element_count; ++destroy_position)
+        {
+          element_array[destroy_position].~element_type();
+        }
+      }
+    }
+    static void children_insert(inner_node *parent_node, const uint64_t &insert_position, node_base *child_node) noexcept
+    {
+      // 调用时 parent_node->count 还未加一，孩子数为 count + 1
+      std::memmove(static_cast<void *>(parent_node->children + insert_position + 1), static_cast<const void *>(parent_node->children + insert_position),
+                   (parent_node->count + 1 - insert_position) * sizeof(node_base *));
+      parent_node->children[insert_position] = child_node;
+    }
+    static void children_erase(inner_node *parent_node, const uint64_t &erase_position) noexcept
+    {
+      std::memmove(static_cast<void *>(parent_node->children + erase_position), static_cast<const void *>(parent_node->children + erase_position + 1),
+                   (parent_node->count - erase_position) * sizeof(node_base *));
+    }
+    [[nodiscard]] bool key_less(const btree_key_type &left_key, const btree_key_type &right_key) const
+    {
+      return function_policy(left_key, right_key);
+    }
+    [[nodiscard]] uint64_t leaf_lower_bound(leaf_node *leaf_data, const btree_key_type &key_data) const
+    {
+      uint64_t low_position = 0;
+      uint64_t search_length = leaf_data->count;
+      btree_value_type *value_array = leaf_data->values();
+      while (search_length > 0)
+      {
+        const uint64_t half_length = search_length / 2;
+        if (key_less(element(value_array[low_position + half_length]), key_data))
+        {
+          low_position += half_length + 1;
+          search_length -= half_length + 1;
+        }
+        else
+        {
+          search_length = half_length;
+        }
+      }
+      return low_position;
+    }
+    [[nodiscard]] uint64_t leaf_upper_bound(leaf_node *leaf_data, const btree_key_type &key_data) const
+    {
+      uint64_t low_position = 0;
+      uint64_t search_length = leaf_data->count;
+      btree_value_type *value_array = leaf_data->values();
+      while (search_length > 0)
+      {
+        const uint64_t half_length = search_length / 2;
+        if (!key_less(key_data, element(value_array[low_position + half_length])))
+        {
+          low_position += half_length + 1;
+          search_length -= half_length + 1;
+        }
+        else
+        {
+          search_length = half_length;
+        }
+      }
+      return low_position;
+    }
+    [[nodiscard]] uint64_t inner_child_index(inner_node *inner_data, const btree_key_type &key_data) const
+    {
+      // 分隔键中不大于 key_data 的个数，即应该进入的孩子下标
+      uint64_t low_position = 0;
+      uint64_t search_length = inner_data->count;
+      btree_key_type *key_array = inner_data->keys();
+      while (search_length > 0)
+      {
+        const uint64_t half_length = search_length / 2;
+        if (!key_less(key_data, key_array[low_position + half_length]))
+        {
+          low_position += half_length + 1;
+          search_length -= half_length + 1;
+        }
+        else
+        {
+          search_length = half_length;
+        }
+      }
+      return low_position;
+    }
+    leaf_node *descend(const btree_key_type &key_data, path_entry *path_data, uint64_t &path_depth) const
+    {
+      node_base *current_node = _root;
+      path_depth = 0;
+      while (!current_node->is_leaf)
+      {
+        inner_node *inner_data = static_cast<inner_node *>(current_node);
+        const uint64_t child_index = inner_child_index(inner_data, key_data);
+        if (path_data != nullptr)
+        {
+          path_data[path_depth] = path_entry{inner_data, child_index};
+        }
+        ++path_depth;
+        current_node = inner_data->children[child_index];
+      }
+      return static_cast<leaf_node *>(current_node);
+    }
+    static leaf_node *create_leaf()
+    {
+      leaf_node *new_leaf = new leaf_node;
+      new_leaf->count = 0;
+      new_leaf->is_leaf = true;
+      new_leaf->prev_leaf = new_leaf->next_leaf = nullptr;
+      return new_leaf;
+    }
+    static inner_node *create_inner()
+    {
+      inner_node *new_inner = new inner_node;
+      new_inner->count = 0;
+      new_inner->is_leaf = false;
+      return new_inner;
+    }
+    static void destroy_node(node_base *node_data) noexcept
+    {
+      if (node_data->is_leaf)
+      {
+        leaf_node *leaf_data = static_cast<leaf_node *>(node_data);
+        array_destroy(leaf_data->values(), leaf_data->count);
+        delete leaf_data;
+      }
+      else
+      {
+        inner_node *inner_data = static_cast<inner_node *>(node_data);
+        for (uint64_t child_traversal = 0; child_traversal <= inner_data->count; ++child_traversal)
+        {
+          destroy_node(inner_data->children[child_traversal]);
+        }
+        array_destroy(inner_data->keys(), inner_data->count);
+        delete inner_data;
+      }
+    }
+    void merge_leaves(leaf_node *left_leaf, leaf_node *right_leaf, inner_node *parent_node, const uint64_t &separator_index) noexcept
+    {
+      array_transfer(right_leaf->values(), right_leaf->count, left_leaf->values() + left_leaf->count);
+      left_leaf->count += right_leaf->count;
+      left_leaf->next_leaf = right_leaf->next_leaf;
+      if (left_leaf->next_leaf != nullptr)
+      {
+        left_leaf->next_leaf->prev_leaf = left_leaf;
+      }
+      else
+      {
+        last_leaf = left_leaf;
+      }
+      array_erase(parent_node->keys(), parent_node->count, separator_index);
+      children_erase(parent_node, separator_index + 1);
+      --parent_node->count;
+      delete right_leaf;
+    }
+    void merge_inners(inner_node *left_inner, inner_node *right_inner, inner_node *parent_node, const uint64_t &separator_index) noexcept
+    {
+      // 父节点的分隔键降下来放在两段中间
+      ::new (static_cast<void *>(left_inner->keys() + left_inner->count)) btree_key_type(std::move(parent_node->keys()[separator_index]));
+      array_transfer(right_inner->keys(), right_inner->count, left_inner->keys() + left_inner->count + 1);
+      std::memcpy(static_cast<void *>(left_inner->children + left_inner->count + 1), static_cast<const void *>(right_inner->children),
+                  (right_inner->count + 1) * sizeof(node_base *));
+      left_inner->count += right_inner->count + 1;
+      array_erase(parent_node->keys(), parent_node->count, separator_index);
+      children_erase(parent_node, separator_index + 1);
+      --parent_node->count;
+      delete right_inner;
+    }
+    void rebalance_leaf(leaf_node *leaf_data, const path_entry &parent_entry)
+    {
+      inner_node *parent_node = parent_entry.node;
+      const uint64_t child_index = parent_entry.child_index;
+      leaf_node *left_leaf = child_index > 0 ? static_cast<leaf_node *>(parent_node->children[child_index - 1]) : nullptr;
+      leaf_node *right_leaf = child_index < parent_node->count ? static_cast<leaf_node *>(parent_node->children[child_index + 1]) : nullptr;
+      if (left_leaf != nullptr && left_leaf->count > leaf_minimum)
+      {
+        // 向左兄弟借最后一个元素
+        array_insert(leaf_data->values(), leaf_data->count, 0, std::move(left_leaf->values()[left_leaf->count - 1]));
+        left_leaf->values()[left_leaf->count - 1].~btree_value_type();
+        --left_leaf->count;
+        ++leaf_data->count;
+        parent_node->keys()[child_index - 1] = element(leaf_data->values()[0]);
+      }
+      else if (right_leaf != nullptr && right_leaf->count > leaf_minimum)
+      {
+        // 向右兄弟借第一个元素
+        ::new (static_cast<void *>(leaf_data->values() + leaf_data->count)) btree_value_type(std::move(right_leaf->values()[0]));
+        ++leaf_data->count;
+        array_erase(right_leaf->values(), right_leaf->count, 0);
+        --right_leaf->count;
+        parent_node->keys()[child_index] = element(right_leaf->values()[0]);
+      }
+      else if (left_leaf != nullptr)
+      {
+        merge_leaves(left_leaf, leaf_data, parent_node, child_index - 1);
+      }
+      else
+      {
+        merge_leaves(leaf_data, right_leaf, parent_node, child_index);
+      }
+    }
+    void rebalance_inner(inner_node *inner_data, const path_entry &parent_entry)
+    {
+      inner_node *parent_node = parent_entry.node;
+      const uint64_t child_index = parent_entry.child_index;
+      inner_node *left_inner = child_index > 0 ? static_cast<inner_node *>(parent_node->children[child_index - 1]) : nullptr;
+      inner_node *right_inner = child_index < parent_node->count ? static_cast<inner_node *>(parent_node->children[child_index + 1]) : nullptr;
+      if (left_inner != nullptr && left_inner->count > inner_minimum)
+      {
+        // 经父节点向右旋转：父分隔键降到本节点最前，左兄弟最后一个键升到父节点
+        array_insert(inner_data->keys(), inner_data->count, 0, std::move(parent_node->keys()[child_index - 1]));
+        children_insert(inner_data, 0, left_inner->children[left_inner->count]);
+        ++inner_data->count;
+        parent_node->keys()[child_index - 1] = std::move(left_inner->keys()[left_inner->count - 1]);
+        left_inner->keys()[left_inner->count - 1].~btree_key_type();
+        --left_inner->count;
+      }
+      else if (right_inner != nullptr && right_inner->count > inner_minimum)
+      {
+        ::new (static_cast<void *>(inner_data->keys() + inner_data->count)) btree_key_type(std::move(parent_node->keys()[child_index]));
+        inner_data->children[inner_data->count + 1] = right_inner->children[0];
+        ++inner_data->count;
+        parent_node->keys()[child_index] = std::move(right_inner->keys()[0]);
+        array_erase(right_inner->keys(), right_inner->count, 0);
+        children_erase(right_inner, 0);
+        --right_inner->count;
+      }
+      else if (left_inner != nullptr)
+      {
+        merge_inners(left_inner, inner_data, parent_node, child_index - 1);
+      }
+      else
+      {
+        merge_inners(inner_data, right_inner, parent_node, child_index);
+      }
+    }
+    template <typename btree_iterator_value>
+    class btree_iterator
+    {
+      friend class b_plus_tree;
+      template <typename>
+      friend class btree_iterator;
+      leaf_node *current_leaf;
+      uint64_t slot_index;
+      btree_iterator(leaf_node *leaf_data, const uint64_t index_data) noexcept : current_leaf(leaf_data), slot_index(index_data) { ; }
+
+    public:
+      using iterator_category = std::bidirectional_iterator_tag;
+      using value_type = btree_value_type;
+      using difference_type = std::ptrdiff_t;
+      using pointer = btree_iterator_value *;
+      using reference = btree_iterator_value &;
+      btree_iterator() noexcept : current_leaf(nullptr), slot_index(0) { ; }
+      template <typename other_value_type, typename = std::enable_if_t<std::is_const_v<btree_iterator_value> && !std::is_const_v<other_value_type>>>
+      btree_iterator(const btree_iterator<other_value_type> &iterator_data) noexcept
+          : current_leaf(iterator_data.current_leaf), slot_index(iterator_data.slot_index) { ; }
+      reference operator*() const noexcept
+      {
+        return current_leaf->values()[slot_index];
+      }
+      pointer operator->() const noexcept
+      {
+        return current_leaf->values() + slot_index;
+      }
+      btree_iterator &operator++() noexcept
+      {
+        // 走到叶子末尾时跳到下一片叶子；最后一片叶子的末尾就是 end()
+        ++slot_index;
+        if (slot_index == current_leaf->count && current_leaf->next_leaf != nullptr)
+        {
+          current_leaf = current_leaf->next_leaf;
+          slot_index = 0;
+        }
+        return *this;
+      }
+      btree_iterator operator++(int) noexcept
+      {
+        btree_iterator temporary_iterator(*this);
+        ++*this;
+        return temporary_iterator;
+      }
+      btree_iterator &operator--() noexcept
+      {
+        if (slot_index == 0)
+        {
+          current_leaf = current_leaf->prev_leaf;
+          slot_index = current_leaf->count;
+        }
+        --slot_index;
+        return *this;
+      }
+      btree_iterator operator--(int) noexcept
+      {
+        btree_iterator temporary_iterator(*this);
+        --*this;
+        return temporary_iterator;
+      }
+      bool operator==(const btree_iterator &iterator_data) const noexcept
+      {
+        return current_leaf == iterator_data.current_leaf && slot_index == iterator_data.slot_index;
+      }
+      bool operator!=(const btree_iterator &iterator_data) const noexcept
+      {
+        return !(*this == iterator_data);
+      }
+    };
+    template <typename btree_iterator_value>
+    static btree_iterator<btree_iterator_value> normalized_iterator(leaf_node *leaf_data, const uint64_t &slot_index) noexcept
+    {
+      if (slot_index == leaf_data->count && leaf_data->next_leaf != nullptr)
+      {
+        return btree_iterator<btree_iterator_value>(leaf_data->next_leaf, 0);
+      }
+      return btree_iterator<btree_iterator_value>(leaf_data, slot_index);
+    }
+    template <typename btree_iterator_value>
+    btree_iterator<btree_iterator_value> lower_bound_iterator(const btree_key_type &key_data) const
+    {
+      if (_root == nullptr)
+      {
+        return btree_iterator<btree_iterator_value>();
+      }
+      uint64_t path_depth = 0;
+      leaf_node *leaf_data = descend(key_data, nullptr, path_depth);
+      return normalized_iterator<btree_iterator_value>(leaf_data, leaf_lower_bound(leaf_data, key_data));
+    }
+    template <typename btree_iterator_value>
+    btree_iterator<btree_iterator_value> upper_bound_iterator(const btree_key_type &key_data) const
+    {
+      if (_root == nullptr)
+      {
+        return btree_iterator<btree_iterator_value>();
+      }
+      uint64_t path_depth = 0;
+      leaf_node *leaf_data = descend(key_data, nullptr, path_depth);
+      return normalized_iterator<btree_iterator_value>(leaf_data, leaf_upper_bound(leaf_data, key_data));
+    }
+    template <typename btree_iterator_value>
+    btree_iterator<btree_iterator_value> find_iterator(const btree_key_type &key_data) const
+    {
+      if (_root == nullptr)
+      {
+        return btree_iterator<btree_iterator_value>();
+      }
+      uint64_t path_depth = 0;
+      leaf_node *leaf_data = descend(key_data, nullptr, path_depth);
+      const uint64_t slot_index = leaf_lower_bound(leaf_data, key_data);
+      if (slot_index < leaf_data->count && !key_less(key_data, element(leaf_data->values()[slot_index])))
+      {
+        return btree_iterator<btree_iterator_value>(leaf_data, slot_index);
+      }
+      return btree_iterator<btree_iterator_value>(last_leaf, last_leaf->count);
+    }
+
+  public:
+    using iterator = btree_iterator<btree_value_type>;
+    using const_iterator = btree_iterator<const btree_value_type>;
+    using return_pair_value = standard_con::pair<iterator, bool>;
+    b_plus_tree() noexcept
+        : _root(nullptr), first_leaf(nullptr), last_leaf(nullptr), _size(0), element(), function_policy() { ; }
+    b_plus_tree(const b_plus_tree &b_plus_tree_data)
+        : b_plus_tree()
+    {
+      // 委托构造已完成，中途抛异常时析构函数会回收已插入的部分；按序插入走最右叶子的追加路径
+      function_policy = b_plus_tree_data.function_policy;
+      for (const_iterator copy_iterator = b_plus_tree_data.cbegin(); copy_iterator != b_plus_tree_data.cend(); ++copy_iterator)
+      {
+        insert(*copy_iterator);
+      }
+    }
+    b_plus_tree(b_plus_tree &&b_plus_tree_data) noexcept
+        : _root(b_plus_tree_data._root), first_leaf(b_plus_tree_data.first_leaf), last_leaf(b_plus_tree_data.last_leaf),
+          _size(b_plus_tree_data._size), element(), function_policy(std::move(b_plus_tree_data.function_policy))
+    {
+      b_plus_tree_data._root = nullptr;
+      b_plus_tree_data.first_leaf = b_plus_tree_data.last_leaf = nullptr;
+      b_plus_tree_data._size = 0;
+    }
+    ~b_plus_tree() noexcept
+    {
+      clear();
+    }
+    b_plus_tree &operator=(const b_plus_tree &b_plus_tree_data)
+    {
+      if (this != &b_plus_tree_data)
+      {
+        b_plus_tree temporary_tree(b_plus_tree_data);
+        swap(temporary_tree);
+      }
+      return *this;
+    }
+    b_plus_tree &operator=(b_plus_tree &&b_plus_tree_data) noexcept
+    {
+      if (this != &b_plus_tree_data)
+      {
+        b_plus_tree temporary_tree(std::move(b_plus_tree_data));
+        swap(temporary_tree);
+      }
+      return *this;
+    }
+    void swap(b_plus_tree &b_plus_tree_data) noexcept
+    {
+      standard_con::algorithm::swap(_root, b_plus_tree_data._root);
+      standard_con::algorithm::swap(first_leaf, b_plus_tree_data.first_leaf);
+      standard_con::algorithm::swap(last_leaf, b_plus_tree_data.last_leaf);
+      standard_con::algorithm::swap(_size, b_plus_tree_data._size);
+      standard_con::algorithm::swap(function_policy, b_plus_tree_data.function_policy);
+    }
+    void clear() noexcept
+    {
+      if (_root != nullptr)
+      {
+        destroy_node(_root);
+      }
+      _root = nullptr;
+      first_leaf = last_leaf = nullptr;
+      _size = 0;
+    }
+    [[nodiscard]] uint64_t size() const noexcept
+    {
+      return _size;
+    }
+    [[nodiscard]] bool empty() const noexcept
+    {
+      return _size == 0;
+    }
+    [[nodiscard]] iterator begin() noexcept
+    {
+      return iterator(first_leaf, 0);
+    }
+    [[nodiscard]] iterator end() noexcept
+    {
+      return last_leaf == nullptr ? iterator() : iterator(last_leaf, last_leaf->count);
+    }
+    [[nodiscard]] const_iterator begin() const noexcept
+    {
+      return const_iterator(first_leaf, 0);
+    }
+    [[nodiscard]] const_iterator end() const noexcept
+    {
+      return last_leaf == nullptr ? const_iterator() : const_iterator(last_leaf, last_leaf->count);
+    }
+    [[nodiscard]] const_iterator cbegin() const noexcept
+    {
+      return begin();
+    }
+    [[nodiscard]] const_iterator cend() const noexcept
+    {
+      return end();
+    }
+    template <typename insert_value_type>
+    return_pair_value insert(insert_value_type &&value_data)
+    {
+      if (_root == nullptr)
+      {
+        leaf_node *root_leaf = create_leaf();
+        try
+        {
+          ::new (static_cast<void *>(root_leaf->values())) btree_value_type(std::forward<insert_value_type>(value_data));
+        }
+        catch (...)
+        {
+          delete root_leaf;
+          throw;
+        }
+        root_leaf->count = 1;
+        _root = first_leaf = last_leaf = root_leaf;
+        _size = 1;
+        return return_pair_value(iterator(root_leaf, 0), true);
+      }
+      path_entry path_data[maximum_depth];
+      uint64_t path_depth = 0;
+      leaf_node *leaf_data = descend(element(value_data), path_data, path_depth);
+      const uint64_t insert_position = leaf_lower_bound(leaf_data, element(value_data));
+      if (insert_position < leaf_data->count && !key_less(element(value_data), element(leaf_data->values()[insert_position])))
+      {
+        return return_pair_value(iterator(leaf_data, insert_position), false);
+      }
+      // 叶子已满时，沿路径往上连续满载的内部节点都会分裂，新节点先全部申请好
+      leaf_node *spare_leaf = nullptr;
+      inner_node *spare_inners[maximum_depth + 1];
+      uint64_t spare_inner_count = 0;
+      if (leaf_data->count == leaf_capacity)
+      {
+        uint64_t full_level = path_depth;
+        while (full_level > 0 && path_data[full_level - 1].node->count == inner_capacity)
+        {
+          --full_level;
+        }
+        const uint64_t inner_needed = path_depth - full_level + (full_level == 0 ? 1 : 0);
+        try
+        {
+          spare_leaf = create_leaf();
+          for (; spare_inner_count < inner_needed; ++spare_inner_count)
+          {
+            spare_inners[spare_inner_count] = create_inner();
+          }
+        }
+        catch (...)
+        {
+          delete spare_leaf;
+          for (uint64_t release_traversal = 0; release_traversal < spare_inner_count; ++release_traversal)
+          {
+            delete spare_inners[release_traversal];
+          }
+          throw;
+        }
+      }
+      try
+      {
+        array_insert(leaf_data->values(), leaf_data->count, insert_position, std::forward<insert_value_type>(value_data));
+      }
+      catch (...)
+      {
+        delete spare_leaf;
+        for (uint64_t release_traversal = 0; release_traversal < spare_inner_count; ++release_traversal)
+        {
+          delete spare_inners[release_traversal];
+        }
+        throw;
+      }
+      ++leaf_data->count;
+      ++_size;
+      if (leaf_data->count <= leaf_capacity)
+      {
+        return return_pair_value(iterator(leaf_data, insert_position), true);
+      }
+      // 叶子分裂：在最右叶子末尾追加时左边保持满载，否则对半分
+      const uint64_t total_count = leaf_data->count;
+      const uint64_t keep_count = (leaf_data->next_leaf == nullptr && insert_position == total_count - 1) ? leaf_capacity : total_count / 2;
+      leaf_node *right_leaf = spare_leaf;
+      array_transfer(leaf_data->values() + keep_count, total_count - keep_count, right_leaf->values());
+      right_leaf->count = total_count - keep_count;
+      leaf_data->count = keep_count;
+      right_leaf->next_leaf = leaf_data->next_leaf;
+      right_leaf->prev_leaf = leaf_data;
+      if (right_leaf->next_leaf != nullptr)
+      {
+        right_leaf->next_leaf->prev_leaf = right_leaf;
+      }
+      else
+      {
+        last_leaf = right_leaf;
+      }
+      leaf_data->next_leaf = right_leaf;
+      iterator result_iterator = insert_position < keep_count ? iterator(leaf_data, insert_position) : iterator(right_leaf, insert_position - keep_count);
+      // 分隔键和新节点逐层往上送
+      btree_key_type separator_key(element(right_leaf->values()[0]));
+      node_base *new_child = right_leaf;
+      uint64_t current_level = path_depth;
+      uint64_t spare_inner_used = 0;
+      while (true)
+      {
+        if (current_level == 0)
+        {
+          inner_node *new_root = spare_inners[spare_inner_used++];
+          ::new (static_cast<void *>(new_root->keys())) btree_key_type(std::move(separator_key));
+          new_root->children[0] = _root;
+          new_root->children[1] = new_child;
+          new_root->count = 1;
+          _root = new_root;
+          break;
+        }
+        inner_node *parent_node = path_data[current_level - 1].node;
+        const uint64_t child_index = path_data[current_level - 1].child_index;
+        array_insert(parent_node->keys(), parent_node->count, child_index, std::move(separator_key));
+        children_insert(parent_node, child_index + 1, new_child);
+        ++parent_node->count;
+        if (parent_node->count <= inner_capacity)
+        {
+          break;
+        }
+        // 内部节点分裂：中间的键上移，右半的键和孩子交给新节点
+        inner_node *right_inner = spare_inners[spare_inner_used++];
+        const uint64_t key_count = parent_node->count;
+        const uint64_t middle_index = key_count / 2;
+        separator_key = std::move(parent_node->keys()[middle_index]);
+        array_transfer(parent_node->keys() + middle_index + 1, key_count - middle_index - 1, right_inner->keys());
+        parent_node->keys()[middle_index].~btree_key_type();
+        std::memcpy(static_cast<void *>(right_inner->children), static_cast<const void *>(parent_node->children + middle_index + 1),
+                    (key_count - middle_index) * sizeof(node_base *));
+        right_inner->count = key_count - middle_index - 1;
+        parent_node->count = middle_index;
+        new_child = right_inner;
+        --current_level;
+      }
+      return return_pair_value(result_iterator, true);
+    }
+    bool erase(const btree_key_type &key_data)
+    {
+      if (_root == nullptr)
+      {
+        return false;
+      }
+      path_entry path_data[maximum_depth];
+      uint64_t path_depth = 0;
+      leaf_node *leaf_data = descend(key_data, path_data, path_depth);
+      const uint64_t erase_position = leaf_lower_bound(leaf_data, key_data);
+      if (erase_position == leaf_data->count || key_less(key_data, element(leaf_data->values()[erase_position])))
+      {
+        return false;
+      }
+      array_erase(leaf_data->values(), leaf_data->count, erase_position);
+      --leaf_data->count;
+      --_size;
+      if (path_depth == 0)
+      {
+        if (leaf_data->count == 0)
+        {
+          delete leaf_data;
+          _root = nullptr;
+          first_leaf = last_leaf = nullptr;
+        }
+        return true;
+      }
+      if (leaf_data->count >= leaf_minimum)
+      {
+        return true;
+      }
+      rebalance_leaf(leaf_data, path_data[path_depth - 1]);
+      for (uint64_t current_level = path_depth - 1; current_level > 0 && path_data[current_level].node->count < inner_minimum; --current_level)
+      {
+        rebalance_inner(path_data[current_level].node, path_data[current_level - 1]);
+      }
+      if (!_root->is_leaf && _root->count == 0)
+      {
+        // 根只剩一个孩子时树高减一
+        inner_node *old_root = static_cast<inner_node *>(_root);
+        _root = old_root->children[0];
+        delete old_root;
+      }
+      return true;
+    }
+    [[nodiscard]] iterator find(const btree_key_type &key_data)
+    {
+      return find_iterator<btree_value_type>(key_data);
+    }
+    [[nodiscard]] const_iterator find(const btree_key_type &key_data) const
+    {
+      return find_iterator<const btree_value_type>(key_data);
+    }
+    [[nodiscard]] bool contains(const btree_key_type &key_data) const
+    {
+      return find(key_data) != end();
+    }
+    [[nodiscard]] uint64_t count(const btree_key_type &key_data) const
+    {
+      return contains(key_data) ? 1 : 0;
+    }
+    [[nodiscard]] iterator lower_bound(const btree_key_type &key_data)
+    {
+      return lower_bound_iterator<btree_value_type>(key_data);
+    }
+    [[nodiscard]] const_iterator lower_bound(const btree_key_type &key_data) const
+    {
+      return lower_bound_iterator<const btree_value_type>(key_data);
+    }
+    [[nodiscard]] iterator upper_bound(const btree_key_type &key_data)
+    {
+      return upper_bound_iterator<btree_value_type>(key_data);
+    }
+    [[nodiscard]] const_iterator upper_bound(const btree_key_type &key_data) const
+    {
+      return upper_bound_iterator<const btree_value_type>(key_data);
+    }
+    [[nodiscard]] standard_con::pair<iterator, iterator> equal_range(const btree_key_type &key_data)
+    {
+      return standard_con::pair<iterator, iterator>(lower_bound(key_data), upper_bound(key_data));
+    }
+    [[nodiscard]] standard_con::pair<const_iterator, const_iterator> equal_range(const btree_key_type &key_data) const
+    {
+      return standard_con::pair<const_iterator, const_iterator>(lower_bound(key_data), upper_bound(key_data));
+    }
+  };
+  /*
+   * @brief  #### `btree_map` 类模板
+
+      *   - 基于 `b_plus_tree` 的有序键值对映射，接口与 `tree_map` 相近，查找、删除、区间查找直接按键进行
+
+      *   - 适合大量键的顺序遍历和区间扫描，节点宽、叶子相连，比逐节点分配的红黑树少得多的缓存未命中
+
+      * 主要操作方法:
+
+      * * - `push()`: 插入键值对，键已存在时不覆盖，返回 `pair<iterator, bool>`
+      *
+      * * - `operator[]`: 返回键对应的值，键不存在时插入默认值
+      *
+      * * - `pop(key)`: 按键删除，返回是否删除成功
+      *
+      * * - `find()` / `contains()` / `count()` / `lower_bound()` / `upper_bound()` / `equal_range()`: 按键查找
+  */
+  template <typename btree_map_key, typename btree_map_value, typename comparators = standard_con::less<btree_map_key>>
+  class btree_map
+  {
+    using key_val_type = standard_con::pair<btree_map_key, btree_map_value>;
+    struct key_val
+    {
+      const btree_map_key &operator()(const key_val_type &key_value) const noexcept
+      {
+        return key_value.first;
+      }
+    };
+    using instance_btree = b_plus_tree<btree_map_key, key_val_type, key_val, comparators>;
+    instance_btree instance_btree_map;
+
+  public:
+    using iterator = typename instance_btree::iterator;
+    using const_iterator = typename instance_btree::const_iterator;
+    using map_iterator = standard_con::pair<iterator, bool>;
+    btree_map() { ; }
+    btree_map(std::initializer_list<key_val_type> lightweight_container)
+    {
+      for (auto &chained_values : lightweight_container)
+      {
+        instance_btree_map.insert(chained_values);
+      }
+    }
+    map_iterator push(const key_val_type &btree_map_data) { return instance_btree_map.insert(btree_map_data); }
+
+    map_iterator push(key_val_type &&btree_map_data) { return instance_btree_map.insert(std::move(btree_map_data)); }
+
+    bool pop(const btree_map_key &key_data) { return instance_btree_map.erase(key_data); }
+
+    btree_map_value &operator[](const btree_map_key &key_data)
+    {
+      iterator find_iterator = instance_btree_map.find(key_data);
+      if (find_iterator != instance_btree_map.end())
+      {
+        return find_iterator->second;
+      }
+      return instance_btree_map.insert(key_val_type(key_data, btree_map_value())).first->second;
+    }
+
+    iterator find(const btree_map_key &key_data) { return instance_btree_map.find(key_data); }
+
+    const_iterator find(const btree_map_key &key_data) const { return instance_btree_map.find(key_data); }
+
+    [[nodiscard]] bool contains(const btree_map_key &key_data) const { return instance_btree_map.contains(key_data); }
+
+    [[nodiscard]] uint64_t count(const btree_map_key &key_data) const { return instance_btree_map.count(key_data); }
+
+    iterator lower_bound(const btree_map_key &key_data) { return instance_btree_map.lower_bound(key_data); }
+
+    const_iterator lower_bound(const btree_map_key &key_data) const { return instance_btree_map.lower_bound(key_data); }
+
+    iterator upper_bound(const btree_map_key &key_data) { return instance_btree_map.upper_bound(key_data); }
+
+    const_iterator upper_bound(const btree_map_key &key_data) const { return instance_btree_map.upper_bound(key_data); }
+
+    standard_con::pair<iterator, iterator> equal_range(const btree_map_key &key_data) { return instance_btree_map.equal_range(key_data); }
+
+    standard_con::pair<const_iterator, const_iterator> equal_range(const btree_map_key &key_data) const { return instance_btree_map.equal_range(key_data); }
+
+    [[nodiscard]] uint64_t size() const noexcept { return instance_btree_map.size(); }
+
+    [[nodiscard]] bool empty() const noexcept { return instance_btree_map.empty(); }
+
+    void clear() noexcept { instance_btree_map.clear(); }
+
+    void swap(btree_map &btree_map_data) noexcept { instance_btree_map.swap(btree_map_data.instance_btree_map); }
+
+    iterator begin() noexcept { return instance_btree_map.begin(); }
+
+    iterator end() noexcept { return instance_btree_map.end(); }
+
+    const_iterator begin() const noexcept { return instance_btree_map.begin(); }
+
+    const_iterator end() const noexcept { return instance_btree_map.end(); }
+
+    const_iterator cbegin() const noexcept { return instance_btree_map.cbegin(); }
+
+    const_iterator cend() const noexcept { return instance_btree_map.cend(); }
+  };
+  /*
+   * @brief  #### `btree_set` 类模板
+
+      *   - 基于 `b_plus_tree` 的有序集合，接口与 `tree_set` 相近，迭代器只读
+  */
+  template <typename btree_set_type, typename comparators = standard_con::less<btree_set_type>>
+  class btree_set
+  {
+    struct key_val
+    {
+      const btree_set_type &operator()(const btree_set_type &key_value) const noexcept
+      {
+        return key_value;
+      }
+    };
+    using instance_btree = b_plus_tree<btree_set_type, btree_set_type, key_val, comparators>;
+    instance_btree instance_btree_set;
+
+  public:
+    using iterator = typename instance_btree::const_iterator;
+    using const_iterator = typename instance_btree::const_iterator;
+    using set_iterator = standard_con::pair<iterator, bool>;
+    btree_set() { ; }
+    btree_set(std::initializer_list<btree_set_type> lightweight_container)
+    {
+      for (auto &chained_values : lightweight_container)
+      {
+        instance_btree_set.insert(chained_values);
+      }
+    }
+    set_iterator push(const btree_set_type &btree_set_data)
+    {
+      auto insert_result = instance_btree_set.insert(btree_set_data);
+      return set_iterator(insert_result.first, insert_result.second);
+    }
+
+    set_iterator push(btree_set_type &&btree_set_data)
+    {
+      auto insert_result = instance_btree_set.insert(std::move(btree_set_data));
+      return set_iterator(insert_result.first, insert_result.second);
+    }
+
+    bool pop(const btree_set_type &key_data) { return instance_btree_set.erase(key_data); }
+
+    const_iterator find(const btree_set_type &key_data) const { return instance_btree_set.find(key_data); }
+
+    [[nodiscard]] bool contains(const btree_set_type &key_data) const { return instance_btree_set.contains(key_data); }
+
+    [[nodiscard]] uint64_t count(const btree_set_type &key_data) const { return instance_btree_set.count(key_data); }
+
+    const_iterator lower_bound(const btree_set_type &key_data) const { return instance_btree_set.lower_bound(key_data); }
+
+    const_iterator upper_bound(const btree_set_type &key_data) const { return instance_btree_set.upper_bound(key_data); }
+
+    standard_con::pair<const_iterator, const_iterator> equal_range(const btree_set_type &key_data) const { return instance_btree_set.equal_range(key_data); }
+
+    [[nodiscard]] uint64_t size() const noexcept { return instance_btree_set.size(); }
+
+    [[nodiscard]] bool empty() const noexcept { return instance_btree_set.empty(); }
+
+    void clear() noexcept { instance_btree_set.clear(); }
+
+    void swap(btree_set &btree_set_data) noexcept { instance_btree_set.swap(btree_set_data.instance_btree_set); }
+
+    const_iterator begin() const noexcept { return instance_btree_set.begin(); }
+
+    const_iterator end() const noexcept { return instance_btree_set.end(); }
+
+    const_iterator cbegin() const noexcept { return instance_btree_set.cbegin(); }
+
+    const_iterator cend() const noexcept { return instance_btree_set.cend(); }
+  };
+}
+namespace standard_con
+{
+  using btree_container::b_plus_tree;
+  using btree_container::btree_map;
+  using btree_container::btree_set;
+}
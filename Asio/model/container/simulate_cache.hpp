@@ -0,0 +1,522 @@
+#pragma once
+#include <cstdint>
+#include <utility>
+#include "simulate_base.hpp"
+namespace cache_container
+{
+  /*
+   * @brief  #### `ignore_eviction` 类
+
+      *   - 缓存的默认淘汰回调，什么都不做，空类不占空间，调用会被内联掉
+  */
+  class ignore_eviction
+  {
+  public:
+    template <typename cache_key, typename cache_value>
+    void operator()(const cache_key &, cache_value &) const noexcept { ; }
+  };
+  /*
+   * @brief  #### `cache_statistics` 类
+
+      *   - 缓存的命中统计，`get` 命中或未命中各计一次，`peek` / `contains` 不计数
+
+      *   - `evictions` 只统计因容量不足被淘汰的元素，`pop` 主动删除的不算
+  */
+  class cache_statistics
+  {
+  public:
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t evictions = 0;
+    [[nodiscard]] double hit_rate() const noexcept
+    {
+      const uint64_t lookup_count = hits + misses;
+      return lookup_count == 0 ? 0.0 : static_cast<double>(hits) / static_cast<double>(lookup_count);
+    }
+  };
+  /*
+   * @brief  #### `lru_cache` 类模板
+
+      *   - 有容量上限的最近最少使用缓存，底层为 `hash_table`，直接把它按插入顺序维护的全局双向链表当作淘汰顺序：
+      *     链表头是最久未使用的元素，尾部是最近使用的元素
+
+      *   - 命中时用 `move_to_back` 把元素挪到链表尾，淘汰时删除链表头，`get` / `put` / 淘汰都是 O(1)，不额外维护一条链表
+
+      *   - 容量按 “开销”（`charge`）计算而不是按个数：每个元素插入时给出自己的开销，例如响应体的字节数，默认每个元素计 1
+
+      * 模板参数:
+
+      * * - `cache_key`: 键类型，需要能被 `hash_function` 哈希并支持 `==`
+      *
+      * * - `cache_value`: 值类型
+      *
+      * * - `hash_function`: 键的哈希函数，默认为 `standard_con::hash_imitation_functions`
+      *
+      * * - `eviction_callback`: 淘汰回调，以 `(const cache_key&, cache_value&)` 调用，默认为不做任何事的 `ignore_eviction`；
+      *     需要运行时替换时可以用 `std::function<void(const cache_key&, cache_value&)>`
+
+      * 主要操作方法:
+
+      * * - `get(key)`: 返回值的指针并把元素标记为最近使用，未命中返回 `nullptr`
+      *
+      * * - `peek(key)`: 同 `get`，但不改变淘汰顺序，也不计入命中统计
+      *
+      * * - `put(key, value, charge)`: 插入或覆盖，空间不足时先从最久未使用的元素开始淘汰；
+      *     `charge` 超过总容量时不插入并返回 `false`
+      *
+      * * - `pop(key)` / `contains(key)` / `clear()` / `size()` / `charge()` / `capacity()`
+      *
+      * * - `change_capacity(new_capacity)`: 调整容量，缩小时立即淘汰多出的元素
+      *
+      * * - `statistics()` / `reset_statistics()`: 命中、未命中、淘汰计数
+
+      * 注意事项:
+
+      * * - 淘汰回调在元素被删除之前调用，回调中可以把值移走，但不能再访问这个缓存
+      *
+      * * - `get` 返回的指针在下一次 `put` / `pop` / `clear` 之前有效（元素被淘汰或删除后失效）
+      *
+      * * - 不是线程安全的，多线程共享时需要外部加锁
+  */
+  template <typename cache_key, typename cache_value, typename hash_function = standard_con::hash_imitation_functions,
+            typename eviction_callback = ignore_eviction>
+  class lru_cache
+  {
+    struct cache_entry
+    {
+      cache_key _key;
+      cache_value _value;
+      uint64_t _charge;
+    };
+    struct key_val
+    {
+      const cache_key &operator()(const cache_entry &entry_data)
+      {
+        return entry_data._key;
+      }
+    };
+    using hash_table = standard_con::hash_table<cache_key, cache_entry, key_val, hash_function>;
+    using iterator = typename hash_table::iterator;
+    hash_table instance_hash_table;
+    uint64_t capacity_limit;
+    uint64_t used_charge = 0;
+    cache_statistics statistics_data;
+    eviction_callback eviction_function;
+
+    void evict_front()
+    {
+      iterator victim_position = instance_hash_table.begin();
+      eviction_function(static_cast<const cache_key &>(victim_position->_key), victim_position->_value);
+      used_charge -= victim_position->_charge;
+      ++statistics_data.evictions;
+      instance_hash_table.erase(victim_position);
+    }
+    void evict_until(const uint64_t charge_limit)
+    {
+      while (used_charge > charge_limit && !instance_hash_table.empty())
+      {
+        evict_front();
+      }
+    }
+
+  public:
+    explicit lru_cache(const uint64_t cache_capacity, eviction_callback callback_function = eviction_callback())
+        : capacity_limit(cache_capacity), eviction_function(std::move(callback_function)) { ; }
+
+    ~lru_cache() = default;
+
+    lru_cache(const lru_cache &) = default;
+
+    lru_cache(lru_cache &&) noexcept = default;
+
+    lru_cache &operator=(const lru_cache &) = default;
+
+    lru_cache &operator=(lru_cache &&) noexcept = default;
+
+    cache_value *get(const cache_key &key_data)
+    {
+      iterator find_position = instance_hash_table[key_data];
+      if (find_position == instance_hash_table.end())
+      {
+        ++statistics_data.misses;
+        return nullptr;
+      }
+      ++statistics_data.hits;
+      instance_hash_table.move_to_back(find_position);
+      return &find_position->_value;
+    }
+    cache_value *peek(const cache_key &key_data)
+    {
+      iterator find_position = instance_hash_table[key_data];
+      return find_position == instance_hash_table.end() ? nullptr : &find_position->_value;
+    }
+    [[nodiscard]] bool contains(const cache_key &key_data) { return instance_hash_table.contains(key_data); }
+
+    bool put(const cache_key &key_data, cache_value value_data, const uint64_t entry_charge = 1)
+    {
+      if (entry_charge > capacity_limit)
+      {
+        return false;
+      }
+      iterator find_position = instance_hash_table[key_data];
+      if (find_position != instance_hash_table.end())
+      {
+        // 覆盖已有元素：先挪到链表尾，淘汰从链表头开始，不会淘汰到它自己
+        used_charge = used_charge - find_position->_charge + entry_charge;
+        find_position->_value = std::move(value_data);
+        find_position->_charge = entry_charge;
+        instance_hash_table.move_to_back(find_position);
+        evict_until(capacity_limit);
+        return true;
+      }
+      evict_until(capacity_limit - entry_charge);
+      instance_hash_table.insert(cache_entry{key_data, std::move(value_data), entry_charge});
+      used_charge += entry_charge;
+      return true;
+    }
+    bool pop(const cache_key &key_data)
+    {
+      iterator find_position = instance_hash_table[key_data];
+      if (find_position == instance_hash_table.end())
+      {
+        return false;
+      }
+      used_charge -= find_position->_charge;
+      instance_hash_table.erase(find_position);
+      return true;
+    }
+    void change_capacity(const uint64_t new_capacity)
+    {
+      capacity_limit = new_capacity;
+      evict_until(capacity_limit);
+    }
+    void clear()
+    {
+      instance_hash_table.clear();
+      used_charge = 0;
+    }
+    [[nodiscard]] uint64_t size() const noexcept { return instance_hash_table.size(); }
+
+    [[nodiscard]] bool empty() const noexcept { return instance_hash_table.size() == 0; }
+
+    [[nodiscard]] uint64_t charge() const noexcept { return used_charge; }
+
+    [[nodiscard]] uint64_t capacity() const noexcept { return capacity_limit; }
+
+    [[nodiscard]] const cache_statistics &statistics() const noexcept { return statistics_data; }
+
+    void reset_statistics() noexcept { statistics_data = cache_statistics(); }
+
+    void swap(lru_cache &lru_cache_data) noexcept
+    {
+      instance_hash_table.swap(lru_cache_data.instance_hash_table);
+      standard_con::algorithm::swap(capacity_limit, lru_cache_data.capacity_limit);
+      standard_con::algorithm::swap(used_charge, lru_cache_data.used_charge);
+      standard_con::algorithm::swap(statistics_data, lru_cache_data.statistics_data);
+      standard_con::algorithm::swap(eviction_function, lru_cache_data.eviction_function);
+    }
+  };
+  /*
+   * @brief  #### `lfu_cache` 类模板
+
+      *   - 有容量上限的最不经常使用缓存，淘汰访问次数最少的元素，次数相同时淘汰其中最久未使用的
+
+      *   - 同样直接使用 `hash_table` 的全局链表，但让链表始终按 (访问次数升序, 最近使用时间升序) 排列，
+      *     淘汰时删除链表头即可；另外维护一条按次数升序的 “频次组” 链表，每组记录次数、元素个数和组内最后一个元素
+
+      *   - 访问时元素从次数为 f 的组挪到 f + 1 组的末尾（组不存在时紧跟在 f 组之后新建），只是一次 `move_after`，
+      *     所以 `get` / `put` / 淘汰都是 O(1)，不需要堆或按次数分桶的多条链表
+
+      *   - 模板参数、容量按开销计算、淘汰回调和统计与 `lru_cache` 相同
+
+      * 主要操作方法:
+
+      * * - `get(key)`: 返回值的指针并把访问次数加一，未命中返回 `nullptr`
+      *
+      * * - `peek(key)` / `put(key, value, charge)` / `pop(key)` / `contains(key)` / `clear()`
+      *
+      * * - `frequency(key)`: 返回元素的访问次数，不存在时返回 0；新插入的元素次数为 1，覆盖已有元素算一次访问
+      *
+      * * - `change_capacity()` / `size()` / `charge()` / `capacity()` / `statistics()` / `reset_statistics()`
+
+      * 注意事项:
+
+      * * - 元素里保存了所属频次组的指针，因此不支持拷贝，只支持移动
+      *
+      * * - 不做次数衰减，长期运行且热点会变化的场景可以定期 `clear()`，或改用 `lru_cache`
+      *
+      * * - 不是线程安全的，多线程共享时需要外部加锁
+  */
+  template <typename cache_key, typename cache_value, typename hash_function = standard_con::hash_imitation_functions,
+            typename eviction_callback = ignore_eviction>
+  class lfu_cache
+  {
+    struct frequency_group;
+    struct cache_entry
+    {
+      cache_key _key;
+      cache_value _value;
+      uint64_t _charge;
+      frequency_group *_group;
+    };
+    struct key_val
+    {
+      const cache_key &operator()(const cache_entry &entry_data)
+      {
+        return entry_data._key;
+      }
+    };
+    using hash_table = standard_con::hash_table<cache_key, cache_entry, key_val, hash_function>;
+    using iterator = typename hash_table::iterator;
+    struct frequency_group
+    {
+      uint64_t _frequency;
+      uint64_t _entry_count;
+      iterator _last_entry; // 组内最近使用的元素，即全局链表中本组的最后一个
+      frequency_group *_prev;
+      frequency_group *_next;
+    };
+    hash_table instance_hash_table;
+    frequency_group *group_head = nullptr; // 次数最少的组
+    uint64_t capacity_limit;
+    uint64_t used_charge = 0;
+    cache_statistics statistics_data;
+    eviction_callback eviction_function;
+
+    frequency_group *create_group(const uint64_t frequency_value, frequency_group *previous_group)
+    {
+      // 新组挂在 previous_group 之后，previous_group 为空时成为组链表的头
+      frequency_group *next_group = previous_group != nullptr ? previous_group->_next : group_head;
+      frequency_group *new_group = new frequency_group{frequency_value, 0, instance_hash_table.end(), previous_group, next_group};
+      if (next_group != nullptr)
+      {
+        next_group->_prev = new_group;
+      }
+      if (previous_group != nullptr)
+      {
+        previous_group->_next = new_group;
+      }
+      else
+      {
+        group_head = new_group;
+      }
+      return new_group;
+    }
+    void detach_entry(iterator entry_position)
+    {
+      // 元素离开所在的组：只改组的计数和组尾，链表上的位置由调用者处理
+      frequency_group *entry_group = entry_position->_group;
+      if (--entry_group->_entry_count == 0)
+      {
+        if (entry_group->_prev != nullptr)
+        {
+          entry_group->_prev->_next = entry_group->_next;
+        }
+        else
+        {
+          group_head = entry_group->_next;
+        }
+        if (entry_group->_next != nullptr)
+        {
+          entry_group->_next->_prev = entry_group->_prev;
+        }
+        delete entry_group;
+      }
+      else if (entry_group->_last_entry == entry_position)
+      {
+        iterator previous_position = entry_position;
+        entry_group->_last_entry = --previous_position;
+      }
+    }
+    void touch(iterator entry_position)
+    {
+      frequency_group *current_group = entry_position->_group;
+      frequency_group *target_group = current_group->_next;
+      iterator anchor_position = current_group->_last_entry;
+      if (target_group == nullptr || target_group->_frequency != current_group->_frequency + 1)
+      {
+        target_group = create_group(current_group->_frequency + 1, current_group);
+      }
+      else
+      {
+        anchor_position = target_group->_last_entry;
+      }
+      detach_entry(entry_position);
+      instance_hash_table.move_after(entry_position, anchor_position);
+      entry_position->_group = target_group;
+      target_group->_last_entry = entry_position;
+      ++target_group->_entry_count;
+    }
+    void erase_entry(iterator entry_position)
+    {
+      used_charge -= entry_position->_charge;
+      detach_entry(entry_position);
+      instance_hash_table.erase(entry_position);
+    }
+    void evict_until(const uint64_t charge_limit, iterator keep_position)
+    {
+      // 从链表头开始淘汰，跳过刚覆盖的元素 keep_position（它的次数增加后不一定排在最后）
+      while (used_charge > charge_limit)
+      {
+        iterator victim_position = instance_hash_table.begin();
+        if (victim_position == keep_position)
+        {
+          ++victim_position;
+        }
+        if (victim_position == instance_hash_table.end())
+        {
+          break;
+        }
+        eviction_function(static_cast<const cache_key &>(victim_position->_key), victim_position->_value);
+        ++statistics_data.evictions;
+        erase_entry(victim_position);
+      }
+    }
+    void release_groups() noexcept
+    {
+      while (group_head != nullptr)
+      {
+        frequency_group *next_group = group_head->_next;
+        delete group_head;
+        group_head = next_group;
+      }
+    }
+
+  public:
+    explicit lfu_cache(const uint64_t cache_capacity, eviction_callback callback_function = eviction_callback())
+        : capacity_limit(cache_capacity), eviction_function(std::move(callback_function)) { ; }
+
+    ~lfu_cache() { release_groups(); }
+
+    lfu_cache(const lfu_cache &) = delete;
+
+    lfu_cache &operator=(const lfu_cache &) = delete;
+
+    lfu_cache(lfu_cache &&lfu_cache_data) noexcept
+        : instance_hash_table(std::move(lfu_cache_data.instance_hash_table)), group_head(lfu_cache_data.group_head),
+          capacity_limit(lfu_cache_data.capacity_limit), used_charge(lfu_cache_data.used_charge),
+          statistics_data(lfu_cache_data.statistics_data), eviction_function(std::move(lfu_cache_data.eviction_function))
+    {
+      // 节点地址在移动后不变，组里保存的迭代器继续有效
+      lfu_cache_data.group_head = nullptr;
+      lfu_cache_data.used_charge = 0;
+    }
+    lfu_cache &operator=(lfu_cache &&lfu_cache_data) noexcept
+    {
+      if (this != &lfu_cache_data)
+      {
+        lfu_cache temp_data(std::move(lfu_cache_data));
+        swap(temp_data);
+      }
+      return *this;
+    }
+    cache_value *get(const cache_key &key_data)
+    {
+      iterator find_position = instance_hash_table[key_data];
+      if (find_position == instance_hash_table.end())
+      {
+        ++statistics_data.misses;
+        return nullptr;
+      }
+      ++statistics_data.hits;
+      touch(find_position);
+      return &find_position->_value;
+    }
+    cache_value *peek(const cache_key &key_data)
+    {
+      iterator find_position = instance_hash_table[key_data];
+      return find_position == instance_hash_table.end() ? nullptr : &find_position->_value;
+    }
+    [[nodiscard]] bool contains(const cache_key &key_data) { return instance_hash_table.contains(key_data); }
+
+    [[nodiscard]] uint64_t frequency(const cache_key &key_data)
+    {
+      iterator find_position = instance_hash_table[key_data];
+      return find_position == instance_hash_table.end() ? 0 : find_position->_group->_frequency;
+    }
+    bool put(const cache_key &key_data, cache_value value_data, const uint64_t entry_charge = 1)
+    {
+      if (entry_charge > capacity_limit)
+      {
+        return false;
+      }
+      iterator find_position = instance_hash_table[key_data];
+      if (find_position != instance_hash_table.end())
+      {
+        // 覆盖算一次访问；次数增加后它排在同次数组的末尾，淘汰先从更少次数或更旧的元素开始
+        used_charge = used_charge - find_position->_charge + entry_charge;
+        find_position->_value = std::move(value_data);
+        find_position->_charge = entry_charge;
+        touch(find_position);
+        evict_until(capacity_limit, find_position);
+        return true;
+      }
+      evict_until(capacity_limit - entry_charge, instance_hash_table.end());
+      iterator insert_position = instance_hash_table.insert(cache_entry{key_data, std::move(value_data), entry_charge, nullptr}).first;
+      frequency_group *first_group = group_head;
+      if (first_group != nullptr && first_group->_frequency == 1)
+      {
+        instance_hash_table.move_after(insert_position, first_group->_last_entry);
+      }
+      else
+      {
+        first_group = create_group(1, nullptr);
+        instance_hash_table.move_to_front(insert_position);
+      }
+      insert_position->_group = first_group;
+      first_group->_last_entry = insert_position;
+      ++first_group->_entry_count;
+      used_charge += entry_charge;
+      return true;
+    }
+    bool pop(const cache_key &key_data)
+    {
+      iterator find_position = instance_hash_table[key_data];
+      if (find_position == instance_hash_table.end())
+      {
+        return false;
+      }
+      erase_entry(find_position);
+      return true;
+    }
+    void change_capacity(const uint64_t new_capacity)
+    {
+      capacity_limit = new_capacity;
+      evict_until(capacity_limit, instance_hash_table.end());
+    }
+    void clear()
+    {
+      instance_hash_table.clear();
+      release_groups();
+      used_charge = 0;
+    }
+    [[nodiscard]] uint64_t size() const noexcept { return instance_hash_table.size(); }
+
+    [[nodiscard]] bool empty() const noexcept { return instance_hash_table.size() == 0; }
+
+    [[nodiscard]] uint64_t charge() const noexcept { return used_charge; }
+
+    [[nodiscard]] uint64_t capacity() const noexcept { return capacity_limit; }
+
+    [[nodiscard]] const cache_statistics &statistics() const noexcept { return statistics_data; }
+
+    void reset_statistics() noexcept { statistics_data = cache_statistics(); }
+
+    void swap(lfu_cache &lfu_cache_data) noexcept
+    {
+      instance_hash_table.swap(lfu_cache_data.instance_hash_table);
+      standard_con::algorithm::swap(group_head, lfu_cache_data.group_head);
+      standard_con::algorithm::swap(capacity_limit, lfu_cache_data.capacity_limit);
+      standard_con::algorithm::swap(used_charge, lfu_cache_data.used_charge);
+      standard_con::algorithm::swap(statistics_data, lfu_cache_data.statistics_data);
+      standard_con::algorithm::swap(eviction_function, lfu_cache_data.eviction_function);
+    }
+  };
+}
+namespace standard_con
+{
+  using cache_container::cache_statistics;
+  using cache_container::ignore_eviction;
+  using cache_container::lfu_cache;
+  using cache_container::lru_cache;
+}
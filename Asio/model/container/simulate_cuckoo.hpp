@@ -0,0 +1,363 @@
+#pragma once
+#include <cstring>
+#include <mutex>
+#include <shared_mutex>
+#include "simulate_algorithm.hpp"
+#include "simulate_exception.hpp"
+#include "simulate_hash.hpp"
+namespace cuckoo_filter_container
+{
+  /*
+   * @brief  #### `cuckoo_filter` 类模板
+
+   *   - 布谷鸟过滤器：可删除的概率型集合，功能与 `bloom_filter` 相同（无假阴性、有假阳性），但支持 `erase`
+
+   *   - 每个元素只保存 16 位指纹，存放在两个候选桶之一，每桶 4 个槽位，桶数为 2 的幂
+
+   *   - 候选桶 `i2 = i1 ^ hash(指纹)`，两个桶可以只凭指纹互相推出，所以踢出元素时不需要原始值
+
+   * 模板参数:
+
+   * * - `cuckoo_filter_type_value`: 存储的元素类型
+   *
+   * * - `cuckoo_filter_hash_functor`: 哈希函数对象类型，默认为 `standard_con::hash_function<cuckoo_filter_type_value>`，需提供 `hash_seeded`
+
+   * 核心方法:
+
+   * * - `insert(const value&)`: 插入，两个候选桶都满时随机踢出已有指纹，最多 `max_kicks` 次，仍失败则放进备用槽；备用槽也被占用时返回 false
+   *
+   * * - `contains(const value&)`: 查询，一个桶的 4 个指纹装在一个 64 位字里一次比较
+   *
+   * * - `erase(const value&)`: 删除一份指纹，空出位置后会尝试把备用槽里的指纹放回桶中
+   *
+   * * - `size()`、`capacity()`、`bucket_count()`、`load_factor()`、`clear()`
+
+   * 注意事项:
+
+   * * - 误判率约为 `8 / 65536`（约 0.012%），装载率可到 95%，同误判率下每个元素占用的位数少于布隆过滤器
+   *
+   * * - 同一元素插入多次会保存多份指纹，`erase` 每次删一份；删除从未插入过的元素可能误删其他元素的指纹
+   *
+   * * - 容量固定，不会自动扩容，构造时按预计元素个数分配
+  */
+  template <typename cuckoo_filter_type_value, typename cuckoo_filter_hash_functor = standard_con::hash_function<cuckoo_filter_type_value>>
+  class cuckoo_filter
+  {
+    static constexpr uint64_t bucket_slots = 4;
+    static constexpr uint64_t max_kicks = 500;
+    static constexpr uint64_t lane_low_bits = 0x0001000100010001ULL;
+    static constexpr uint64_t lane_high_bits = 0x8000800080008000ULL;
+    struct cuckoo_bucket
+    {
+      uint16_t bucket_fingerprints[bucket_slots];
+    };
+    struct cuckoo_victim
+    {
+      uint64_t victim_index;
+      uint16_t victim_fingerprint;
+      bool victim_used;
+    };
+    cuckoo_filter_hash_functor hash_functions_object;
+    cuckoo_bucket *cuckoo_buckets;
+    uint64_t _bucket_count;
+    uint64_t _size;
+    uint64_t kick_random_state;
+    cuckoo_victim victim_slot;
+    [[nodiscard]] uint64_t bucket_mask() const noexcept
+    {
+      return _bucket_count - 1;
+    }
+    [[nodiscard]] uint64_t alternate_index(const uint64_t bucket_index, const uint16_t fingerprint) const noexcept
+    {
+      // 异或同一个值两次会回到原处，所以 i1 和 i2 可以互相推出
+      return (bucket_index ^ hash::hash_mixing(fingerprint)) & bucket_mask();
+    }
+    void locate(const cuckoo_filter_type_value &filter_value, uint64_t &bucket_index, uint16_t &fingerprint)
+    {
+      const uint64_t hash_value = hash_functions_object.hash_seeded(filter_value, 0);
+      // 指纹取高 16 位，桶号取低位，两者互不重叠；指纹 0 表示空槽，所以不能为 0
+      fingerprint = static_cast<uint16_t>(hash_value >> 48);
+      fingerprint = fingerprint == 0 ? 1 : fingerprint;
+      bucket_index = hash_value & bucket_mask();
+    }
+    [[nodiscard]] bool bucket_contains(const uint64_t bucket_index, const uint16_t fingerprint) const noexcept
+    {
+      // 4 个 16 位指纹装进一个 64 位字，和广播后的指纹异或，再判断是否有某个 16 位通道为 0
+      uint64_t bucket_word;
+      std::memcpy(&bucket_word, cuckoo_buckets[bucket_index].bucket_fingerprints, sizeof(bucket_word));
+      const uint64_t difference_word = bucket_word ^ (lane_low_bits * fingerprint);
+      return ((difference_word - lane_low_bits) & ~difference_word & lane_high_bits) != 0;
+    }
+    bool bucket_insert(const uint64_t bucket_index, const uint16_t fingerprint) noexcept
+    {
+      for (uint64_t slot_position = 0; slot_position < bucket_slots; ++slot_position)
+      {
+        if (cuckoo_buckets[bucket_index].bucket_fingerprints[slot_position] == 0)
+        {
+          cuckoo_buckets[bucket_index].bucket_fingerprints[slot_position] = fingerprint;
+          return true;
+        }
+      }
+      return false;
+    }
+    bool bucket_erase(const uint64_t bucket_index, const uint16_t fingerprint) noexcept
+    {
+      for (uint64_t slot_position = 0; slot_position < bucket_slots; ++slot_position)
+      {
+        if (cuckoo_buckets[bucket_index].bucket_fingerprints[slot_position] == fingerprint)
+        {
+          cuckoo_buckets[bucket_index].bucket_fingerprints[slot_position] = 0;
+          return true;
+        }
+      }
+      return false;
+    }
+    [[nodiscard]] uint64_t next_random() noexcept
+    {
+      kick_random_state ^= kick_random_state << 13;
+      kick_random_state ^= kick_random_state >> 7;
+      kick_random_state ^= kick_random_state << 17;
+      return kick_random_state;
+    }
+    bool insert_fingerprint(uint64_t bucket_index, uint16_t fingerprint) noexcept
+    {
+      const uint64_t alternate_bucket = alternate_index(bucket_index, fingerprint);
+      if (bucket_insert(bucket_index, fingerprint) || bucket_insert(alternate_bucket, fingerprint))
+      {
+        return true;
+      }
+      bucket_index = (next_random() & 1) ? bucket_index : alternate_bucket;
+      for (uint64_t kick_count = 0; kick_count < max_kicks; ++kick_count)
+      {
+        // 随机踢出一个指纹，被踢出的指纹去它的另一个候选桶
+        const uint64_t slot_position = next_random() % bucket_slots;
+        standard_con::algorithm::swap(fingerprint, cuckoo_buckets[bucket_index].bucket_fingerprints[slot_position]);
+        bucket_index = alternate_index(bucket_index, fingerprint);
+        if (bucket_insert(bucket_index, fingerprint))
+        {
+          return true;
+        }
+      }
+      // 踢出次数用完，最后无处安放的指纹放进备用槽，保证已插入的元素不会丢失
+      victim_slot = {bucket_index, fingerprint, true};
+      return true;
+    }
+    [[nodiscard]] static uint64_t bucket_count_for(const uint64_t expected_elements) noexcept
+    {
+      // 按 95% 装载率估算桶数，再向上取 2 的幂
+      const uint64_t needed_buckets = (expected_elements * 100 / 95 + bucket_slots - 1) / bucket_slots;
+      uint64_t bucket_count_value = 1;
+      while (bucket_count_value < needed_buckets)
+      {
+        bucket_count_value <<= 1;
+      }
+      return bucket_count_value;
+    }
+
+  public:
+    explicit cuckoo_filter(const uint64_t expected_elements = 1000)
+        : cuckoo_buckets(nullptr), _bucket_count(bucket_count_for(expected_elements)), _size(0),
+          kick_random_state(0x9e3779b97f4a7c15ULL), victim_slot{0, 0, false}
+    {
+      cuckoo_buckets = new cuckoo_bucket[_bucket_count]();
+    }
+    cuckoo_filter(const cuckoo_filter &cuckoo_filter_data)
+        : hash_functions_object(cuckoo_filter_data.hash_functions_object), cuckoo_buckets(nullptr),
+          _bucket_count(cuckoo_filter_data._bucket_count), _size(cuckoo_filter_data._size), kick_random_state(cuckoo_filter_data.kick_random_state),
+          victim_slot(cuckoo_filter_data.victim_slot)
+    {
+      // 被移动过的过滤器没有桶数组，拷贝它得到的也是空过滤器
+      if (_bucket_count != 0)
+      {
+        cuckoo_buckets = new cuckoo_bucket[_bucket_count];
+        std::memcpy(cuckoo_buckets, cuckoo_filter_data.cuckoo_buckets, _bucket_count * sizeof(cuckoo_bucket));
+      }
+    }
+    cuckoo_filter(cuckoo_filter &&cuckoo_filter_data) noexcept
+        : hash_functions_object(std::move(cuckoo_filter_data.hash_functions_object)), cuckoo_buckets(cuckoo_filter_data.cuckoo_buckets),
+          _bucket_count(cuckoo_filter_data._bucket_count), _size(cuckoo_filter_data._size), kick_random_state(cuckoo_filter_data.kick_random_state),
+          victim_slot(cuckoo_filter_data.victim_slot)
+    {
+      // 移动后源对象为空过滤器：查询和删除返回 false，再次 insert 时按最小容量分配桶数组
+      cuckoo_filter_data.cuckoo_buckets = nullptr;
+      cuckoo_filter_data._bucket_count = 0;
+      cuckoo_filter_data._size = 0;
+      cuckoo_filter_data.victim_slot.victim_used = false;
+    }
+    cuckoo_filter &operator=(cuckoo_filter cuckoo_filter_data) noexcept
+    {
+      swap(cuckoo_filter_data);
+      return *this;
+    }
+    ~cuckoo_filter() noexcept
+    {
+      delete[] cuckoo_buckets;
+    }
+    void swap(cuckoo_filter &cuckoo_filter_data) noexcept
+    {
+      standard_con::algorithm::swap(hash_functions_object, cuckoo_filter_data.hash_functions_object);
+      standard_con::algorithm::swap(cuckoo_buckets, cuckoo_filter_data.cuckoo_buckets);
+      standard_con::algorithm::swap(_bucket_count, cuckoo_filter_data._bucket_count);
+      standard_con::algorithm::swap(_size, cuckoo_filter_data._size);
+      standard_con::algorithm::swap(kick_random_state, cuckoo_filter_data.kick_random_state);
+      standard_con::algorithm::swap(victim_slot, cuckoo_filter_data.victim_slot);
+    }
+    bool insert(const cuckoo_filter_type_value &cuckoo_filter_value)
+    {
+      if (victim_slot.victim_used)
+      {
+        // 备用槽已被占用，说明过滤器已经满了
+        return false;
+      }
+      if (cuckoo_buckets == nullptr)
+      {
+        _bucket_count = bucket_count_for(0);
+        cuckoo_buckets = new cuckoo_bucket[_bucket_count]();
+      }
+      uint64_t bucket_index;
+      uint16_t fingerprint;
+      locate(cuckoo_filter_value, bucket_index, fingerprint);
+      insert_fingerprint(bucket_index, fingerprint);
+      ++_size;
+      return true;
+    }
+    [[nodiscard]] bool contains(const cuckoo_filter_type_value &cuckoo_filter_value)
+    {
+      if (_bucket_count == 0)
+      {
+        return false;
+      }
+      uint64_t bucket_index;
+      uint16_t fingerprint;
+      locate(cuckoo_filter_value, bucket_index, fingerprint);
+      const uint64_t alternate_bucket = alternate_index(bucket_index, fingerprint);
+      if (bucket_contains(bucket_index, fingerprint) || bucket_contains(alternate_bucket, fingerprint))
+      {
+        return true;
+      }
+      return victim_slot.victim_used && victim_slot.victim_fingerprint == fingerprint &&
+             (victim_slot.victim_index == bucket_index || victim_slot.victim_index == alternate_bucket);
+    }
+    bool erase(const cuckoo_filter_type_value &cuckoo_filter_value)
+    {
+      if (_bucket_count == 0)
+      {
+        return false;
+      }
+      uint64_t bucket_index;
+      uint16_t fingerprint;
+      locate(cuckoo_filter_value, bucket_index, fingerprint);
+      const uint64_t alternate_bucket = alternate_index(bucket_index, fingerprint);
+      if (bucket_erase(bucket_index, fingerprint) || bucket_erase(alternate_bucket, fingerprint))
+      {
+        --_size;
+        if (victim_slot.victim_used)
+        {
+          // 腾出了位置，把备用槽里的指纹重新放回桶中
+          victim_slot.victim_used = false;
+          insert_fingerprint(victim_slot.victim_index, victim_slot.victim_fingerprint);
+        }
+        return true;
+      }
+      if (victim_slot.victim_used && victim_slot.victim_fingerprint == fingerprint &&
+          (victim_slot.victim_index == bucket_index || victim_slot.victim_index == alternate_bucket))
+      {
+        victim_slot.victim_used = false;
+        --_size;
+        return true;
+      }
+      return false;
+    }
+    void clear() noexcept
+    {
+      if (cuckoo_buckets != nullptr)
+      {
+        std::memset(static_cast<void *>(cuckoo_buckets), 0, _bucket_count * sizeof(cuckoo_bucket));
+      }
+      victim_slot.victim_used = false;
+      _size = 0;
+    }
+    [[nodiscard]] uint64_t size() const noexcept
+    {
+      return _size;
+    }
+    [[nodiscard]] bool empty() const noexcept
+    {
+      return _size == 0;
+    }
+    [[nodiscard]] uint64_t capacity() const noexcept
+    {
+      return _bucket_count * bucket_slots;
+    }
+    [[nodiscard]] uint64_t bucket_count() const noexcept
+    {
+      return _bucket_count;
+    }
+    [[nodiscard]] double load_factor() const noexcept
+    {
+      return _bucket_count == 0 ? 0.0 : static_cast<double>(_size) / static_cast<double>(capacity());
+    }
+  };
+  /*
+   * @brief  #### `concurrent_cuckoo_filter` 类模板
+
+   *   - `cuckoo_filter` 的线程安全封装，用 `std::shared_mutex` 同步：`contains` 加共享锁，`insert` / `erase` / `clear` 加独占锁
+
+   *   - 适合多个 io 线程共享同一个过滤器、读多写少的场景
+
+   * 注意事项:
+
+   * * - 禁止拷贝和移动，避免线程安全隐患
+  */
+  template <typename cuckoo_filter_type_value, typename cuckoo_filter_hash_functor = standard_con::hash_function<cuckoo_filter_type_value>>
+  class concurrent_cuckoo_filter
+  {
+    mutable std::shared_mutex _access_mutex;
+    cuckoo_filter<cuckoo_filter_type_value, cuckoo_filter_hash_functor> instance_cuckoo_filter;
+
+  public:
+    explicit concurrent_cuckoo_filter(const uint64_t expected_elements = 1000) : instance_cuckoo_filter(expected_elements) { ; }
+    concurrent_cuckoo_filter(const concurrent_cuckoo_filter &) = delete;
+    concurrent_cuckoo_filter &operator=(const concurrent_cuckoo_filter &) = delete;
+    bool insert(const cuckoo_filter_type_value &cuckoo_filter_value)
+    {
+      std::unique_lock<std::shared_mutex> lock(_access_mutex);
+      return instance_cuckoo_filter.insert(cuckoo_filter_value);
+    }
+    [[nodiscard]] bool contains(const cuckoo_filter_type_value &cuckoo_filter_value)
+    {
+      std::shared_lock<std::shared_mutex> lock(_access_mutex);
+      return instance_cuckoo_filter.contains(cuckoo_filter_value);
+    }
+    bool erase(const cuckoo_filter_type_value &cuckoo_filter_value)
+    {
+      std::unique_lock<std::shared_mutex> lock(_access_mutex);
+      return instance_cuckoo_filter.erase(cuckoo_filter_value);
+    }
+    void clear()
+    {
+      std::unique_lock<std::shared_mutex> lock(_access_mutex);
+      instance_cuckoo_filter.clear();
+    }
+    [[nodiscard]] uint64_t size() const
+    {
+      std::shared_lock<std::shared_mutex> lock(_access_mutex);
+      return instance_cuckoo_filter.size();
+    }
+    [[nodiscard]] uint64_t capacity() const
+    {
+      std::shared_lock<std::shared_mutex> lock(_access_mutex);
+      return instance_cuckoo_filter.capacity();
+    }
+    [[nodiscard]] double load_factor() const
+    {
+      std::shared_lock<std::shared_mutex> lock(_access_mutex);
+      return instance_cuckoo_filter.load_factor();
+    }
+  };
+}
+namespace standard_con
+{
+  using cuckoo_filter_container::concurrent_cuckoo_filter;
+  using cuckoo_filter_container::cuckoo_filter;
+}
@@ -0,0 +1,638 @@
+#pragma once
+#include <bit>
+#include <cstring>
+#include <memory>
+#include <iterator>
+#include <type_traits>
+#include "simulate_exception.hpp"
+#include "simulate_algorithm.hpp"
+namespace deque_container
+{
+  /*
+   * @brief  #### `deque` 类模板
+
+      *   - 分段连续的双端队列：元素存放在固定大小的块里，块指针集中存放在中控数组（块表）中
+
+      *   - 两端插入删除均摊 O(1)，支持随机访问，扩容时只搬块指针，元素本身从不移动
+
+      *   - 可作为 `standard_con::queue`、`standard_con::stack`、`standard_con::priority_queue` 的底层容器
+
+      * 模板参数:
+
+      * * - `deque_type`: 元素类型
+      *
+      * * - `deque_allocator`: 分配器类型，默认为 `std::allocator<deque_type>`
+
+      * 元素操作方法:
+
+      * * - `push_back()` / `emplace_back()` / `push_front()` / `emplace_front()`: 两端插入，块满时申请新块
+      *
+      * * - `pop_back()` / `pop_front()`: 两端删除，块空时归还，空时什么都不做
+      *
+      * * - `front()` / `back()` / `operator[]`: 访问元素，`operator[]` 越界时抛出异常
+      *
+      * * - `clear()`: 析构所有元素并释放所有块
+
+      * 特性:
+
+      * * - 块大小为 2 的幂，约 512 字节且至少 16 个元素，定位元素只需移位和掩码
+      *
+      * * - 块表用满时优先把已用的块指针挪回中间，不够时再把块表扩为 2 倍
+      *
+      * * - 保留一个空闲块，队列式使用在块边界来回时不会反复申请释放
+      *
+      * * - 迭代器为随机访问迭代器
+
+      * 注意事项:
+
+      * * - 两端插入后元素的引用和指针仍然有效，但迭代器可能因块表调整而失效
+      *
+      * * - 删除元素只会使被删元素的引用失效
+  */
+  template <typename deque_type, typename deque_allocator = std::allocator<deque_type>>
+  class deque
+  {
+    using allocator_traits = std::allocator_traits<deque_allocator>;
+    using map_allocator = typename allocator_traits::template rebind_alloc<deque_type *>;
+    using map_allocator_traits = std::allocator_traits<map_allocator>;
+    static constexpr uint64_t chunk_bytes = 512;
+    static constexpr uint64_t chunk_elements = sizeof(deque_type) * 16 >= chunk_bytes ? 16 : std::bit_floor(chunk_bytes / sizeof(deque_type));
+    static constexpr uint64_t minimum_map_capacity = 8;
+    deque_type **chunk_map;    // 块表，未使用的槽位始终为空指针
+    uint64_t map_capacity;
+    uint64_t map_begin;        // 第一个已用块所在槽位
+    uint64_t map_end;          // 最后一个已用块的下一个槽位，保证 map_end < map_capacity
+    uint64_t _head_offset;     // 首元素在第一个块中的偏移
+    uint64_t _size;
+    deque_type *spare_chunk;   // 缓存一个空闲块
+    [[no_unique_address]] deque_allocator allocator_object;
+    [[nodiscard]] uint64_t chunk_count() const noexcept
+    {
+      return map_end - map_begin;
+    }
+    [[nodiscard]] deque_type *element_address(const uint64_t &logical_index) const noexcept
+    {
+      const uint64_t flat_index = _head_offset + logical_index;
+      return chunk_map[map_begin + flat_index / chunk_elements] + (flat_index & (chunk_elements - 1));
+    }
+    deque_type *take_chunk()
+    {
+      if (spare_chunk != nullptr)
+      {
+        deque_type *reuse_chunk = spare_chunk;
+        spare_chunk = nullptr;
+        return reuse_chunk;
+      }
+      return allocator_traits::allocate(allocator_object, chunk_elements);
+    }
+    void give_back_chunk(deque_type *chunk_pointer) noexcept
+    {
+      if (spare_chunk == nullptr)
+      {
+        spare_chunk = chunk_pointer;
+      }
+      else
+      {
+        allocator_traits::deallocate(allocator_object, chunk_pointer, chunk_elements);
+      }
+    }
+    void reserve_map_slot()
+    {
+      // 块表两端没有空槽时调用：已用部分不足一半就挪回中间，否则换一张 2 倍大的块表
+      const uint64_t used_chunks = chunk_count();
+      if (chunk_map != nullptr && (used_chunks + 2) * 2 <= map_capacity)
+      {
+        const uint64_t new_begin = (map_capacity - used_chunks) / 2;
+        std::memmove(static_cast<void *>(chunk_map + new_begin), static_cast<const void *>(chunk_map + map_begin), used_chunks * sizeof(deque_type *));
+        for (uint64_t slot_traversal = 0; slot_traversal < map_capacity; ++slot_traversal)
+        {
+          if (slot_traversal < new_begin || slot_traversal >= new_begin + used_chunks)
+          {
+            chunk_map[slot_traversal] = nullptr;
+          }
+        }
+        map_begin = new_begin;
+        map_end = new_begin + used_chunks;
+        return;
+      }
+      map_allocator map_allocator_object(allocator_object);
+      const uint64_t new_map_capacity = map_capacity == 0 ? minimum_map_capacity : map_capacity * 2;
+      deque_type **new_chunk_map = map_allocator_traits::allocate(map_allocator_object, new_map_capacity);
+      const uint64_t new_begin = (new_map_capacity - used_chunks) / 2;
+      for (uint64_t slot_traversal = 0; slot_traversal < new_map_capacity; ++slot_traversal)
+      {
+        new_chunk_map[slot_traversal] = nullptr;
+      }
+      if (used_chunks != 0)
+      {
+        std::memcpy(static_cast<void *>(new_chunk_map + new_begin), static_cast<const void *>(chunk_map + map_begin), used_chunks * sizeof(deque_type *));
+      }
+      if (chunk_map != nullptr)
+      {
+        map_allocator_traits::deallocate(map_allocator_object, chunk_map, map_capacity);
+      }
+      chunk_map = new_chunk_map;
+      map_capacity = new_map_capacity;
+      map_begin = new_begin;
+      map_end = new_begin + used_chunks;
+    }
+    bool prepare_back_slot()
+    {
+      // 尾部没有空位时挂上一个新块，返回是否新挂了块
+      if (_head_offset + _size < chunk_count() * chunk_elements)
+      {
+        return false;
+      }
+      if (chunk_map == nullptr || map_end + 1 >= map_capacity)
+      {
+        reserve_map_slot();
+      }
+      if (chunk_count() == 0)
+      {
+        _head_offset = 0;
+      }
+      chunk_map[map_end] = take_chunk();
+      ++map_end;
+      return true;
+    }
+    bool prepare_front_slot()
+    {
+      // 首块前面没有空位时在前面挂上一个新块，返回是否新挂了块
+      if (_head_offset != 0)
+      {
+        return false;
+      }
+      if (chunk_map == nullptr || map_begin == 0)
+      {
+        reserve_map_slot();
+      }
+      chunk_map[map_begin - 1] = take_chunk();
+      --map_begin;
+      _head_offset = chunk_elements;
+      return true;
+    }
+    void drop_back_chunk() noexcept
+    {
+      --map_end;
+      give_back_chunk(chunk_map[map_end]);
+      chunk_map[map_end] = nullptr;
+    }
+    void drop_front_chunk() noexcept
+    {
+      give_back_chunk(chunk_map[map_begin]);
+      chunk_map[map_begin] = nullptr;
+      ++map_begin;
+    }
+    void destroy_elements() noexcept
+    {
+      if constexpr (!std::is_trivially_destructible_v<deque_type>)
+      {
+        for (uint64_t element_traversal = 0; element_traversal < _size; ++element_traversal)
+        {
+          allocator_traits::destroy(allocator_object, element_address(element_traversal));
+        }
+      }
+    }
+    void release_storage() noexcept
+    {
+      clear();
+      if (spare_chunk != nullptr)
+      {
+        allocator_traits::deallocate(allocator_object, spare_chunk, chunk_elements);
+        spare_chunk = nullptr;
+      }
+      if (chunk_map != nullptr)
+      {
+        map_allocator map_allocator_object(allocator_object);
+        map_allocator_traits::deallocate(map_allocator_object, chunk_map, map_capacity);
+      }
+      chunk_map = nullptr;
+      map_capacity = map_begin = map_end = 0;
+    }
+    void check_location(const uint64_t &access_location) const
+    {
+      try
+      {
+        if (access_location >= _size)
+        {
+          throw custom_exception::fault("传入参数越界", "deque::operator[]", __LINE__);
+        }
+      }
+      catch (const custom_exception::fault &process)
+      {
+        std::cerr << process.what() << " " << process.function_name_get() << " " << process.line_number_get() << std::endl;
+        throw;
+      }
+    }
+    template <typename deque_value_type>
+    class deque_iterator
+    {
+      friend class deque;
+      template <typename>
+      friend class deque_iterator;
+      deque_type *const *map_node;   // 当前块在块表中的槽位
+      deque_value_type *chunk_first; // 当前块首地址
+      deque_value_type *current;     // 当前元素
+      deque_iterator(deque_type *const *node_data, deque_value_type *current_data) noexcept
+          : map_node(node_data), chunk_first(node_data == nullptr ? nullptr : *node_data), current(current_data) { ; }
+      void jump_to(const std::ptrdiff_t &chunk_offset) noexcept
+      {
+        // 以当前块首为基准移动 chunk_offset 个元素，跨块时换到对应槽位
+        const std::ptrdiff_t chunk_size = static_cast<std::ptrdiff_t>(chunk_elements);
+        if (chunk_offset >= 0 && chunk_offset < chunk_size)
+        {
+          current = chunk_first + chunk_offset;
+          return;
+        }
+        const std::ptrdiff_t node_offset = chunk_offset >= 0 ? chunk_offset / chunk_size : -((-chunk_offset - 1) / chunk_size) - 1;
+        map_node += node_offset;
+        chunk_first = *map_node;
+        current = chunk_first + (chunk_offset - node_offset * chunk_size);
+      }
+
+    public:
+      using iterator_category = std::random_access_iterator_tag;
+      using value_type = deque_type;
+      using difference_type = std::ptrdiff_t;
+      using pointer = deque_value_type *;
+      using reference = deque_value_type &;
+      deque_iterator() noexcept : map_node(nullptr), chunk_first(nullptr), current(nullptr) { ; }
+      template <typename other_value_type, typename = std::enable_if_t<std::is_const_v<deque_value_type> && !std::is_const_v<other_value_type>>>
+      deque_iterator(const deque_iterator<other_value_type> &iterator_data) noexcept
+          : map_node(iterator_data.map_node), chunk_first(iterator_data.chunk_first), current(iterator_data.current) { ; }
+      reference operator*() const noexcept
+      {
+        return *current;
+      }
+      pointer operator->() const noexcept
+      {
+        return current;
+      }
+      reference operator[](const difference_type &offset_data) const noexcept
+      {
+        return *(*this + offset_data);
+      }
+      deque_iterator &operator++() noexcept
+      {
+        ++current;
+        if (current == chunk_first + chunk_elements)
+        {
+          ++map_node;
+          chunk_first = *map_node;
+          current = chunk_first;
+        }
+        return *this;
+      }
+      deque_iterator operator++(int) noexcept
+      {
+        deque_iterator temporary_iterator(*this);
+        ++*this;
+        return temporary_iterator;
+      }
+      deque_iterator &operator--() noexcept
+      {
+        if (current == chunk_first)
+        {
+          --map_node;
+          chunk_first = *map_node;
+          current = chunk_first + chunk_elements;
+        }
+        --current;
+        return *this;
+      }
+      deque_iterator operator--(int) noexcept
+      {
+        deque_iterator temporary_iterator(*this);
+        --*this;
+        return temporary_iterator;
+      }
+      deque_iterator &operator+=(const difference_type &offset_data) noexcept
+      {
+        jump_to((current - chunk_first) + offset_data);
+        return *this;
+      }
+      deque_iterator &operator-=(const difference_type &offset_data) noexcept
+      {
+        return *this += -offset_data;
+      }
+      deque_iterator operator+(const difference_type &offset_data) const noexcept
+      {
+        deque_iterator temporary_iterator(*this);
+        return temporary_iterator += offset_data;
+      }
+      friend deque_iterator operator+(const difference_type &offset_data, const deque_iterator &iterator_data) noexcept
+      {
+        return iterator_data + offset_data;
+      }
+      deque_iterator operator-(const difference_type &offset_data) const noexcept
+      {
+        deque_iterator temporary_iterator(*this);
+        return temporary_iterator -= offset_data;
+      }
+      difference_type operator-(const deque_iterator &iterator_data) const noexcept
+      {
+        return (map_node - iterator_data.map_node) * static_cast<difference_type>(chunk_elements) +
+               (current - chunk_first) - (iterator_data.current - iterator_data.chunk_first);
+      }
+      bool operator==(const deque_iterator &iterator_data) const noexcept
+      {
+        return current == iterator_data.current && map_node == iterator_data.map_node;
+      }
+      bool operator!=(const deque_iterator &iterator_data) const noexcept
+      {
+        return !(*this == iterator_data);
+      }
+      bool operator<(const deque_iterator &iterator_data) const noexcept
+      {
+        return map_node == iterator_data.map_node ? current < iterator_data.current : map_node < iterator_data.map_node;
+      }
+      bool operator>(const deque_iterator &iterator_data) const noexcept
+      {
+        return iterator_data < *this;
+      }
+      bool operator<=(const deque_iterator &iterator_data) const noexcept
+      {
+        return !(iterator_data < *this);
+      }
+      bool operator>=(const deque_iterator &iterator_data) const noexcept
+      {
+        return !(*this < iterator_data);
+      }
+    };
+    template <typename deque_value_type>
+    [[nodiscard]] deque_iterator<deque_value_type> make_iterator(const uint64_t &logical_index) const noexcept
+    {
+      if (chunk_map == nullptr)
+      {
+        return deque_iterator<deque_value_type>();
+      }
+      // 末尾恰好落在块边界时指向 map_end 槽位（空指针），与 ++ 走到末尾的结果一致
+      const uint64_t flat_index = _head_offset + logical_index;
+      deque_type *const *node_pointer = chunk_map + map_begin + flat_index / chunk_elements;
+      return deque_iterator<deque_value_type>(node_pointer, *node_pointer + (*node_pointer == nullptr ? 0 : (flat_index & (chunk_elements - 1))));
+    }
+
+  public:
+    using iterator = deque_iterator<deque_type>;
+    using const_iterator = deque_iterator<const deque_type>;
+    using allocator_type = deque_allocator;
+    deque() noexcept(std::is_nothrow_default_constructible_v<deque_allocator>)
+        : chunk_map(nullptr), map_capacity(0), map_begin(0), map_end(0), _head_offset(0), _size(0),
+          spare_chunk(nullptr), allocator_object() { ; }
+    explicit deque(const deque_allocator &allocator_data) noexcept
+        : chunk_map(nullptr), map_capacity(0), map_begin(0), map_end(0), _head_offset(0), _size(0),
+          spare_chunk(nullptr), allocator_object(allocator_data) { ; }
+    deque(const uint64_t &element_count, const deque_type &deque_type_data = deque_type(), const deque_allocator &allocator_data = deque_allocator())
+        : deque(allocator_data)
+    {
+      try
+      {
+        for (uint64_t fill_traversal = 0; fill_traversal < element_count; ++fill_traversal)
+        {
+          emplace_back(deque_type_data);
+        }
+      }
+      catch (...)
+      {
+        release_storage();
+        throw;
+      }
+    }
+    deque(std::initializer_list<deque_type> lightweight_container)
+        : deque()
+    {
+      try
+      {
+        for (auto &chained_values : lightweight_container)
+        {
+          emplace_back(chained_values);
+        }
+      }
+      catch (...)
+      {
+        release_storage();
+        throw;
+      }
+    }
+    deque(const deque &deque_data)
+        : deque(allocator_traits::select_on_container_copy_construction(deque_data.allocator_object))
+    {
+      try
+      {
+        for (uint64_t copy_traversal = 0; copy_traversal < deque_data._size; ++copy_traversal)
+        {
+          emplace_back(*deque_data.element_address(copy_traversal));
+        }
+      }
+      catch (...)
+      {
+        release_storage();
+        throw;
+      }
+    }
+    deque(deque &&deque_data) noexcept
+        : chunk_map(deque_data.chunk_map), map_capacity(deque_data.map_capacity), map_begin(deque_data.map_begin),
+          map_end(deque_data.map_end), _head_offset(deque_data._head_offset), _size(deque_data._size),
+          spare_chunk(deque_data.spare_chunk), allocator_object(std::move(deque_data.allocator_object))
+    {
+      deque_data.chunk_map = nullptr;
+      deque_data.spare_chunk = nullptr;
+      deque_data.map_capacity = deque_data.map_begin = deque_data.map_end = 0;
+      deque_data._head_offset = deque_data._size = 0;
+    }
+    ~deque() noexcept
+    {
+      release_storage();
+    }
+    deque &operator=(const deque &deque_data)
+    {
+      if (this != &deque_data)
+      {
+        deque temporary_deque(deque_data);
+        swap(temporary_deque);
+      }
+      return *this;
+    }
+    deque &operator=(deque &&deque_data) noexcept
+    {
+      if (this != &deque_data)
+      {
+        deque temporary_deque(std::move(deque_data));
+        swap(temporary_deque);
+      }
+      return *this;
+    }
+    void swap(deque &deque_data) noexcept
+    {
+      standard_con::algorithm::swap(chunk_map, deque_data.chunk_map);
+      standard_con::algorithm::swap(map_capacity, deque_data.map_capacity);
+      standard_con::algorithm::swap(map_begin, deque_data.map_begin);
+      standard_con::algorithm::swap(map_end, deque_data.map_end);
+      standard_con::algorithm::swap(_head_offset, deque_data._head_offset);
+      standard_con::algorithm::swap(_size, deque_data._size);
+      standard_con::algorithm::swap(spare_chunk, deque_data.spare_chunk);
+      if constexpr (allocator_traits::propagate_on_container_swap::value)
+      {
+        standard_con::algorithm::swap(allocator_object, deque_data.allocator_object);
+      }
+    }
+    [[nodiscard]] iterator begin() noexcept
+    {
+      return make_iterator<deque_type>(0);
+    }
+    [[nodiscard]] iterator end() noexcept
+    {
+      return make_iterator<deque_type>(_size);
+    }
+    [[nodiscard]] const_iterator begin() const noexcept
+    {
+      return make_iterator<const deque_type>(0);
+    }
+    [[nodiscard]] const_iterator end() const noexcept
+    {
+      return make_iterator<const deque_type>(_size);
+    }
+    [[nodiscard]] uint64_t size() const noexcept
+    {
+      return _size;
+    }
+    [[nodiscard]] bool empty() const noexcept
+    {
+      return _size == 0;
+    }
+    [[nodiscard]] deque_type &front() noexcept
+    {
+      return *element_address(0);
+    }
+    [[nodiscard]] const deque_type &front() const noexcept
+    {
+      return *element_address(0);
+    }
+    [[nodiscard]] deque_type &back() noexcept
+    {
+      return *element_address(_size - 1);
+    }
+    [[nodiscard]] const deque_type &back() const noexcept
+    {
+      return *element_address(_size - 1);
+    }
+    deque_type &operator[](const uint64_t &access_location)
+    {
+      check_location(access_location);
+      return *element_address(access_location);
+    }
+    const deque_type &operator[](const uint64_t &access_location) const
+    {
+      check_location(access_location);
+      return *element_address(access_location);
+    }
+    void clear() noexcept
+    {
+      destroy_elements();
+      while (chunk_count() != 0)
+      {
+        drop_back_chunk();
+      }
+      _head_offset = _size = 0;
+    }
+    template <typename... construct_arguments>
+    deque_type &emplace_back(construct_arguments &&...deque_type_arguments)
+    {
+      // 元素不会搬动，参数引用本容器元素也是安全的
+      const bool chunk_added = prepare_back_slot();
+      deque_type *slot_address = element_address(_size);
+      try
+      {
+        allocator_traits::construct(allocator_object, slot_address, std::forward<construct_arguments>(deque_type_arguments)...);
+      }
+      catch (...)
+      {
+        if (chunk_added)
+        {
+          drop_back_chunk();
+        }
+        throw;
+      }
+      ++_size;
+      return *slot_address;
+    }
+    template <typename... construct_arguments>
+    deque_type &emplace_front(construct_arguments &&...deque_type_arguments)
+    {
+      const bool chunk_added = prepare_front_slot();
+      deque_type *slot_address = chunk_map[map_begin] + (_head_offset - 1);
+      try
+      {
+        allocator_traits::construct(allocator_object, slot_address, std::forward<construct_arguments>(deque_type_arguments)...);
+      }
+      catch (...)
+      {
+        if (chunk_added)
+        {
+          drop_front_chunk();
+          _head_offset = 0;
+        }
+        throw;
+      }
+      --_head_offset;
+      ++_size;
+      return *slot_address;
+    }
+    deque &push_back(const deque_type &deque_type_data)
+    {
+      emplace_back(deque_type_data);
+      return *this;
+    }
+    deque &push_back(deque_type &&deque_type_data)
+    {
+      emplace_back(std::move(deque_type_data));
+      return *this;
+    }
+    deque &push_front(const deque_type &deque_type_data)
+    {
+      emplace_front(deque_type_data);
+      return *this;
+    }
+    deque &push_front(deque_type &&deque_type_data)
+    {
+      emplace_front(std::move(deque_type_data));
+      return *this;
+    }
+    deque &pop_front() noexcept
+    {
+      if (_size != 0)
+      {
+        allocator_traits::destroy(allocator_object, element_address(0));
+        ++_head_offset;
+        --_size;
+        if (_head_offset == chunk_elements)
+        {
+          drop_front_chunk();
+          _head_offset = 0;
+        }
+      }
+      return *this;
+    }
+    deque &pop_back() noexcept
+    {
+      if (_size != 0)
+      {
+        --_size;
+        allocator_traits::destroy(allocator_object, element_address(_size));
+        if (chunk_count() * chunk_elements >= _head_offset + _size + chunk_elements)
+        {
+          drop_back_chunk();
+        }
+        if (chunk_count() == 0)
+        {
+          _head_offset = 0;
+        }
+      }
+      return *this;
+    }
+  };
+}
+namespace standard_con
+{
+  using deque_container::deque;
+}
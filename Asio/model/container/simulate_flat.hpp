@@ -0,0 +1,689 @@
+#pragma once
+#include <iterator>
+#include <type_traits>
+#include "simulate_algorithm.hpp"
+#include "simulate_imitate.hpp"
+#include "simulate_utility.hpp"
+#include "simulate_vector.hpp"
+namespace flat_container
+{
+  /*
+   * @brief  #### `branchless_lower_bound` 函数模板
+
+      *   - 在按比较器有序的连续数组上查找第一个不小于 `key_data` 的位置
+
+      *   - 每轮只根据比较结果选择下一段的起点，编译器会生成条件传送而不是分支，查找时间与数据分布无关
+  */
+  template <typename element_type, typename lookup_type, typename comparators>
+  uint64_t branchless_lower_bound(const element_type *array_data, uint64_t element_count, const lookup_type &key_data, comparators &function_policy)
+  {
+    if (element_count == 0)
+    {
+      return 0;
+    }
+    const element_type *search_base = array_data;
+    while (element_count > 1)
+    {
+      const uint64_t half_count = element_count / 2;
+      search_base = function_policy(search_base[half_count - 1], key_data) ? search_base + half_count : search_base;
+      element_count -= half_count;
+    }
+    return static_cast<uint64_t>(search_base - array_data) + (function_policy(*search_base, key_data) ? 1 : 0);
+  }
+  template <typename element_type, typename lookup_type, typename comparators>
+  uint64_t branchless_upper_bound(const element_type *array_data, uint64_t element_count, const lookup_type &key_data, comparators &function_policy)
+  {
+    if (element_count == 0)
+    {
+      return 0;
+    }
+    const element_type *search_base = array_data;
+    while (element_count > 1)
+    {
+      const uint64_t half_count = element_count / 2;
+      search_base = !function_policy(key_data, search_base[half_count - 1]) ? search_base + half_count : search_base;
+      element_count -= half_count;
+    }
+    return static_cast<uint64_t>(search_base - array_data) + (!function_policy(key_data, *search_base) ? 1 : 0);
+  }
+  /*
+   * @brief  #### `stable_sort_unique` 函数模板
+
+      *   - 对 `insert_range` 收集到的元素稳定排序，再去掉相邻的等价元素，每组等价元素保留最先出现的一个
+
+      *   - 返回去重后的元素个数，之后的位置为已被移走的元素
+  */
+  template <typename element_type, typename key_projection, typename comparators>
+  uint64_t stable_sort_unique(element_type *array_data, const uint64_t element_count, key_projection projection, comparators &function_policy)
+  {
+    auto element_less = [&projection, &function_policy](const element_type &left_element, const element_type &right_element)
+    {
+      return function_policy(projection(left_element), projection(right_element));
+    };
+    standard_con::algorithm::stable_sort(array_data, array_data + element_count, element_less);
+    if (element_count == 0)
+    {
+      return 0;
+    }
+    uint64_t unique_count = 1;
+    for (uint64_t scan_position = 1; scan_position < element_count; ++scan_position)
+    {
+      if (element_less(array_data[unique_count - 1], array_data[scan_position]))
+      {
+        if (unique_count != scan_position)
+        {
+          array_data[unique_count] = std::move(array_data[scan_position]);
+        }
+        ++unique_count;
+      }
+    }
+    return unique_count;
+  }
+  /*
+   * @brief  #### `merge_order` 函数模板
+
+      *   - 按键归并已有的键数组和 `stable_sort_unique` 处理过的新元素，只调用比较器、不移动任何元素
+
+      *   - 返回每个输出位置的来源：小于 `existing_count` 的下标指向已有数组，其余减去 `existing_count` 后指向新元素；与已有键等价的新元素被丢弃
+
+      *   - 比较器抛出异常时已有数组还没有被改动
+  */
+  template <typename key_type, typename incoming_type, typename key_projection, typename comparators>
+  standard_con::vector<uint64_t> merge_order(const key_type *existing_keys, const uint64_t existing_count, const incoming_type *incoming_data,
+                                             const uint64_t incoming_count, key_projection projection, comparators &function_policy)
+  {
+    standard_con::vector<uint64_t> source_positions;
+    source_positions.reserve(existing_count + incoming_count);
+    uint64_t existing_position = 0;
+    uint64_t incoming_position = 0;
+    while (existing_position < existing_count || incoming_position < incoming_count)
+    {
+      const bool take_existing = incoming_position == incoming_count ||
+                                 (existing_position < existing_count && !function_policy(projection(incoming_data[incoming_position]), existing_keys[existing_position]));
+      if (take_existing)
+      {
+        if (incoming_position < incoming_count && !function_policy(existing_keys[existing_position], projection(incoming_data[incoming_position])))
+        {
+          ++incoming_position; // 键已存在，丢弃新元素
+        }
+        source_positions.emplace_back(existing_position++);
+      }
+      else
+      {
+        source_positions.emplace_back(existing_count + incoming_position++);
+      }
+    }
+    return source_positions;
+  }
+  /*
+   * @brief  #### `flat_map` 类模板
+
+      *   - 有序键值对映射，键和值分别放在两个按键排序的连续数组里，没有逐元素的节点分配
+
+      *   - 查找只扫键数组（无分支二分），对几十个元素以内、读多写少的映射比 `tree_map` / `hash_map` 更快、更省内存
+
+      * 模板参数:
+
+      * * - `flat_map_key`: 键类型
+      *
+      * * - `flat_map_value`: 值类型
+      *
+      * * - `comparators`: 键的比较器，默认为 `standard_con::less<flat_map_key>`；带有 `is_transparent` 时开启异构查找
+
+      * 主要操作方法:
+
+      * * - `push()`: 插入键值对，键已存在时不覆盖，O(n)（移动插入点之后的元素）
+      *
+      * * - `insert_range(first, last)`: 批量插入，先对新元素稳定排序去重再与现有数组线性归并，O(n + m log m)
+      *
+      * * - `pop(key)` / `find()` / `contains()` / `count()` / `lower_bound()` / `upper_bound()` / `equal_range()`: 按键操作
+      *
+      * * - `operator[]`: 返回键对应的值，键不存在时插入默认值
+      *
+      * * - `keys()` / `values()`: 直接访问底层的键数组和值数组
+
+      * 迭代器:
+
+      * * - 随机访问迭代器，解引用得到 `{ const key&, value& }` 形式的代理对象，不是 `pair` 的引用
+
+      * 注意事项:
+
+      * * - 插入和删除会使迭代器和元素引用失效
+      *
+      * * - `insert_range` 中重复的键保留最先出现的一个，已在映射中的键保持原值
+      *
+      * * - `insert_range` 中比较器或元素构造抛出异常时，映射保持调用前的内容
+  */
+  template <typename flat_map_key, typename flat_map_value, typename comparators = standard_con::less<flat_map_key>>
+  class flat_map
+  {
+    using key_val_type = standard_con::pair<flat_map_key, flat_map_value>;
+    standard_con::vector<flat_map_key> key_array;
+    standard_con::vector<flat_map_value> value_array;
+    mutable comparators function_policy; // 比较器的 operator() 不一定是 const
+    template <typename element_type, typename value_type>
+    static void insert_at(standard_con::vector<element_type> &array_data, const uint64_t &insert_position, value_type &&value_data)
+    {
+      // 先在末尾构造，再把插入点之后的元素依次后移
+      element_type new_element(std::forward<value_type>(value_data));
+      const uint64_t original_size = array_data.size();
+      if (insert_position == original_size)
+      {
+        array_data.emplace_back(std::move(new_element));
+        return;
+      }
+      array_data.emplace_back(std::move(array_data.data()[original_size - 1]));
+      element_type *element_data = array_data.data();
+      for (uint64_t shift_position = original_size - 1; shift_position > insert_position; --shift_position)
+      {
+        element_data[shift_position] = std::move(element_data[shift_position - 1]);
+      }
+      element_data[insert_position] = std::move(new_element);
+    }
+    template <typename lookup_type>
+    [[nodiscard]] uint64_t lower_position(const lookup_type &key_data) const
+    {
+      return branchless_lower_bound(key_array.data(), key_array.size(), key_data, function_policy);
+    }
+    template <typename lookup_type>
+    [[nodiscard]] uint64_t upper_position(const lookup_type &key_data) const
+    {
+      return branchless_upper_bound(key_array.data(), key_array.size(), key_data, function_policy);
+    }
+    template <typename lookup_type>
+    [[nodiscard]] uint64_t find_position(const lookup_type &key_data) const
+    {
+      const uint64_t search_position = lower_position(key_data);
+      if (search_position < key_array.size() && !function_policy(key_data, key_array.data()[search_position]))
+      {
+        return search_position;
+      }
+      return key_array.size();
+    }
+    template <typename key_type, typename value_type>
+    standard_con::pair<uint64_t, bool> insert_element(key_type &&key_data, value_type &&value_data)
+    {
+      const uint64_t insert_position = lower_position(key_data);
+      if (insert_position < key_array.size() && !function_policy(key_data, key_array.data()[insert_position]))
+      {
+        return standard_con::pair<uint64_t, bool>(insert_position, false);
+      }
+      insert_at(key_array, insert_position, std::forward<key_type>(key_data));
+      try
+      {
+        insert_at(value_array, insert_position, std::forward<value_type>(value_data));
+      }
+      catch (...)
+      {
+        // 值插入失败时撤掉已经插入的键，两个数组保持对齐
+        key_array.erase(key_array.begin() + insert_position);
+        throw;
+      }
+      return standard_con::pair<uint64_t, bool>(insert_position, true);
+    }
+    bool erase_at(const uint64_t &erase_position)
+    {
+      if (erase_position == key_array.size())
+      {
+        return false;
+      }
+      key_array.erase(key_array.begin() + erase_position);
+      value_array.erase(value_array.begin() + erase_position);
+      return true;
+    }
+
+  public:
+    template <bool is_const>
+    class flat_map_iterator
+    {
+      friend class flat_map;
+      using owner_type = std::conditional_t<is_const, const flat_map, flat_map>;
+      using mapped_reference = std::conditional_t<is_const, const flat_map_value &, flat_map_value &>;
+      owner_type *owner_map;
+      uint64_t element_position;
+      flat_map_iterator(owner_type *owner_data, const uint64_t position_data) noexcept
+          : owner_map(owner_data), element_position(position_data) { ; }
+
+    public:
+      struct reference
+      {
+        const flat_map_key &first;
+        mapped_reference second;
+      };
+      struct pointer
+      {
+        reference proxy_reference;
+        const reference *operator->() const noexcept
+        {
+          return &proxy_reference;
+        }
+      };
+      using iterator_category = std::random_access_iterator_tag;
+      using value_type = key_val_type;
+      using difference_type = std::ptrdiff_t;
+      flat_map_iterator() noexcept : owner_map(nullptr), element_position(0) { ; }
+      template <bool other_const, typename = std::enable_if_t<is_const && !other_const>>
+      flat_map_iterator(const flat_map_iterator<other_const> &iterator_data) noexcept
+          : owner_map(iterator_data.owner_map), element_position(iterator_data.element_position) { ; }
+      reference operator*() const noexcept
+      {
+        return reference{owner_map->key_array.data()[element_position], owner_map->value_array.data()[element_position]};
+      }
+      pointer operator->() const noexcept
+      {
+        return pointer{**this};
+      }
+      reference operator[](const difference_type offset_data) const noexcept
+      {
+        return *(*this + offset_data);
+      }
+      flat_map_iterator &operator++() noexcept
+      {
+        ++element_position;
+        return *this;
+      }
+      flat_map_iterator operator++(int) noexcept
+      {
+        flat_map_iterator temporary_iterator(*this);
+        ++element_position;
+        return temporary_iterator;
+      }
+      flat_map_iterator &operator--() noexcept
+      {
+        --element_position;
+        return *this;
+      }
+      flat_map_iterator operator--(int) noexcept
+      {
+        flat_map_iterator temporary_iterator(*this);
+        --element_position;
+        return temporary_iterator;
+      }
+      flat_map_iterator &operator+=(const difference_type offset_data) noexcept
+      {
+        element_position = static_cast<uint64_t>(static_cast<difference_type>(element_position) + offset_data);
+        return *this;
+      }
+      flat_map_iterator &operator-=(const difference_type offset_data) noexcept
+      {
+        return *this += -offset_data;
+      }
+      flat_map_iterator operator+(const difference_type offset_data) const noexcept
+      {
+        flat_map_iterator temporary_iterator(*this);
+        return temporary_iterator += offset_data;
+      }
+      flat_map_iterator operator-(const difference_type offset_data) const noexcept
+      {
+        flat_map_iterator temporary_iterator(*this);
+        return temporary_iterator -= offset_data;
+      }
+      difference_type operator-(const flat_map_iterator &iterator_data) const noexcept
+      {
+        return static_cast<difference_type>(element_position) - static_cast<difference_type>(iterator_data.element_position);
+      }
+      bool operator==(const flat_map_iterator &iterator_data) const noexcept
+      {
+        return element_position == iterator_data.element_position;
+      }
+      bool operator!=(const flat_map_iterator &iterator_data) const noexcept
+      {
+        return element_position != iterator_data.element_position;
+      }
+      bool operator<(const flat_map_iterator &iterator_data) const noexcept
+      {
+        return element_position < iterator_data.element_position;
+      }
+    };
+    using iterator = flat_map_iterator<false>;
+    using const_iterator = flat_map_iterator<true>;
+    using map_iterator = standard_con::pair<iterator, bool>;
+    flat_map() { ; }
+    flat_map(std::initializer_list<key_val_type> lightweight_container)
+    {
+      insert_range(lightweight_container.begin(), lightweight_container.end());
+    }
+    template <typename input_iterator>
+    flat_map(input_iterator first_iterator, input_iterator last_iterator)
+    {
+      insert_range(first_iterator, last_iterator);
+    }
+    map_iterator push(const key_val_type &key_value)
+    {
+      auto insert_result = insert_element(key_value.first, key_value.second);
+      return map_iterator(iterator(this, insert_result.first), insert_result.second);
+    }
+    map_iterator push(key_val_type &&key_value)
+    {
+      auto insert_result = insert_element(std::move(key_value.first), std::move(key_value.second));
+      return map_iterator(iterator(this, insert_result.first), insert_result.second);
+    }
+    template <typename input_iterator>
+    void insert_range(input_iterator first_iterator, input_iterator last_iterator)
+    {
+      // 新元素先收集、稳定排序、去重，再与现有数组按键线性归并，已有的键优先
+      // 归并结果写进新数组，最后再交换；中途抛出异常时映射保持原样
+      standard_con::vector<key_val_type> incoming_entries;
+      if constexpr (std::is_base_of_v<std::forward_iterator_tag, typename std::iterator_traits<input_iterator>::iterator_category>)
+      {
+        incoming_entries.reserve(static_cast<uint64_t>(std::distance(first_iterator, last_iterator)));
+      }
+      for (; first_iterator != last_iterator; ++first_iterator)
+      {
+        incoming_entries.emplace_back(*first_iterator);
+      }
+      auto entry_key = [](const key_val_type &entry_data) -> const flat_map_key &
+      {
+        return entry_data.first;
+      };
+      const uint64_t incoming_count = stable_sort_unique(incoming_entries.data(), incoming_entries.size(), entry_key, function_policy);
+      key_val_type *incoming_data = incoming_entries.data();
+      const uint64_t existing_count = key_array.size();
+      const standard_con::vector<uint64_t> source_positions = merge_order(key_array.data(), existing_count, incoming_data, incoming_count, entry_key, function_policy);
+      standard_con::vector<flat_map_key> merged_keys;
+      standard_con::vector<flat_map_value> merged_values;
+      merged_keys.reserve(source_positions.size());
+      merged_values.reserve(source_positions.size());
+      // 键和值的移动都不抛异常时才移动已有元素，否则拷贝，保证失败时已有元素完好
+      constexpr bool move_existing = std::is_nothrow_move_constructible_v<flat_map_key> && std::is_nothrow_move_constructible_v<flat_map_value>;
+      flat_map_key *existing_keys = key_array.data();
+      flat_map_value *existing_values = value_array.data();
+      for (const uint64_t &source_position : source_positions)
+      {
+        if (source_position < existing_count)
+        {
+          if constexpr (move_existing)
+          {
+            merged_keys.emplace_back(std::move(existing_keys[source_position]));
+            merged_values.emplace_back(std::move(existing_values[source_position]));
+          }
+          else
+          {
+            merged_keys.emplace_back(existing_keys[source_position]);
+            merged_values.emplace_back(existing_values[source_position]);
+          }
+        }
+        else
+        {
+          merged_keys.emplace_back(std::move(incoming_data[source_position - existing_count].first));
+          merged_values.emplace_back(std::move(incoming_data[source_position - existing_count].second));
+        }
+      }
+      key_array.swap(merged_keys);
+      value_array.swap(merged_values);
+    }
+    bool pop(const flat_map_key &key_data)
+    {
+      return erase_at(find_position(key_data));
+    }
+    template <typename lookup_type>
+      requires standard_con::transparent_function<comparators>
+    bool pop(const lookup_type &key_data)
+    {
+      return erase_at(find_position(key_data));
+    }
+    flat_map_value &operator[](const flat_map_key &key_data)
+    {
+      // 键已存在时直接返回，不构造默认值
+      const uint64_t search_position = find_position(key_data);
+      if (search_position != key_array.size())
+      {
+        return value_array.data()[search_position];
+      }
+      // 先插入再取地址，插入可能让值数组重新分配
+      const uint64_t value_position = insert_element(key_data, flat_map_value()).first;
+      return value_array.data()[value_position];
+    }
+    iterator find(const flat_map_key &key_data) { return iterator(this, find_position(key_data)); }
+
+    const_iterator find(const flat_map_key &key_data) const { return const_iterator(this, find_position(key_data)); }
+
+    template <typename lookup_type>
+      requires standard_con::transparent_function<comparators>
+    iterator find(const lookup_type &key_data) { return iterator(this, find_position(key_data)); }
+
+    template <typename lookup_type>
+      requires standard_con::transparent_function<comparators>
+    const_iterator find(const lookup_type &key_data) const { return const_iterator(this, find_position(key_data)); }
+
+    [[nodiscard]] bool contains(const flat_map_key &key_data) const { return find_position(key_data) != key_array.size(); }
+
+    template <typename lookup_type>
+      requires standard_con::transparent_function<comparators>
+    [[nodiscard]] bool contains(const lookup_type &key_data) const { return find_position(key_data) != key_array.size(); }
+
+    [[nodiscard]] uint64_t count(const flat_map_key &key_data) const { return contains(key_data) ? 1 : 0; }
+
+    iterator lower_bound(const flat_map_key &key_data) { return iterator(this, lower_position(key_data)); }
+
+    const_iterator lower_bound(const flat_map_key &key_data) const { return const_iterator(this, lower_position(key_data)); }
+
+    iterator upper_bound(const flat_map_key &key_data) { return iterator(this, upper_position(key_data)); }
+
+    const_iterator upper_bound(const flat_map_key &key_data) const { return const_iterator(this, upper_position(key_data)); }
+
+    standard_con::pair<iterator, iterator> equal_range(const flat_map_key &key_data) { return standard_con::pair<iterator, iterator>(lower_bound(key_data), upper_bound(key_data)); }
+
+    const standard_con::vector<flat_map_key> &keys() const noexcept { return key_array; }
+
+    const standard_con::vector<flat_map_value> &values() const noexcept { return value_array; }
+
+    void reserve(const uint64_t &reserve_count)
+    {
+      key_array.reserve(reserve_count);
+      value_array.reserve(reserve_count);
+    }
+    void clear() noexcept
+    {
+      key_array.clear();
+      value_array.clear();
+    }
+    void swap(flat_map &flat_map_data) noexcept
+    {
+      key_array.swap(flat_map_data.key_array);
+      value_array.swap(flat_map_data.value_array);
+      standard_con::algorithm::swap(function_policy, flat_map_data.function_policy);
+    }
+    [[nodiscard]] uint64_t size() const noexcept { return key_array.size(); }
+
+    [[nodiscard]] bool empty() const noexcept { return key_array.empty(); }
+
+    iterator begin() noexcept { return iterator(this, 0); }
+
+    iterator end() noexcept { return iterator(this, key_array.size()); }
+
+    const_iterator begin() const noexcept { return const_iterator(this, 0); }
+
+    const_iterator end() const noexcept { return const_iterator(this, key_array.size()); }
+
+    const_iterator cbegin() const noexcept { return begin(); }
+
+    const_iterator cend() const noexcept { return end(); }
+  };
+  /*
+   * @brief  #### `flat_set` 类模板
+
+      *   - 有序集合，元素放在一个按比较器排序的连续数组里，迭代器就是数组上的只读指针
+
+      *   - 接口与 `flat_map` 相同（没有 `operator[]`），适合小规模、读多写少的集合
+  */
+  template <typename flat_set_type, typename comparators = standard_con::less<flat_set_type>>
+  class flat_set
+  {
+    standard_con::vector<flat_set_type> key_array;
+    mutable comparators function_policy;
+    template <typename lookup_type>
+    [[nodiscard]] uint64_t lower_position(const lookup_type &key_data) const
+    {
+      return branchless_lower_bound(key_array.data(), key_array.size(), key_data, function_policy);
+    }
+    template <typename lookup_type>
+    [[nodiscard]] uint64_t find_position(const lookup_type &key_data) const
+    {
+      const uint64_t search_position = lower_position(key_data);
+      if (search_position < key_array.size() && !function_policy(key_data, key_array.data()[search_position]))
+      {
+        return search_position;
+      }
+      return key_array.size();
+    }
+    template <typename value_type>
+    standard_con::pair<uint64_t, bool> insert_element(value_type &&value_data)
+    {
+      const uint64_t insert_position = lower_position(value_data);
+      if (insert_position < key_array.size() && !function_policy(value_data, key_array.data()[insert_position]))
+      {
+        return standard_con::pair<uint64_t, bool>(insert_position, false);
+      }
+      flat_set_type new_element(std::forward<value_type>(value_data));
+      const uint64_t original_size = key_array.size();
+      if (insert_position == original_size)
+      {
+        key_array.emplace_back(std::move(new_element));
+      }
+      else
+      {
+        key_array.emplace_back(std::move(key_array.data()[original_size - 1]));
+        flat_set_type *element_data = key_array.data();
+        for (uint64_t shift_position = original_size - 1; shift_position > insert_position; --shift_position)
+        {
+          element_data[shift_position] = std::move(element_data[shift_position - 1]);
+        }
+        element_data[insert_position] = std::move(new_element);
+      }
+      return standard_con::pair<uint64_t, bool>(insert_position, true);
+    }
+    bool erase_at(const uint64_t &erase_position)
+    {
+      if (erase_position == key_array.size())
+      {
+        return false;
+      }
+      key_array.erase(key_array.begin() + erase_position);
+      return true;
+    }
+
+  public:
+    using iterator = const flat_set_type *;
+    using const_iterator = const flat_set_type *;
+    using set_iterator = standard_con::pair<iterator, bool>;
+    flat_set() { ; }
+    flat_set(std::initializer_list<flat_set_type> lightweight_container)
+    {
+      insert_range(lightweight_container.begin(), lightweight_container.end());
+    }
+    template <typename input_iterator>
+    flat_set(input_iterator first_iterator, input_iterator last_iterator)
+    {
+      insert_range(first_iterator, last_iterator);
+    }
+    set_iterator push(const flat_set_type &value_data)
+    {
+      auto insert_result = insert_element(value_data);
+      return set_iterator(key_array.data() + insert_result.first, insert_result.second);
+    }
+    set_iterator push(flat_set_type &&value_data)
+    {
+      auto insert_result = insert_element(std::move(value_data));
+      return set_iterator(key_array.data() + insert_result.first, insert_result.second);
+    }
+    template <typename input_iterator>
+    void insert_range(input_iterator first_iterator, input_iterator last_iterator)
+    {
+      standard_con::vector<flat_set_type> incoming_entries;
+      if constexpr (std::is_base_of_v<std::forward_iterator_tag, typename std::iterator_traits<input_iterator>::iterator_category>)
+      {
+        incoming_entries.reserve(static_cast<uint64_t>(std::distance(first_iterator, last_iterator)));
+      }
+      for (; first_iterator != last_iterator; ++first_iterator)
+      {
+        incoming_entries.emplace_back(*first_iterator);
+      }
+      auto entry_key = [](const flat_set_type &entry_data) -> const flat_set_type &
+      {
+        return entry_data;
+      };
+      const uint64_t incoming_count = stable_sort_unique(incoming_entries.data(), incoming_entries.size(), entry_key, function_policy);
+      flat_set_type *incoming_data = incoming_entries.data();
+      const uint64_t existing_count = key_array.size();
+      const standard_con::vector<uint64_t> source_positions = merge_order(key_array.data(), existing_count, incoming_data, incoming_count, entry_key, function_policy);
+      standard_con::vector<flat_set_type> merged_keys;
+      merged_keys.reserve(source_positions.size());
+      flat_set_type *existing_keys = key_array.data();
+      for (const uint64_t &source_position : source_positions)
+      {
+        if (source_position < existing_count)
+        {
+          // 移动可能抛异常时拷贝已有元素，失败时集合保持原样
+          merged_keys.emplace_back(std::move_if_noexcept(existing_keys[source_position]));
+        }
+        else
+        {
+          merged_keys.emplace_back(std::move(incoming_data[source_position - existing_count]));
+        }
+      }
+      key_array.swap(merged_keys);
+    }
+    bool pop(const flat_set_type &key_data)
+    {
+      return erase_at(find_position(key_data));
+    }
+    template <typename lookup_type>
+      requires standard_con::transparent_function<comparators>
+    bool pop(const lookup_type &key_data)
+    {
+      return erase_at(find_position(key_data));
+    }
+    const_iterator find(const flat_set_type &key_data) const { return key_array.data() + find_position(key_data); }
+
+    template <typename lookup_type>
+      requires standard_con::transparent_function<comparators>
+    const_iterator find(const lookup_type &key_data) const { return key_array.data() + find_position(key_data); }
+
+    [[nodiscard]] bool contains(const flat_set_type &key_data) const { return find_position(key_data) != key_array.size(); }
+
+    template <typename lookup_type>
+      requires standard_con::transparent_function<comparators>
+    [[nodiscard]] bool contains(const lookup_type &key_data) const { return find_position(key_data) != key_array.size(); }
+
+    [[nodiscard]] uint64_t count(const flat_set_type &key_data) const { return contains(key_data) ? 1 : 0; }
+
+    const_iterator lower_bound(const flat_set_type &key_data) const { return key_array.data() + lower_position(key_data); }
+
+    const_iterator upper_bound(const flat_set_type &key_data) const
+    {
+      return key_array.data() + branchless_upper_bound(key_array.data(), key_array.size(), key_data, function_policy);
+    }
+
+    standard_con::pair<const_iterator, const_iterator> equal_range(const flat_set_type &key_data) const
+    {
+      return standard_con::pair<const_iterator, const_iterator>(lower_bound(key_data), upper_bound(key_data));
+    }
+
+    void reserve(const uint64_t &reserve_count) { key_array.reserve(reserve_count); }
+
+    void clear() noexcept { key_array.clear(); }
+
+    void swap(flat_set &flat_set_data) noexcept
+    {
+      key_array.swap(flat_set_data.key_array);
+      standard_con::algorithm::swap(function_policy, flat_set_data.function_policy);
+    }
+    [[nodiscard]] uint64_t size() const noexcept { return key_array.size(); }
+
+    [[nodiscard]] bool empty() const noexcept { return key_array.empty(); }
+
+    const_iterator begin() const noexcept { return key_array.data(); }
+
+    const_iterator end() const noexcept { return key_array.data() + key_array.size(); }
+
+    const_iterator cbegin() const noexcept { return begin(); }
+
+    const_iterator cend() const noexcept { return end(); }
+  };
+}
+namespace standard_con
+{
+  using flat_container::flat_map;
+  using flat_container::flat_set;
+}
@@ -1,7 +1,147 @@
 #pragma once
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
 #include "simulate_string.hpp"
 namespace hash
 {
+  /*
+   * @brief  #### 字节序列哈希
+
+  *   - `hash_multiply_wide` / `hash_multiply_fold`: 64 位乘法取 128 位结果，高低两半异或折叠，是字节哈希和种子混合的基本步骤
+
+  *   - `hash_mixing`: 把一个 64 位哈希值和种子混合成新的哈希值，种子不同结果互不相关
+
+  *   - `hash_finalize`: MurmurHash3 的 fmix64 终结混合，输入的每一位都会影响输出的每一位，适合按位切分哈希值的场合
+
+  *   - `hash_bytes`: 对任意字节序列计算带种子的 64 位哈希（wyhash 风格），按 8 字节一次读取，长度大于 48 时三路并行
+
+   * 特性:
+
+   * * - 顺序敏感，"ab" 与 "ba" 的哈希值不同
+   *
+   * * - 同一种子下结果只取决于字节内容，`standard_con::string`、`std::string`、`const char*` 的同内容哈希值一致
+
+   * 注意事项:
+
+   * * - 非加密哈希，不能抵御刻意构造的碰撞
+   *
+   * * - 结果依赖机器字节序，不适合跨平台持久化
+  */
+  namespace hash_secret
+  {
+    inline constexpr uint64_t primary = 0x2d358dccaa6c78a5ULL;
+    inline constexpr uint64_t secondary = 0x8bb84b93962eacc9ULL;
+    inline constexpr uint64_t tertiary = 0x4b33a62ed433d4a3ULL;
+    inline constexpr uint64_t quaternary = 0x4d5a2da51de1aa47ULL;
+  }
+  constexpr void hash_multiply_wide(uint64_t &multiplicand, uint64_t &multiplier) noexcept
+  {
+    // 64 x 64 -> 128 位乘法，低 64 位写回 multiplicand，高 64 位写回 multiplier
+#if defined(__SIZEOF_INT128__)
+    const unsigned __int128 product = static_cast<unsigned __int128>(multiplicand) * multiplier;
+    multiplicand = static_cast<uint64_t>(product);
+    multiplier = static_cast<uint64_t>(product >> 64);
+#else
+    const uint64_t low_a = multiplicand & 0xFFFFFFFFULL, high_a = multiplicand >> 32;
+    const uint64_t low_b = multiplier & 0xFFFFFFFFULL, high_b = multiplier >> 32;
+    const uint64_t low_low = low_a * low_b, low_high = low_a * high_b, high_low = high_a * low_b, high_high = high_a * high_b;
+    const uint64_t middle = (low_low >> 32) + (low_high & 0xFFFFFFFFULL) + (high_low & 0xFFFFFFFFULL);
+    multiplicand = (middle << 32) | (low_low & 0xFFFFFFFFULL);
+    multiplier = high_high + (low_high >> 32) + (high_low >> 32) + (middle >> 32);
+#endif
+  }
+  [[nodiscard]] constexpr uint64_t hash_multiply_fold(uint64_t multiplicand, uint64_t multiplier) noexcept
+  {
+    hash_multiply_wide(multiplicand, multiplier);
+    return multiplicand ^ multiplier;
+  }
+  [[nodiscard]] constexpr uint64_t hash_mixing(const uint64_t hash_value, const uint64_t hash_seed = 0) noexcept
+  {
+    return hash_multiply_fold(hash_value ^ hash_secret::primary ^ hash_seed,
+                              hash_multiply_fold(hash_seed ^ hash_secret::secondary, hash_secret::tertiary) | 1);
+  }
+  [[nodiscard]] constexpr uint64_t hash_finalize(uint64_t hash_value) noexcept
+  {
+    // 一次乘法折叠只能保证高低两半大致均匀，连续整数、等步长整数的高位仍然彼此相关，这里再做一轮完整雪崩
+    hash_value ^= hash_value >> 33;
+    hash_value *= 0xff51afd7ed558ccdULL;
+    hash_value ^= hash_value >> 33;
+    hash_value *= 0xc4ceb9fe1a85ec53ULL;
+    hash_value ^= hash_value >> 33;
+    return hash_value;
+  }
+  [[nodiscard]] inline uint64_t hash_read_64(const unsigned char *byte_position) noexcept
+  {
+    uint64_t word_value;
+    std::memcpy(&word_value, byte_position, sizeof(word_value));
+    return word_value;
+  }
+  [[nodiscard]] inline uint64_t hash_read_32(const unsigned char *byte_position) noexcept
+  {
+    uint32_t word_value;
+    std::memcpy(&word_value, byte_position, sizeof(word_value));
+    return word_value;
+  }
+  [[nodiscard]] inline uint64_t hash_bytes(const void *byte_data, const uint64_t byte_length, uint64_t hash_seed = 0) noexcept
+  {
+    const auto *byte_position = static_cast<const unsigned char *>(byte_data);
+    hash_seed ^= hash_multiply_fold(hash_seed ^ hash_secret::primary, hash_secret::secondary);
+    uint64_t first_word;
+    uint64_t second_word;
+    if (byte_length <= 16)
+    {
+      if (byte_length >= 4)
+      {
+        // 4~16 字节：首尾各取两个可能重叠的 32 位字，不需要逐字节循环
+        const uint64_t middle_offset = (byte_length >> 3) << 2;
+        first_word = (hash_read_32(byte_position) << 32) | hash_read_32(byte_position + middle_offset);
+        second_word = (hash_read_32(byte_position + byte_length - 4) << 32) | hash_read_32(byte_position + byte_length - 4 - middle_offset);
+      }
+      else if (byte_length > 0)
+      {
+        first_word = (static_cast<uint64_t>(byte_position[0]) << 16) | (static_cast<uint64_t>(byte_position[byte_length >> 1]) << 8) |
+                     byte_position[byte_length - 1];
+        second_word = 0;
+      }
+      else
+      {
+        first_word = second_word = 0;
+      }
+    }
+    else
+    {
+      uint64_t remaining_length = byte_length;
+      if (remaining_length > 48)
+      {
+        uint64_t second_seed = hash_seed;
+        uint64_t third_seed = hash_seed;
+        do
+        {
+          hash_seed = hash_multiply_fold(hash_read_64(byte_position) ^ hash_secret::secondary, hash_read_64(byte_position + 8) ^ hash_seed);
+          second_seed = hash_multiply_fold(hash_read_64(byte_position + 16) ^ hash_secret::tertiary, hash_read_64(byte_position + 24) ^ second_seed);
+          third_seed = hash_multiply_fold(hash_read_64(byte_position + 32) ^ hash_secret::quaternary, hash_read_64(byte_position + 40) ^ third_seed);
+          byte_position += 48;
+          remaining_length -= 48;
+        } while (remaining_length > 48);
+        hash_seed ^= second_seed ^ third_seed;
+      }
+      while (remaining_length > 16)
+      {
+        hash_seed = hash_multiply_fold(hash_read_64(byte_position) ^ hash_secret::secondary, hash_read_64(byte_position + 8) ^ hash_seed);
+        byte_position += 16;
+        remaining_length -= 16;
+      }
+      first_word = hash_read_64(byte_position + remaining_length - 16);
+      second_word = hash_read_64(byte_position + remaining_length - 8);
+    }
+    first_word ^= hash_secret::secondary;
+    second_word ^= hash_seed;
+    hash_multiply_wide(first_word, second_word);
+    return hash_multiply_fold(first_word ^ hash_secret::primary ^ byte_length, second_word ^ hash_secret::secondary);
+  }
   /*
    * @brief  #### `hash_imitation_functions` 类
 
@@ -32,6 +172,8 @@ namespace hash
    *     - `unsigned int`: 转换为 `uint64_t`
    *
    *     - `unsigned short`: 转换为 `uint64_t`
+   *
+   *     - 以上由一个只接受算术类型和枚举的模板统一处理，其余类型不会被它误匹配
 
    * 特性:
 
@@ -49,7 +191,9 @@ namespace hash
 
    * * - 浮点类型（`double`、`float`）的哈希可能丢失精度，不建议用于精确匹配场景
    *
-   * * - 未提供自定义类型（如字符串、容器）的哈希实现，需用户自行重载扩展
+   * * - 字符串（`standard_con::string`、`std::string`、`std::string_view`、`const char*`）统一走 `hash_bytes`，同内容哈希值一致
+   *
+   * * - 未提供自定义类型（如容器）的哈希实现，需用户自行重载扩展
    *
    * * - 对于指针类型或复杂结构，需额外实现重载版本
    *
@@ -57,29 +201,37 @@ namespace hash
 
    * 扩展说明:
 
-   * * - 注释中提供了字符串容器哈希计算的示例代码框架，可根据需求实现
-   *
    * * - 支持为自定义类型添加 `operator()` 重载，扩展哈希能力
    *
   */
   class hash_imitation_functions
   {
   public:
+    using is_transparent = void; // 字符串类型之间哈希值一致，可以直接用 `const char*` / `std::string_view` 查 `string` 键
+    // 只接受算术类型和枚举，`char*` / `char[N]` 等字符串会落到下面的 `const char*` 重载
     template <typename hash_type>
+      requires std::is_arithmetic_v<hash_type> || std::is_enum_v<hash_type>
     [[nodiscard]] uint64_t operator()(const hash_type &data) noexcept
     {
       return static_cast<uint64_t>(data);
     }
     [[nodiscard]] uint64_t operator()(const standard_con::string &data_string) noexcept
     {
-      uint64_t hash_value = 0;
-      for (auto &str : data_string)
-      {
-        hash_value += static_cast<uint64_t>(str) * 31;
-      }
-      return hash_value;
+      return hash_bytes(data_string.c_str(), data_string.size());
+    }
+    [[nodiscard]] uint64_t operator()(const std::string_view data_string) noexcept
+    {
+      return hash_bytes(data_string.data(), data_string.size());
+    }
+    [[nodiscard]] uint64_t operator()(const std::string &data_string) noexcept
+    {
+      return hash_bytes(data_string.data(), data_string.size());
     }
-    // 有需要可以重载本文件的string容器和vector容器.list容器等计算哈希的函数, 这里就不重载了
+    [[nodiscard]] uint64_t operator()(const char *data_string) noexcept
+    {
+      return data_string == nullptr ? 0 : hash_bytes(data_string, std::strlen(data_string));
+    }
+    // 有需要可以重载本文件的vector容器.list容器等计算哈希的函数, 这里就不重载了
   };
   /*
    * @brief  #### `hash_algorithm` 哈希算法命名空间
@@ -121,6 +273,10 @@ namespace hash
         * * - `hash_aphash(const hash_algorithm_type& data_hash)`
         *
         * * - `hash_pjwhash(const hash_algorithm_type& data_hash)`
+        *
+        * * - `hash_seeded(const hash_algorithm_type& data_hash, uint64_t hash_seed)`: 以任意种子计算哈希值，上面五种方法是它的固定种子版本
+        *
+        * * - `hash_derive(uint64_t first_hash, uint64_t second_hash, uint64_t hash_index)`: 由两个独立哈希值派生任意多个哈希值（布隆过滤器的 k 个探测位置）
 
         * 方法特性:
 
@@ -138,7 +294,7 @@ namespace hash
         * 注意事项:
         * * - 依赖基础哈希仿函数 `hash_if` 对 `hash_algorithm_type` 类型的支持（需正确实现 `operator()`）
         *
-        * * - 哈希结果的分布性依赖基础哈希值和乘数的选择，不同算法适用于不同数据特征
+        * * - 五种方法使用不同种子对基础哈希值做乘法折叠混合，彼此互不相关，可直接作为布隆过滤器的多个独立哈希
         *
         * * - 多线程安全：无共享状态，可在多线程环境中安全使用
         *
@@ -156,33 +312,33 @@ namespace hash
       hash_if hash_imitation_functions_object;
       [[nodiscard]] constexpr uint64_t hash_sdmmhash(const hash_algorithm_type &data_hash) noexcept
       {
-        uint64_t return_value = hash_imitation_functions_object(data_hash);
-        return_value = 65599 * return_value;
-        return return_value;
+        return hash_seeded(data_hash, 65599);
       }
       [[nodiscard]] constexpr uint64_t hash_bkdrhash(const hash_algorithm_type &data_hash) noexcept
       {
-        uint64_t return_value = hash_imitation_functions_object(data_hash);
-        return_value = 131 * return_value;
-        return return_value;
+        return hash_seeded(data_hash, 131);
       }
       [[nodiscard]] constexpr uint64_t hash_djbhash(const hash_algorithm_type &data_hash) noexcept
       {
-        uint64_t return_value = hash_imitation_functions_object(data_hash);
-        return_value = 33 * return_value;
-        return return_value;
+        return hash_seeded(data_hash, 33);
       }
       [[nodiscard]] constexpr uint64_t hash_aphash(const hash_algorithm_type &data_hash) noexcept
       {
-        uint64_t return_value = hash_imitation_functions_object(data_hash);
-        return_value = return_value * 1031;
-        return return_value;
+        return hash_seeded(data_hash, 1031);
       }
       [[nodiscard]] constexpr uint64_t hash_pjwhash(const hash_algorithm_type &data_hash) noexcept
       {
-        uint64_t return_value = hash_imitation_functions_object(data_hash);
-        return_value = (return_value << 2) + return_value;
-        return return_value;
+        return hash_seeded(data_hash, 5);
+      }
+      [[nodiscard]] constexpr uint64_t hash_seeded(const hash_algorithm_type &data_hash, const uint64_t hash_seed) noexcept
+      {
+        // 基础哈希值和种子一起做一次乘法折叠，不同种子得到的结果互不相关
+        return hash_mixing(hash_imitation_functions_object(data_hash), hash_seed);
+      }
+      [[nodiscard]] static constexpr uint64_t hash_derive(const uint64_t first_hash, const uint64_t second_hash, const uint64_t hash_index) noexcept
+      {
+        // 双重哈希：由两个独立哈希值派生第 hash_index 个哈希值，第二个哈希值强制为奇数，保证对 2 的幂取模时步长可逆
+        return first_hash + hash_index * (second_hash | 1) + hash_index * hash_index;
       }
     };
   }
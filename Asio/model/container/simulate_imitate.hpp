@@ -45,7 +45,7 @@ namespace imitation_functions
 
    * * - 线程安全：无共享状态，可在多线程环境中安全使用
   */
-  template <typename imitation_functions_less>
+  template <typename imitation_functions_less = void>
   class less
   {
   public:
@@ -54,6 +54,24 @@ namespace imitation_functions
       return _test1 < _test2;
     }
   };
+  /*
+   * @brief  #### `less<void>` 透明比较器
+
+  *   - `standard_con::less<>` 可以比较任意两种支持 `<` 的类型，并带有 `is_transparent` 标记
+
+  *   - 作为 `tree_map` / `tree_set` / `flat_map` 的比较器时开启异构查找，例如用 `const char*` 或 `std::string_view` 直接查 `string` 键，不构造临时键
+  */
+  template <>
+  class less<void>
+  {
+  public:
+    using is_transparent = void;
+    template <typename left_type, typename right_type>
+    constexpr bool operator()(const left_type &_test1, const right_type &_test2) const noexcept(noexcept(_test1 < _test2))
+    {
+      return _test1 < _test2;
+    }
+  };
   /*
    * @brief  #### `greater` 类模板
 
@@ -94,7 +112,7 @@ namespace imitation_functions
 
    * 详细请参考 https://github.com/Hatedatastructures/Custom-libraries/blob/main/template_container.md
   */
-  template <typename imitation_functions_greater>
+  template <typename imitation_functions_greater = void>
   class greater
   {
   public:
@@ -103,9 +121,31 @@ namespace imitation_functions
       return _test1 > _test2;
     }
   };
+  // `greater<>`: 透明版本，与 `less<>` 相同
+  template <>
+  class greater<void>
+  {
+  public:
+    using is_transparent = void;
+    template <typename left_type, typename right_type>
+    constexpr bool operator()(const left_type &_test1, const right_type &_test2) const noexcept(noexcept(_test1 > _test2))
+    {
+      return _test1 > _test2;
+    }
+  };
+  /*
+   * @brief  #### `transparent_function` 概念
+
+  *   - 比较器或哈希函数带有 `is_transparent` 成员类型时，容器的查找接口接受与键不同的查找类型
+
+  *   - 使用方保证：对同一个值，查找类型与键类型得到一致的比较结果或哈希值
+  */
+  template <typename function_type>
+  concept transparent_function = requires { typename function_type::is_transparent; };
 }
 namespace standard_con
 {
   using imitation_functions::greater;
   using imitation_functions::less;
+  using imitation_functions::transparent_function;
 }
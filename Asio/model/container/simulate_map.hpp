@@ -97,6 +97,16 @@ namespace map_container
     }
     tree_map() { ; }
 
+    // 从按键严格递增的区间 O(n) 建树，适合整体重建
+    template <std::forward_iterator sorted_iterator>
+    tree_map(sorted_iterator first_iterator, sorted_iterator last_iterator)
+        : instance_tree_map(first_iterator, last_iterator) { ; }
+
+    template <std::forward_iterator sorted_iterator>
+    void assign_sorted(sorted_iterator first_iterator, sorted_iterator last_iterator) { instance_tree_map.assign_sorted(first_iterator, last_iterator); }
+
+    void clear() noexcept { instance_tree_map.clear(); }
+
     tree_map(const tree_map &tree_map_data) { instance_tree_map = tree_map_data.instance_tree_map; }
 
     tree_map(tree_map &&tree_map_data) noexcept { instance_tree_map = std::move(tree_map_data.instance_tree_map); }
@@ -112,6 +122,54 @@ namespace map_container
 
     iterator find(const key_val_type &tree_map_data) { return instance_tree_map.find(tree_map_data); }
 
+    iterator find(const map_type_k &key_data) { return instance_tree_map.find_key(key_data); }
+
+    [[nodiscard]] uint64_t count(const map_type_k &key_data) const { return instance_tree_map.contains(key_data) ? 1 : 0; }
+
+    // 比较器带有 `is_transparent` 时（如 `standard_con::less<>`），按键查询接受任意可与键比较的类型
+    template <typename lookup_type>
+      requires standard_con::transparent_function<comparators>
+    iterator find(const lookup_type &key_data) { return instance_tree_map.find_key(key_data); }
+
+    template <typename lookup_type>
+      requires standard_con::transparent_function<comparators>
+    [[nodiscard]] uint64_t count(const lookup_type &key_data) const { return instance_tree_map.contains(key_data) ? 1 : 0; }
+
+    template <typename lookup_type>
+      requires standard_con::transparent_function<comparators>
+    [[nodiscard]] bool contains(const lookup_type &key_data) const { return instance_tree_map.contains(key_data); }
+
+    template <typename lookup_type>
+      requires standard_con::transparent_function<comparators>
+    iterator lower_bound(const lookup_type &key_data) { return instance_tree_map.lower_bound(key_data); }
+
+    template <typename lookup_type>
+      requires standard_con::transparent_function<comparators>
+    iterator upper_bound(const lookup_type &key_data) { return instance_tree_map.upper_bound(key_data); }
+
+    template <typename lookup_type>
+      requires standard_con::transparent_function<comparators>
+    standard_con::pair<iterator, iterator> equal_range(const lookup_type &key_data) { return instance_tree_map.equal_range(key_data); }
+
+    template <typename lookup_type>
+      requires standard_con::transparent_function<comparators>
+    [[nodiscard]] uint64_t rank(const lookup_type &key_data) const { return instance_tree_map.rank(key_data); }
+
+    // 区间与名次查询，均为 O(log n)；rank 为严格小于 key 的元素个数，count_range 统计 [low, high)
+    iterator lower_bound(const map_type_k &key_data) { return instance_tree_map.lower_bound(key_data); }
+
+    iterator upper_bound(const map_type_k &key_data) { return instance_tree_map.upper_bound(key_data); }
+
+    standard_con::pair<iterator, iterator> equal_range(const map_type_k &key_data) { return instance_tree_map.equal_range(key_data); }
+
+    [[nodiscard]] bool contains(const map_type_k &key_data) const { return instance_tree_map.contains(key_data); }
+
+    iterator select(const uint64_t order_index) { return instance_tree_map.select(order_index); }
+
+    [[nodiscard]] uint64_t rank(const map_type_k &key_data) const { return instance_tree_map.rank(key_data); }
+
+    [[nodiscard]] uint64_t count_range(const map_type_k &low_key, const map_type_k &high_key) const { return instance_tree_map.count_range(low_key, high_key); }
+
     void middle_order_traversal() { instance_tree_map.middle_order_traversal(); }
 
     void pre_order_traversal() { instance_tree_map.pre_order_traversal(); }
@@ -148,7 +206,10 @@ namespace map_container
    *
    * 底层依赖哈希表（hash_table）实现，键具有唯一性，不允许重复键。
    *
-   * 哈希函数通过组合键和值的哈希结果减少冲突，平均时间复杂度为 O(1)，最坏情况为 O(n)（哈希冲突严重时）。
+   * 哈希值只由键计算，平均时间复杂度为 O(1)，最坏情况为 O(n)（哈希冲突严重时）。
+   *
+   * 哈希函数带有 `is_transparent` 时（默认的 `hash_imitation_functions` 即是），`find` / `operator[]` / `contains` / `count`
+   * 接受与键不同的查找类型，例如用 `const char*` 或 `std::string_view` 查 `string` 键，不构造临时字符串。
    *
    * 模板参数:
    *
@@ -159,8 +220,7 @@ namespace map_container
    * * - `first_external_hash_functions`: 键的哈希函数类型，默认为 `standard_con::imitation_functions::hash_imitation_functions`
    *   - 用于计算键的哈希值，影响键在哈希表中的映射位置
    *
-   * * - `second_external_hash_functions`: 值的哈希函数类型，默认为 `standard_con::imitation_functions::hash_imitation_functions`
-   *   - 用于计算值的哈希值，与键的哈希值组合生成最终哈希结果，减少冲突
+   * * - `second_external_hash_functions`: 保留的模板参数，值不再参与哈希（否则同键不同值会落到不同的桶里，按键查找失效）
    *
    * 迭代器类型:
    * 继承自底层哈希表的迭代器，支持按插入顺序遍历，包含普通和常量版本：
@@ -182,23 +242,7 @@ namespace map_container
         return key_value.first;
       }
     };
-    class inbuilt_map_hash_functor
-    {
-    private:
-      first_external_hash_functions first_hash_functions_object;
-      second_external_hash_functions second_hash_functions_object;
-
-    public:
-      uint64_t operator()(const key_val_type &key_value) noexcept
-      {
-        uint64_t first_hash_value = first_hash_functions_object(key_value.first);
-        first_hash_value = first_hash_value * 31;
-        uint64_t second_hash_value = second_hash_functions_object(key_value.second);
-        second_hash_value = second_hash_value * 31;
-        return (first_hash_value + second_hash_value);
-      }
-    };
-    using hash_table = standard_con::hash_table<hash_map_type_key, key_val_type, key_val, inbuilt_map_hash_functor>;
+    using hash_table = standard_con::hash_table<hash_map_type_key, key_val_type, key_val, first_external_hash_functions>;
     hash_table instance_hash_map;
 
   public:
@@ -220,6 +264,24 @@ namespace map_container
 
     iterator find(const key_val_type &key_value) { return instance_hash_map.find(key_value); }
 
+    iterator find(const hash_map_type_key &key_value) { return instance_hash_map[key_value]; }
+
+    template <typename lookup_type>
+      requires standard_con::transparent_function<first_external_hash_functions>
+    iterator find(const lookup_type &key_value) { return instance_hash_map[key_value]; }
+
+    [[nodiscard]] bool contains(const hash_map_type_key &key_value) { return instance_hash_map.contains(key_value); }
+
+    template <typename lookup_type>
+      requires standard_con::transparent_function<first_external_hash_functions>
+    [[nodiscard]] bool contains(const lookup_type &key_value) { return instance_hash_map.contains(key_value); }
+
+    [[nodiscard]] uint64_t count(const hash_map_type_key &key_value) { return instance_hash_map.contains(key_value) ? 1 : 0; }
+
+    template <typename lookup_type>
+      requires standard_con::transparent_function<first_external_hash_functions>
+    [[nodiscard]] uint64_t count(const lookup_type &key_value) { return instance_hash_map.contains(key_value) ? 1 : 0; }
+
     uint64_t size() { return instance_hash_map.size(); }
 
     [[nodiscard]] uint64_t size() const
@@ -242,7 +304,11 @@ namespace map_container
 
     const_iterator cend() { return instance_hash_map.cend(); }
 
-    iterator operator[](const key_val_type &key_value) { return instance_hash_map[key_value]; }
+    iterator operator[](const hash_map_type_key &key_value) { return instance_hash_map[key_value]; }
+
+    template <typename lookup_type>
+      requires standard_con::transparent_function<first_external_hash_functions>
+    iterator operator[](const lookup_type &key_value) { return instance_hash_map[key_value]; }
 
     hash_map(const std::initializer_list<key_val_type> &lightweight_container)
     {
@@ -284,9 +350,140 @@ namespace map_container
       return *this;
     }
   };
+  /**
+   * @brief 基于开放寻址哈希表实现的无序键值对映射容器
+   *
+   * 该容器是一个无序关联容器，存储键值对（key-value），底层依赖 `flat_hash_table` 实现。
+   *
+   * 键值对连续存放在槽位数组中，查找时按组并行比较控制字节，没有逐元素的节点分配，适合查找密集的场景。
+   *
+   * 与 `hash_map` 不同，哈希值只由键计算，元素的遍历顺序为槽位顺序而非插入顺序。
+   *
+   * 模板参数:
+   *
+   * * - `flat_hash_map_type_key`: 键（key）的类型，用于唯一标识和哈希计算
+   *
+   * * - `flat_hash_map_type_value`: 值（value）的类型，与键关联的数据
+   *
+   * * - `external_hash_functions`: 键的哈希函数类型，默认为 `standard_con::hash_imitation_functions`；带有 `is_transparent` 时开启异构查找
+   *
+   * 迭代器类型:
+   *
+   * * - `iterator`: 正向迭代器，指向键值对，按槽位顺序遍历
+   *
+   * * - `const_iterator`: 常量正向迭代器，指向不可修改的键值对
+   *
+   * 注意事项:
+   *
+   * * - 插入触发扩容时所有元素会被移动，迭代器和元素地址失效
+   */
+  template <typename flat_hash_map_type_key, typename flat_hash_map_type_value,
+            typename external_hash_functions = standard_con::hash_imitation_functions>
+  class flat_hash_map
+  {
+    using key_val_type = standard_con::pair<flat_hash_map_type_key, flat_hash_map_type_value>;
+    struct key_val
+    {
+      const flat_hash_map_type_key &operator()(const key_val_type &key_value)
+      {
+        return key_value.first;
+      }
+    };
+    using flat_hash_table = standard_con::flat_hash_table<flat_hash_map_type_key, key_val_type, key_val, external_hash_functions>;
+    flat_hash_table instance_flat_hash_map;
+
+  public:
+    using iterator = typename flat_hash_table::iterator;
+    using const_iterator = typename flat_hash_table::const_iterator;
+    flat_hash_map() { ; }
+
+    ~flat_hash_map() = default;
+
+    explicit flat_hash_map(const uint64_t element_count) { instance_flat_hash_map.reserve(element_count); }
+
+    explicit flat_hash_map(const key_val_type &key_value) { instance_flat_hash_map.push(key_value); }
+
+    explicit flat_hash_map(key_val_type &&key_value) { instance_flat_hash_map.push(std::move(key_value)); }
+
+    flat_hash_map(const flat_hash_map &flat_hash_map_data) = default;
+
+    flat_hash_map(flat_hash_map &&flat_hash_map_data) noexcept = default;
+
+    flat_hash_map(const std::initializer_list<key_val_type> &lightweight_container)
+    {
+      instance_flat_hash_map.reserve(lightweight_container.size());
+      for (auto &chained_values : lightweight_container)
+      {
+        instance_flat_hash_map.push(chained_values);
+      }
+    }
+    flat_hash_map &operator=(const flat_hash_map &flat_hash_map_data) = default;
+
+    flat_hash_map &operator=(flat_hash_map &&flat_hash_map_data) noexcept = default;
+
+    bool push(const key_val_type &key_value) { return instance_flat_hash_map.push(key_value); }
+
+    bool push(key_val_type &&key_value) { return instance_flat_hash_map.push(std::move(key_value)); }
+
+    bool pop(const key_val_type &key_value) { return instance_flat_hash_map.pop(key_value); }
+
+    iterator find(const key_val_type &key_value) { return instance_flat_hash_map.find(key_value); }
+
+    iterator find(const flat_hash_map_type_key &key_value) { return instance_flat_hash_map[key_value]; }
+
+    template <typename lookup_type>
+      requires standard_con::transparent_function<external_hash_functions>
+    iterator find(const lookup_type &key_value) { return instance_flat_hash_map[key_value]; }
+
+    iterator operator[](const flat_hash_map_type_key &key_value) { return instance_flat_hash_map[key_value]; }
+
+    template <typename lookup_type>
+      requires standard_con::transparent_function<external_hash_functions>
+    iterator operator[](const lookup_type &key_value) { return instance_flat_hash_map[key_value]; }
+
+    [[nodiscard]] bool contains(const flat_hash_map_type_key &key_value) { return instance_flat_hash_map.contains(key_value); }
+
+    template <typename lookup_type>
+      requires standard_con::transparent_function<external_hash_functions>
+    [[nodiscard]] bool contains(const lookup_type &key_value) { return instance_flat_hash_map.contains(key_value); }
+
+    [[nodiscard]] uint64_t count(const flat_hash_map_type_key &key_value) { return instance_flat_hash_map.contains(key_value) ? 1 : 0; }
+
+    template <typename lookup_type>
+      requires standard_con::transparent_function<external_hash_functions>
+    [[nodiscard]] uint64_t count(const lookup_type &key_value) { return instance_flat_hash_map.contains(key_value) ? 1 : 0; }
+
+    void reserve(const uint64_t element_count) { instance_flat_hash_map.reserve(element_count); }
+
+    void clear() { instance_flat_hash_map.clear(); }
+
+    [[nodiscard]] uint64_t size() const
+    {
+      return instance_flat_hash_map.size();
+    }
+
+    [[nodiscard]] uint64_t capacity() const
+    {
+      return instance_flat_hash_map.capacity();
+    }
+
+    [[nodiscard]] bool empty() const
+    {
+      return instance_flat_hash_map.empty();
+    }
+
+    iterator begin() { return instance_flat_hash_map.begin(); }
+
+    iterator end() { return instance_flat_hash_map.end(); }
+
+    const_iterator cbegin() const { return instance_flat_hash_map.cbegin(); }
+
+    const_iterator cend() const { return instance_flat_hash_map.cend(); }
+  };
 }
 namespace standard_con
 {
+  using map_container::flat_hash_map;
   using map_container::hash_map;
   using map_container::tree_map;
 }
\ No newline at end of file
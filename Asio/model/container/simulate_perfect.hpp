@@ -0,0 +1,228 @@
+#pragma once
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstdint>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+namespace perfect_hash_container
+{
+  /*
+   * @brief  #### `perfect_hash_functions` 类
+
+      *   - `perfect_hash_map` 的默认哈希函数，字符串使用 FNV-1a，整数和枚举直接取值，全部为 `constexpr`，可以在编译期建表
+
+      *   - 每个键只哈希一次，桶号和带种子的槽位都由这一个 64 位结果再混合得到，查找时不会重复扫描字符串
+  */
+  class perfect_hash_functions
+  {
+  public:
+    constexpr uint64_t operator()(const std::string_view key_data) const noexcept
+    {
+      uint64_t hash_value = 0xcbf29ce484222325ULL;
+      for (const char character : key_data)
+      {
+        hash_value ^= static_cast<unsigned char>(character);
+        hash_value *= 0x100000001b3ULL;
+      }
+      return hash_value;
+    }
+    template <typename key_type>
+      requires std::integral<key_type> || std::is_enum_v<key_type>
+    constexpr uint64_t operator()(const key_type key_data) const noexcept
+    {
+      return static_cast<uint64_t>(key_data);
+    }
+  };
+  /*
+   * @brief  #### `perfect_hash_map` 类模板
+
+      *   - 只读的静态映射，由一组键值对在编译期（`constexpr` / `consteval` 上下文）建好，之后不再修改
+
+      *   - 采用两级的 “哈希 - 位移” 方案：第一次哈希决定桶，每个桶记录一个种子，用该种子做第二次哈希直接得到槽位
+
+      *   - 建表时按桶大小从大到小依次为每个桶搜索种子，使桶内所有键落到互不相同的空槽里，因此查找没有冲突链
+
+      *   - 查找固定为两次哈希加一次键比较，O(1)，没有分支链和字符串的逐个比较
+
+      * 模板参数:
+
+      * * - `perfect_key`: 键类型，需要是字面类型且可默认构造，如 `std::string_view`、整数、枚举
+      *
+      * * - `perfect_value`: 值类型，要求同上
+      *
+      * * - `element_count`: 元素个数，由 `make_perfect_hash_map` 从初始化列表推导
+      *
+      * * - `hash_function`: 返回 64 位结果的 `constexpr` 哈希函数，默认为 `perfect_hash_functions`
+
+      * 主要操作方法:
+
+      * * - `find(key)`: 返回值的指针，键不存在时返回 `nullptr`
+      *
+      * * - `value_or(key, fallback)`: 键不存在时返回 `fallback`
+      *
+      * * - `contains(key)` / `count(key)` / `size()`
+
+      * 注意事项:
+
+      * * - 键重复、或两个键的 64 位哈希完全相同导致找不到可用的种子时抛出 `std::logic_error`，在常量求值中表现为编译错误
+      *
+      * * - 槽位数为不小于元素个数的 2 的幂，`std::string_view` 键需要保证所指字符串的生命周期（字面量即可）
+  */
+  template <typename perfect_key, typename perfect_value, uint64_t element_count, typename hash_function = perfect_hash_functions>
+  class perfect_hash_map
+  {
+    static_assert(element_count > 0, "perfect_hash_map 至少需要一个元素");
+
+  public:
+    static constexpr uint64_t table_size = std::bit_ceil(element_count);   // 槽位数
+    static constexpr uint64_t bucket_count = element_count;                  // 桶数，每个桶一个种子
+    static constexpr uint64_t maximum_seed = 1ULL << 20;                     // 单个桶最多尝试的种子数
+
+  private:
+    std::array<uint64_t, bucket_count> seed_array{};
+    std::array<perfect_key, table_size> key_array{};
+    std::array<perfect_value, table_size> value_array{};
+    std::array<bool, table_size> occupied_array{};
+    hash_function hash_function_object{};
+
+    static constexpr uint64_t mix(uint64_t hash_value, const uint64_t seed) noexcept
+    {
+      // 64 位终混，种子不同得到的槽位近似独立；种子 0 用来分桶
+      hash_value ^= seed * 0x9e3779b97f4a7c15ULL;
+      hash_value ^= hash_value >> 33;
+      hash_value *= 0xff51afd7ed558ccdULL;
+      hash_value ^= hash_value >> 33;
+      hash_value *= 0xc4ceb9fe1a85ec53ULL;
+      hash_value ^= hash_value >> 33;
+      return hash_value;
+    }
+    constexpr uint64_t slot_of(const perfect_key &key_data) const noexcept
+    {
+      const uint64_t hash_value = hash_function_object(key_data);
+      return mix(hash_value, seed_array[mix(hash_value, 0) % bucket_count]) & (table_size - 1);
+    }
+
+  public:
+    using key_type = perfect_key;
+    using value_type = perfect_value;
+
+    constexpr explicit perfect_hash_map(const std::pair<perfect_key, perfect_value> (&element_list)[element_count])
+    {
+      for (uint64_t outer_position = 0; outer_position < element_count; ++outer_position)
+      {
+        for (uint64_t inner_position = outer_position + 1; inner_position < element_count; ++inner_position)
+        {
+          if (element_list[outer_position].first == element_list[inner_position].first)
+          {
+            throw std::logic_error("perfect_hash_map: duplicate key");
+          }
+        }
+      }
+      // 分桶并按桶大小降序排列，大桶先放，空槽多时更容易找到种子
+      std::array<uint64_t, element_count> hash_of{};
+      std::array<uint64_t, element_count> bucket_of{};
+      std::array<uint64_t, bucket_count> bucket_sizes{};
+      std::array<uint64_t, bucket_count> bucket_order{};
+      for (uint64_t element_position = 0; element_position < element_count; ++element_position)
+      {
+        hash_of[element_position] = hash_function_object(element_list[element_position].first);
+        bucket_of[element_position] = mix(hash_of[element_position], 0) % bucket_count;
+        ++bucket_sizes[bucket_of[element_position]];
+      }
+      for (uint64_t bucket_position = 0; bucket_position < bucket_count; ++bucket_position)
+      {
+        uint64_t insert_position = bucket_position;
+        while (insert_position > 0 && bucket_sizes[bucket_order[insert_position - 1]] < bucket_sizes[bucket_position])
+        {
+          bucket_order[insert_position] = bucket_order[insert_position - 1];
+          --insert_position;
+        }
+        bucket_order[insert_position] = bucket_position;
+      }
+      std::array<uint64_t, element_count> member_array{};
+      std::array<uint64_t, element_count> slot_array{};
+      for (const uint64_t bucket_position : bucket_order)
+      {
+        if (bucket_sizes[bucket_position] == 0)
+        {
+          break;
+        }
+        uint64_t member_count = 0;
+        for (uint64_t element_position = 0; element_position < element_count; ++element_position)
+        {
+          if (bucket_of[element_position] == bucket_position)
+          {
+            member_array[member_count++] = element_position;
+          }
+        }
+        uint64_t seed = 1;
+        for (; seed <= maximum_seed; ++seed)
+        {
+          bool seed_usable = true;
+          for (uint64_t member_position = 0; member_position < member_count && seed_usable; ++member_position)
+          {
+            const uint64_t slot = mix(hash_of[member_array[member_position]], seed) & (table_size - 1);
+            seed_usable = !occupied_array[slot];
+            for (uint64_t previous_position = 0; previous_position < member_position && seed_usable; ++previous_position)
+            {
+              seed_usable = slot_array[previous_position] != slot;
+            }
+            slot_array[member_position] = slot;
+          }
+          if (seed_usable)
+          {
+            break;
+          }
+        }
+        if (seed > maximum_seed)
+        {
+          throw std::logic_error("perfect_hash_map: no displacement seed found");
+        }
+        seed_array[bucket_position] = seed;
+        for (uint64_t member_position = 0; member_position < member_count; ++member_position)
+        {
+          const uint64_t slot = slot_array[member_position];
+          key_array[slot] = element_list[member_array[member_position]].first;
+          value_array[slot] = element_list[member_array[member_position]].second;
+          occupied_array[slot] = true;
+        }
+      }
+    }
+    [[nodiscard]] constexpr const perfect_value *find(const perfect_key &key_data) const noexcept
+    {
+      const uint64_t slot = slot_of(key_data);
+      return occupied_array[slot] && key_array[slot] == key_data ? &value_array[slot] : nullptr;
+    }
+    [[nodiscard]] constexpr perfect_value value_or(const perfect_key &key_data, const perfect_value &fallback_value) const noexcept
+    {
+      const perfect_value *value_pointer = find(key_data);
+      return value_pointer != nullptr ? *value_pointer : fallback_value;
+    }
+    [[nodiscard]] constexpr bool contains(const perfect_key &key_data) const noexcept { return find(key_data) != nullptr; }
+
+    [[nodiscard]] constexpr uint64_t count(const perfect_key &key_data) const noexcept { return contains(key_data) ? 1 : 0; }
+
+    [[nodiscard]] static constexpr uint64_t size() noexcept { return element_count; }
+  };
+  /*
+   * @brief  #### `make_perfect_hash_map` 函数模板
+
+      *   - 从键值对列表构造 `perfect_hash_map`，元素个数由列表推导，`consteval` 保证建表发生在编译期
+
+      *   - 用法：`constexpr auto table = make_perfect_hash_map<std::string_view, int>({{"a", 1}, {"b", 2}});`
+  */
+  template <typename perfect_key, typename perfect_value, typename hash_function = perfect_hash_functions, uint64_t element_count>
+  consteval perfect_hash_map<perfect_key, perfect_value, element_count, hash_function> make_perfect_hash_map(const std::pair<perfect_key, perfect_value> (&element_list)[element_count])
+  {
+    return perfect_hash_map<perfect_key, perfect_value, element_count, hash_function>(element_list);
+  }
+}
+namespace standard_con
+{
+  using perfect_hash_container::make_perfect_hash_map;
+  using perfect_hash_container::perfect_hash_functions;
+  using perfect_hash_container::perfect_hash_map;
+}
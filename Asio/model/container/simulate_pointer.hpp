@@ -1,5 +1,9 @@
 #pragma once
+#include <atomic>
 #include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
 #include "simulate_exception.hpp"
 namespace standard_con
 {
@@ -15,6 +19,10 @@ namespace standard_con
   *   - `unique_ptr`: 独占所有权的智能指针，确保资源仅由一个智能指针管理
 
   *   - `weak_ptr`: 弱引用的智能指针，不拥有资源所有权，用于避免循环引用
+
+  *   - `make_shared`: 对象与控制块一次分配的 `shared_ptr` 工厂函数
+
+  *   - `intrusive_ptr`: 侵入式引用计数指针，计数放在对象内（配合 `ref_counted` 基类）
   */
   namespace pointer
   {
@@ -234,6 +242,131 @@ namespace standard_con::pointer
       unique_ptr_data._ptr = nullptr;
     }
   };
+  /*
+   * @brief  #### `shared_control_block` 类
+
+  *   - `shared_ptr` 与 `weak_ptr` 共用的控制块，保存强引用计数和弱引用计数
+
+  *   - 计数用原子变量维护，拷贝、释放都不加锁
+
+   * 计数规则:
+
+   * * - 强引用计数归 0 时销毁对象
+
+   * * - 所有强引用合起来持有一个弱引用，弱引用计数归 0 时释放控制块本身
+
+   * 派生类:
+
+   * * - `pointer_control_block`: 对象单独分配，控制块保存指针和删除器
+
+   * * - `inplace_control_block`: 对象直接放在控制块里，由 `make_shared` 一次分配
+  */
+  class shared_control_block
+  {
+    std::atomic<uint64_t> strong_count;
+    std::atomic<uint64_t> weak_count;
+
+  protected:
+    virtual void destroy_object() noexcept = 0;
+    virtual void destroy_block() noexcept = 0;
+
+  public:
+    shared_control_block() noexcept : strong_count(1), weak_count(1) { ; }
+    shared_control_block(const shared_control_block &) = delete;
+    shared_control_block &operator=(const shared_control_block &) = delete;
+    virtual ~shared_control_block() noexcept = default;
+    void add_strong() noexcept
+    {
+      // 已经持有一个强引用时才会调用，只需要原子性，不需要同步
+      strong_count.fetch_add(1, std::memory_order_relaxed);
+    }
+    void release_strong() noexcept
+    {
+      // acq_rel：保证其他线程对对象的写入在析构之前可见
+      if (strong_count.fetch_sub(1, std::memory_order_acq_rel) == 1)
+      {
+        destroy_object();
+        release_weak();
+      }
+    }
+    [[nodiscard]] bool try_add_strong() noexcept
+    {
+      // weak_ptr::lock 使用：对象已经销毁（计数为 0）时不能再复活
+      uint64_t current_count = strong_count.load(std::memory_order_relaxed);
+      while (current_count != 0)
+      {
+        if (strong_count.compare_exchange_weak(current_count, current_count + 1, std::memory_order_acq_rel, std::memory_order_relaxed))
+        {
+          return true;
+        }
+      }
+      return false;
+    }
+    void add_weak() noexcept
+    {
+      weak_count.fetch_add(1, std::memory_order_relaxed);
+    }
+    void release_weak() noexcept
+    {
+      if (weak_count.fetch_sub(1, std::memory_order_acq_rel) == 1)
+      {
+        destroy_block();
+      }
+    }
+    [[nodiscard]] uint64_t strong_count_get() const noexcept
+    {
+      return strong_count.load(std::memory_order_acquire);
+    }
+  };
+  template <typename control_type, typename deleter>
+  class pointer_control_block final : public shared_control_block
+  {
+    control_type *_ptr;
+    deleter _deleter;
+
+  protected:
+    void destroy_object() noexcept override
+    {
+      _deleter(_ptr);
+      _ptr = nullptr;
+    }
+    void destroy_block() noexcept override
+    {
+      delete this;
+    }
+
+  public:
+    pointer_control_block(control_type *ptr, const deleter &deleter_data) noexcept
+        : _ptr(ptr), _deleter(deleter_data) { ; }
+  };
+  template <typename control_type>
+  class inplace_control_block final : public shared_control_block
+  {
+    alignas(control_type) unsigned char object_storage[sizeof(control_type)];
+
+  protected:
+    void destroy_object() noexcept override
+    {
+      object_pointer()->~control_type();
+    }
+    void destroy_block() noexcept override
+    {
+      delete this;
+    }
+
+  public:
+    template <typename... construct_arguments>
+    explicit inplace_control_block(construct_arguments &&...object_arguments)
+    {
+      ::new (static_cast<void *>(object_storage)) control_type(std::forward<construct_arguments>(object_arguments)...);
+    }
+    control_type *object_pointer() noexcept
+    {
+      return std::launder(reinterpret_cast<control_type *>(object_storage));
+    }
+  };
+  template <typename weak_ptr_type>
+  class weak_ptr;
   /*
    * @brief  #### `shared_ptr` 类
 
@@ -245,21 +378,21 @@ namespace standard_con::pointer
 
    * * - `shared_ptr_type`: 管理的对象类型
 
-   * * - `deleter`: 资源释放器类型，默认为 `std::default_delete<shared_ptr_type>`
+   * * - `deleter`: 资源释放器类型，默认为 `std::default_delete<shared_ptr_type>`，保存在控制块里
 
    * 构造函数:
 
-   * * - `explicit shared_ptr(shared_ptr_type* ptr = nullptr)`: 从原始指针构造
+   * * - `explicit shared_ptr(shared_ptr_type* ptr = nullptr)`: 从原始指针构造，空指针不分配控制块
 
    * * - 拷贝构造函数: 增加引用计数并共享资源
 
-   * * - 移动构造函数: 转移资源所有权，原指针重置
+   * * - 移动构造函数: 直接接管控制块，原指针置空，不分配内存也不改计数
 
    * 核心机制:
 
-   * * - 引用计数(`shared_pcount`): 记录共享同一资源的指针数量
+   * * - 控制块(`shared_control_block`): 原子的强、弱引用计数，拷贝和释放都是无锁的
 
-   * * - 线程安全: 使用互斥锁(`_pmutex`)保护引用计数操作
+   * * - `make_shared`: 对象和控制块一次分配，放在同一块内存里
 
    * 提供的操作符:
 
@@ -267,17 +400,21 @@ namespace standard_con::pointer
 
    * * - `operator->()`: 访问管理对象的成员
 
+   * * - `operator bool`: 是否管理着对象
+
    * * - 拷贝赋值、移动赋值: 管理引用计数的增减
 
    * 关键方法:
 
-   * * - `get_count()`: 返回当前引用计数
+   * * - `get_count()`: 返回当前强引用计数，空指针返回 0
 
    * * - `get_ptr()`: 返回原始指针（不释放所有权）
 
+   * * - `reset()` / `swap()`: 放弃所有权 / 交换两个指针
+
    * 资源管理:
 
-   * * - 最后一个指针释放时调用删除器销毁资源
+   * * - 最后一个强引用释放时调用删除器销毁资源，最后一个弱引用释放时回收控制块
 
    * * - 支持自定义删除器处理特殊资源（如文件句柄、网络连接）
 
@@ -285,9 +422,9 @@ namespace standard_con::pointer
 
    * 线程安全性:
 
-   * * - 引用计数操作是线程安全的
+   * * - 不同的 `shared_ptr` 对象可以在不同线程里同时拷贝、析构，即使它们指向同一资源
 
-   * * - 但不保证被管理对象的线程安全，需用户自行同步
+   * * - 同一个 `shared_ptr` 对象被多个线程同时修改时需要外部同步，被管理的对象也需用户自行同步
 
    * 注意事项:
 
@@ -301,101 +438,102 @@ namespace standard_con::pointer
   class shared_ptr
   {
   private:
+    template <typename, typename>
+    friend class shared_ptr;
+    template <typename>
+    friend class weak_ptr;
+    template <typename make_type, typename... construct_arguments>
+    friend shared_ptr<make_type> make_shared(construct_arguments &&...object_arguments);
     shared_ptr_type *_ptr;
-    deleter _deleter;
-    int *_shared_count;
-    std::mutex *_pmutex;
+    shared_control_block *_control_block;
     using Ref = shared_ptr_type &;
     using ptr = shared_ptr_type *;
+    shared_ptr(shared_ptr_type *ptr, shared_control_block *control_block) noexcept
+        : _ptr(ptr), _control_block(control_block) { ; }
     void release() noexcept
     {
-      _pmutex->lock();
-      bool flag = false;
-      if (--(*_shared_count) == 0 && _ptr != nullptr)
-      {
-        _deleter(_ptr);
-        _ptr = nullptr;
-        delete _shared_count;
-        _shared_count = nullptr;
-        flag = true;
-      }
-      _pmutex->unlock();
-      if (flag == true)
+      if (_control_block != nullptr)
       {
-        delete _pmutex;
-        _pmutex = nullptr;
+        _control_block->release_strong();
       }
-    }
-    void assignment(shared_ptr &deliver_value) noexcept
-    {
-      _ptr = deliver_value._ptr;
-      _shared_count = deliver_value._shared_count;
-      _pmutex = deliver_value._pmutex;
-      _deleter = deliver_value._deleter;
+      _ptr = nullptr;
+      _control_block = nullptr;
     }
 
   public:
     explicit shared_ptr(shared_ptr_type *ptr = nullptr)
-        : _deleter(deleter())
+        : _ptr(ptr), _control_block(nullptr)
     {
-      _ptr = ptr;
-      _shared_count = new int(1);
-      _pmutex = new std::mutex;
+      if (ptr == nullptr)
+      {
+        return;
+      }
+      try
+      {
+        _control_block = new pointer_control_block<shared_ptr_type, deleter>(ptr, deleter());
+      }
+      catch (...)
+      {
+        // 控制块分配失败时资源不能泄漏
+        deleter()(ptr);
+        throw;
+      }
     }
-    shared_ptr(shared_ptr &shared_ptr_data) noexcept
+    shared_ptr(const shared_ptr &shared_ptr_data) noexcept
+        : _ptr(shared_ptr_data._ptr), _control_block(shared_ptr_data._control_block)
     {
-      assignment(shared_ptr_data);
-      _pmutex->lock();
-      (*_shared_count)++;
-      _pmutex->unlock();
+      if (_control_block != nullptr)
+      {
+        _control_block->add_strong();
+      }
     }
     shared_ptr(shared_ptr &&shared_ptr_data) noexcept
+        : _ptr(shared_ptr_data._ptr), _control_block(shared_ptr_data._control_block)
     {
-      assignment(shared_ptr_data);
       shared_ptr_data._ptr = nullptr;
-      shared_ptr_data._shared_count = new int(1);
-      shared_ptr_data._pmutex = new std::mutex;
+      shared_ptr_data._control_block = nullptr;
     }
     ~shared_ptr() noexcept
     {
       release();
     }
-    shared_ptr<shared_ptr_type> &operator=(const shared_ptr &shared_ptr_data) noexcept
+    shared_ptr &operator=(const shared_ptr &shared_ptr_data) noexcept
     {
-      if (&shared_ptr_data != this)
-      {
-        if (_ptr != shared_ptr_data._ptr)
-        {
-          release();
-          assignment(shared_ptr_data);
-          _pmutex->lock();
-          (*_shared_count)++;
-          _pmutex->unlock();
-        }
-      }
+      shared_ptr temporary_ptr(shared_ptr_data);
+      swap(temporary_ptr);
       return *this;
     }
-    shared_ptr<shared_ptr_type> &operator=(shared_ptr &&shared_ptr_data) noexcept
+    shared_ptr &operator=(shared_ptr &&shared_ptr_data) noexcept
     {
       if (&shared_ptr_data != this)
       {
-        release();
-        assignment(shared_ptr_data);
-        shared_ptr_data._ptr = nullptr;
-        shared_ptr_data._shared_count = new int(1);
-        shared_ptr_data._pmutex = new std::mutex;
+        shared_ptr temporary_ptr(std::move(shared_ptr_data));
+        swap(temporary_ptr);
       }
       return *this;
     }
+    void swap(shared_ptr &shared_ptr_data) noexcept
+    {
+      shared_ptr_type *temporary_ptr = _ptr;
+      _ptr = shared_ptr_data._ptr;
+      shared_ptr_data._ptr = temporary_ptr;
+      shared_control_block *temporary_block = _control_block;
+      _control_block = shared_ptr_data._control_block;
+      shared_ptr_data._control_block = temporary_block;
+    }
+    void reset() noexcept
+    {
+      release();
+    }
     [[nodiscard]] int get_count() const noexcept
     {
-      return _shared_count ? *_shared_count : -1;
+      return _control_block ? static_cast<int>(_control_block->strong_count_get()) : 0;
     }
-    Ref operator*() noexcept
+    Ref operator*() const noexcept
     {
       return *(_ptr);
     }
-    ptr operator->() noexcept
+    ptr operator->() const noexcept
     {
       return _ptr;
     }
@@ -403,11 +541,28 @@ namespace standard_con::pointer
     {
       return _ptr;
     }
+    explicit operator bool() const noexcept
+    {
+      return _ptr != nullptr;
+    }
   };
+  /*
+   * @brief  #### `make_shared` 函数模板
+
+  *   - 用参数原地构造对象，对象和控制块放在同一次分配里，比 `shared_ptr(new T)` 少一次分配，计数和对象相邻
+
+  *   - 返回的 `shared_ptr` 使用默认的销毁方式（调用析构函数），不支持自定义删除器
+  */
+  template <typename make_type, typename... construct_arguments>
+  shared_ptr<make_type> make_shared(construct_arguments &&...object_arguments)
+  {
+    auto *control_block = new inplace_control_block<make_type>(std::forward<construct_arguments>(object_arguments)...);
+    return shared_ptr<make_type>(control_block->object_pointer(), control_block);
+  }
   /*
       * @brief  #### `weak_ptr` 类
 
-      *   - 弱引用智能指针，用于观察 `shared_ptr` 管理的资源但不增加引用计数
+      *   - 弱引用智能指针，用于观察 `shared_ptr` 管理的资源但不增加强引用计数
 
       *   - 解决 `shared_ptr` 的循环引用问题，避免资源无法释放的内存泄漏
 
@@ -419,14 +574,12 @@ namespace standard_con::pointer
 
       * * - 默认构造函数: 初始化空弱指针，不关联任何资源
 
-      * * - `explicit weak_ptr(const shared_ptr<weak_ptr_type>& weak_ptr_data)`: 从 `shared_ptr` 构造，关联其管理的资源（不增加引用计数）
+      * * - `weak_ptr(const shared_ptr<weak_ptr_type, deleter>& weak_ptr_data)`: 从 `shared_ptr` 构造，共享其控制块（只增加弱引用计数）
 
       * * - 拷贝构造函数: 复制另一个弱指针的关联关系（共享观察同一资源）
 
       * * - 移动构造函数: 转移另一个弱指针的关联关系，原指针置空
 
-      * * - 禁用从 `shared_ptr` 右值构造: 避免关联临时 `shared_ptr` 导致的悬空引用
-
       * 赋值运算符:
 
       * * - 拷贝赋值: 复制另一个弱指针的关联关系
@@ -437,110 +590,351 @@ namespace standard_con::pointer
 
       * 核心方法:
 
-      * * - `expired() const noexcept`: 检查关联的资源是否已被释放（引用计数为 0 时返回 `true`）
+      * * - `lock() const noexcept`: 资源仍然存在时返回一个共享它的 `shared_ptr`，否则返回空 `shared_ptr`
 
-      * * - `get_count() const noexcept`: 返回关联资源的当前引用计数（未关联时返回 -1）
+      * * - `expired() const noexcept`: 检查关联的资源是否已被释放（强引用计数为 0 或未关联时返回 `true`）
 
-      * * - `operator*()`: 解引用观察的对象（需先通过 `expired()` 确认资源有效）
-      *
-      * * - `operator->()`: 访问观察对象的成员（需先确认资源有效）
+      * * - `get_count() const noexcept`: 返回关联资源的当前强引用计数（未关联时返回 -1）
 
       * 资源管理:
 
-      * * - 不拥有资源所有权，不影响 `shared_ptr` 的引用计数
+      * * - 不拥有资源所有权，只持有控制块；资源销毁后控制块仍然有效，直到最后一个弱指针释放
       *
-      * * - 析构时仅重置内部指针，不涉及资源释放
-      *
-      * * - 当关联的 `shared_ptr` 引用计数归 0 时，弱指针自动变为无效状态
+      * * - 当关联资源的强引用计数归 0 时，弱指针自动变为失效状态
 
       * 详细请参考 https://github.com/Hatedatastructures/Custom-libraries/blob/main/template_container.md
 
       * 注意事项:
 
-      * * - `weak_ptr` 创建的指针的生命周期要小于 `shared_ptr`，否则会出现悬空指针，导致资源提前释放
-      *
-      * * - 使用 `operator*()` 或 `operator->()` 前必须通过 `expired()` 检查资源有效性，否则可能访问已释放内存
+      * * - 访问资源前先 `lock()`，拿到的 `shared_ptr` 在使用期间保证资源不会被释放
       *
-      * * - 不能直接通过 `weak_ptr` 管理资源生命周期，需配合 `shared_ptr` 使用
+      * * - `expired()` 返回 `false` 之后资源仍可能被其他线程释放，只能作为提示，不能代替 `lock()`
       *
       * * - 适用于观察者模式、缓存管理等需临时访问资源但不延长其生命周期的场景
-      *
-      * * - 线程安全性：内部指针操作非线程安全，多线程环境下需外部同步
   */
   template <typename weak_ptr_type>
   class weak_ptr
   {
   private:
     weak_ptr_type *_ptr;
-    pointer::shared_ptr<weak_ptr_type> *_shared_ptr;
-    using Ref = weak_ptr_type &;
-    using ptr = weak_ptr_type *;
+    shared_control_block *_control_block;
 
   public:
     weak_ptr() noexcept
-        : _ptr(nullptr), _shared_ptr(nullptr) {}
-    explicit weak_ptr(shared_ptr<weak_ptr_type> &weak_ptr_data) noexcept
-        : _ptr(weak_ptr_data.get_ptr()), _shared_ptr(&weak_ptr_data) {}
+        : _ptr(nullptr), _control_block(nullptr) {}
+    template <typename deleter>
+    weak_ptr(const shared_ptr<weak_ptr_type, deleter> &weak_ptr_data) noexcept
+        : _ptr(weak_ptr_data._ptr), _control_block(weak_ptr_data._control_block)
+    {
+      if (_control_block != nullptr)
+      {
+        _control_block->add_weak();
+      }
+    }
     weak_ptr(const weak_ptr &weak_ptr_data) noexcept
-        : _ptr(weak_ptr_data._ptr), _shared_ptr(weak_ptr_data._shared_ptr) {}
+        : _ptr(weak_ptr_data._ptr), _control_block(weak_ptr_data._control_block)
+    {
+      if (_control_block != nullptr)
+      {
+        _control_block->add_weak();
+      }
+    }
     weak_ptr(weak_ptr &&weak_ptr_data) noexcept
-        : _ptr(weak_ptr_data._ptr), _shared_ptr(weak_ptr_data._shared_ptr)
+        : _ptr(weak_ptr_data._ptr), _control_block(weak_ptr_data._control_block)
     {
       weak_ptr_data._ptr = nullptr;
-      weak_ptr_data._shared_ptr = nullptr;
+      weak_ptr_data._control_block = nullptr;
     }
-    weak_ptr(shared_ptr<weak_ptr_type> &&shared_ptr_data) = delete;
     weak_ptr &operator=(const weak_ptr &weak_ptr_data) noexcept
     {
-      if (&weak_ptr_data != this)
-      {
-        _ptr = weak_ptr_data._ptr;
-        _shared_ptr = weak_ptr_data._shared_ptr;
-      }
+      weak_ptr temporary_ptr(weak_ptr_data);
+      swap(temporary_ptr);
       return *this;
     }
     weak_ptr &operator=(weak_ptr &&weak_ptr_data) noexcept
     {
       if (&weak_ptr_data != this)
       {
-        _ptr = weak_ptr_data._ptr;
-        _shared_ptr = weak_ptr_data._shared_ptr;
-        weak_ptr_data._ptr = nullptr;
-        weak_ptr_data._shared_ptr = nullptr;
+        weak_ptr temporary_ptr(std::move(weak_ptr_data));
+        swap(temporary_ptr);
       }
       return *this;
     }
-    weak_ptr &operator=(const shared_ptr<weak_ptr_type> &shared_ptr_data) noexcept
+    template <typename deleter>
+    weak_ptr &operator=(const shared_ptr<weak_ptr_type, deleter> &shared_ptr_data) noexcept
     {
-      _ptr = shared_ptr_data.get_ptr();
-      _shared_ptr = &shared_ptr_data;
+      weak_ptr temporary_ptr(shared_ptr_data);
+      swap(temporary_ptr);
       return *this;
     }
     ~weak_ptr() noexcept
     {
-      if (_shared_ptr == nullptr)
+      if (_control_block != nullptr)
       {
-        delete _ptr;
+        _control_block->release_weak();
       }
       _ptr = nullptr;
-      _shared_ptr = nullptr;
+      _control_block = nullptr;
+    }
+    void swap(weak_ptr &weak_ptr_data) noexcept
+    {
+      weak_ptr_type *temporary_ptr = _ptr;
+      _ptr = weak_ptr_data._ptr;
+      weak_ptr_data._ptr = temporary_ptr;
+      shared_control_block *temporary_block = _control_block;
+      _control_block = weak_ptr_data._control_block;
+      weak_ptr_data._control_block = temporary_block;
+    }
+    [[nodiscard]] shared_ptr<weak_ptr_type> lock() const noexcept
+    {
+      if (_control_block != nullptr && _control_block->try_add_strong())
+      {
+        return shared_ptr<weak_ptr_type>(_ptr, _control_block);
+      }
+      return shared_ptr<weak_ptr_type>();
+    }
+    [[nodiscard]] bool expired() const noexcept
+    {
+      return _control_block == nullptr || _control_block->strong_count_get() == 0;
     }
+    [[nodiscard]] int get_count() const noexcept
+    {
+      return _control_block ? static_cast<int>(_control_block->strong_count_get()) : -1;
+    }
+  };
+  /*
+   * @brief  #### `intrusive_delete` 结构体
 
-    Ref operator*() noexcept
+  *   - `ref_counted` 默认的释放钩子：最后一个引用释放时直接 `delete` 对象
+  */
+  struct intrusive_delete
+  {
+    template <typename release_type>
+    void operator()(release_type *release_object) const noexcept
+    {
+      delete release_object;
+    }
+  };
+  /*
+   * @brief  #### `ref_counted` 类
+
+  *   - 侵入式引用计数的 CRTP 基类，计数直接放在对象里，和对象的其他字段在同一条缓存行附近
+
+  *   - 配合 `intrusive_ptr` 使用，不需要单独的控制块
+
+   * 模板参数:
+
+   * * - `derived_type`: 派生类本身（CRTP）
+
+   * * - `release_hook`: 最后一个引用释放时调用的钩子，参数为 `derived_type*`，默认为 `intrusive_delete`
+
+   *     需要把对象还回对象池时，提供一个把对象放回池里的钩子即可，池的指针可以放在对象里
+
+   * 关键方法:
+
+   * * - `add_reference()` / `release_reference()`: 原子地增减计数，由 `intrusive_ptr` 调用
+
+   * * - `reference_count_get()`: 当前引用计数
+
+   * 注意事项:
+
+   * * - 拷贝对象不会拷贝计数，新对象的计数从 0 开始
+
+   * * - 计数归 0 时对象已经交给钩子处理，之后不能再访问
+  */
+  template <typename intrusive_ptr_type>
+  class intrusive_ptr;
+  template <typename make_type, typename... construct_arguments>
+  intrusive_ptr<make_type> make_intrusive(construct_arguments &&...object_arguments);
+  template <typename derived_type, typename release_hook = intrusive_delete>
+  class ref_counted
+  {
+    template <typename make_type, typename... construct_arguments>
+    friend intrusive_ptr<make_type> make_intrusive(construct_arguments &&...object_arguments);
+    mutable std::atomic<uint64_t> reference_count;
+    void adopt_first_reference() const noexcept
+    {
+      // 刚构造、还没有共享出去的对象，第一个引用不需要原子读改写
+      reference_count.store(1, std::memory_order_relaxed);
+    }
+
+  protected:
+    ref_counted() noexcept : reference_count(0) { ; }
+    ref_counted(const ref_counted &) noexcept : reference_count(0) { ; }
+    ref_counted &operator=(const ref_counted &) noexcept
+    {
+      return *this;
+    }
+    ~ref_counted() noexcept = default;
+
+  public:
+    void add_reference() const noexcept
+    {
+      reference_count.fetch_add(1, std::memory_order_relaxed);
+    }
+    void release_reference() const noexcept
+    {
+      if (reference_count.fetch_sub(1, std::memory_order_acq_rel) == 1)
+      {
+        release_hook()(static_cast<derived_type *>(const_cast<ref_counted *>(this)));
+      }
+    }
+    [[nodiscard]] uint64_t reference_count_get() const noexcept
+    {
+      return reference_count.load(std::memory_order_acquire);
+    }
+  };
+  /*
+   * @brief  #### `intrusive_ptr` 类
+
+  *   - 侵入式智能指针：引用计数由对象自己维护（通常继承 `ref_counted`），指针本身只有一个原始指针大小
+
+  *   - 拷贝只做一次对象内的原子加法，没有控制块，也没有额外的内存分配
+
+   * 模板参数:
+
+   * * - `intrusive_ptr_type`: 管理的对象类型，需提供 `add_reference()` 和 `release_reference()` 成员函数
+
+   * 构造函数:
+
+   * * - `intrusive_ptr(intrusive_ptr_type* ptr, bool add_reference = true)`: 从原始指针构造，`add_reference` 为 `false` 时接管已有的一个引用
+
+   * * - 拷贝构造、移动构造，以及从派生类指针类型的转换构造
+
+   * 关键方法:
+
+   * * - `get_ptr()`: 返回原始指针（不释放所有权）
+
+   * * - `detach()`: 放弃所有权但不减少计数，返回原始指针
+
+   * * - `reset()` / `swap()`: 释放引用 / 交换两个指针
+
+   * 线程安全性:
+
+   * * - 与 `shared_ptr` 相同：不同的指针对象可以在不同线程里同时拷贝、析构
+  */
+  template <typename intrusive_ptr_type>
+  class intrusive_ptr
+  {
+  private:
+    template <typename>
+    friend class intrusive_ptr;
+    intrusive_ptr_type *_ptr;
+    using Ref = intrusive_ptr_type &;
+    using ptr = intrusive_ptr_type *;
+
+  public:
+    intrusive_ptr() noexcept : _ptr(nullptr) { ; }
+    intrusive_ptr(intrusive_ptr_type *ptr, const bool add_reference = true) noexcept
+        : _ptr(ptr)
+    {
+      if (_ptr != nullptr && add_reference)
+      {
+        _ptr->add_reference();
+      }
+    }
+    intrusive_ptr(const intrusive_ptr &intrusive_ptr_data) noexcept
+        : intrusive_ptr(intrusive_ptr_data._ptr) { ; }
+    intrusive_ptr(intrusive_ptr &&intrusive_ptr_data) noexcept
+        : _ptr(intrusive_ptr_data._ptr)
+    {
+      intrusive_ptr_data._ptr = nullptr;
+    }
+    template <typename other_type, typename = std::enable_if_t<std::is_convertible_v<other_type *, intrusive_ptr_type *>>>
+    intrusive_ptr(const intrusive_ptr<other_type> &intrusive_ptr_data) noexcept
+        : intrusive_ptr(static_cast<intrusive_ptr_type *>(intrusive_ptr_data._ptr)) { ; }
+    template <typename other_type, typename = std::enable_if_t<std::is_convertible_v<other_type *, intrusive_ptr_type *>>>
+    intrusive_ptr(intrusive_ptr<other_type> &&intrusive_ptr_data) noexcept
+        : _ptr(intrusive_ptr_data._ptr)
+    {
+      intrusive_ptr_data._ptr = nullptr;
+    }
+    ~intrusive_ptr() noexcept
+    {
+      if (_ptr != nullptr)
+      {
+        _ptr->release_reference();
+      }
+    }
+    intrusive_ptr &operator=(const intrusive_ptr &intrusive_ptr_data) noexcept
+    {
+      intrusive_ptr temporary_ptr(intrusive_ptr_data);
+      swap(temporary_ptr);
+      return *this;
+    }
+    intrusive_ptr &operator=(intrusive_ptr &&intrusive_ptr_data) noexcept
+    {
+      if (&intrusive_ptr_data != this)
+      {
+        intrusive_ptr temporary_ptr(std::move(intrusive_ptr_data));
+        swap(temporary_ptr);
+      }
+      return *this;
+    }
+    void swap(intrusive_ptr &intrusive_ptr_data) noexcept
+    {
+      intrusive_ptr_type *temporary_ptr = _ptr;
+      _ptr = intrusive_ptr_data._ptr;
+      intrusive_ptr_data._ptr = temporary_ptr;
+    }
+    void reset() noexcept
+    {
+      intrusive_ptr().swap(*this);
+    }
+    [[nodiscard]] intrusive_ptr_type *detach() noexcept
+    {
+      intrusive_ptr_type *detached_ptr = _ptr;
+      _ptr = nullptr;
+      return detached_ptr;
+    }
+    Ref operator*() const noexcept
     {
       return *(_ptr);
     }
-    ptr operator->() noexcept
+    ptr operator->() const noexcept
+    {
+      return _ptr;
+    }
+    ptr get_ptr() const noexcept
     {
       return _ptr;
     }
-    bool expired() const noexcept
+    explicit operator bool() const noexcept
     {
-      return _shared_ptr->get_count() == 0;
+      return _ptr != nullptr;
     }
-    int get_count() const noexcept
+    bool operator==(const intrusive_ptr &intrusive_ptr_data) const noexcept
     {
-      return _shared_ptr ? _shared_ptr->get_count() : -1;
+      return _ptr == intrusive_ptr_data._ptr;
+    }
+    bool operator!=(const intrusive_ptr &intrusive_ptr_data) const noexcept
+    {
+      return _ptr != intrusive_ptr_data._ptr;
     }
   };
-}
\ No newline at end of file
+  /*
+   * @brief  #### `make_intrusive` 函数模板
+
+  *   - 用 `new` 构造对象并返回持有一个引用的 `intrusive_ptr`
+  */
+  template <typename make_type, typename... construct_arguments>
+  intrusive_ptr<make_type> make_intrusive(construct_arguments &&...object_arguments)
+  {
+    make_type *new_object = new make_type(std::forward<construct_arguments>(object_arguments)...);
+    if constexpr (requires { new_object->adopt_first_reference(); })
+    {
+      new_object->adopt_first_reference();
+      return intrusive_ptr<make_type>(new_object, false);
+    }
+    else
+    {
+      return intrusive_ptr<make_type>(new_object);
+    }
+  }
+}
+namespace standard_con
+{
+  using pointer::intrusive_ptr;
+  using pointer::make_intrusive;
+  using pointer::ref_counted;
+}
@@ -1,5 +1,6 @@
 #pragma once
 #include "simulate_list.hpp"
+#include "simulate_ring.hpp"
 #include "simulate_vector.hpp"
 #include "simulate_algorithm.hpp"
 #include "simulate_exception.hpp"
@@ -11,13 +12,15 @@ namespace queue_adapter
 
   *   - 自定义队列容器适配器，遵循 FIFO（先进先出）原则
 
-  *   - 基于底层容器实现（默认为 `standard_con::list`），提供队列的标准操作接口
+  *   - 基于底层容器实现（默认为 `standard_con::ring_buffer`），提供队列的标准操作接口
+
+  *   - 默认底层是连续的环形缓冲区，入队出队不再逐个分配链表节点
 
    * 模板参数:
 
    * * - `queue_type`: 队列中存储的元素类型
    *
-   * * - `list_based_queue`: 底层容器类型，默认为 `standard_con::list<queue_type>`
+   * * - `ring_based_queue`: 底层容器类型，默认为 `standard_con::ring_buffer<queue_type>`
    *
    *   - 需支持 `push_back()`、`pop_front()`、`front()`、`back()`、`size()`、`empty()` 等操作
 
@@ -43,9 +46,9 @@ namespace queue_adapter
    *
    * * - `pop()`: 出队操作（移除队首元素，不返回值）
    *
-   * * - `front()`: 返回队首元素的引用（非常量版本）
+   * * - `front()`: 返回队首元素的引用（常量和非常量版本）
    *
-   * * - `back()`: 返回队尾元素的引用（非常量版本）
+   * * - `back()`: 返回队尾元素的引用（常量和非常量版本）
 
    * 容量相关方法:
 
@@ -59,7 +62,7 @@ namespace queue_adapter
 
    * 特性:
 
-   * * - 适配性: 可基于不同底层容器实现（如 list、deque 等）
+   * * - 适配性: 可基于不同底层容器实现（如 ring_buffer、list 等）
    *
    * * - 移动语义: 支持高效的资源转移
    *
@@ -73,85 +76,95 @@ namespace queue_adapter
 
    * 详细请参考 https://github.com/Hatedatastructures/Custom-libraries/blob/main/template_container.md
 */
-  template <typename queue_type, typename list_based_queue = standard_con::list<queue_type>>
+  template <typename queue_type, typename ring_based_queue = standard_con::ring_buffer<queue_type>>
   class queue
   {
-    list_based_queue list_object;
+    ring_based_queue ring_object;
 
   public:
     ~queue() { ; }
 
     void push(queue_type &&queue_type_data)
     {
-      list_object.push_back(std::forward<queue_type>(queue_type_data));
+      ring_object.push_back(std::forward<queue_type>(queue_type_data));
     }
 
     void push(const queue_type &queue_type_data)
     {
-      list_object.push_back(queue_type_data);
+      ring_object.push_back(queue_type_data);
     }
 
     void pop()
     {
-      list_object.pop_front();
+      ring_object.pop_front();
     }
 
     [[nodiscard]] uint64_t size() const noexcept
     {
-      return list_object.size();
+      return ring_object.size();
     }
 
     [[nodiscard]] bool empty() const noexcept
     {
-      return list_object.empty();
+      return ring_object.empty();
     }
 
     [[nodiscard]] queue_type &front() noexcept
     {
-      return list_object.front();
+      return ring_object.front();
     }
 
     [[nodiscard]] queue_type &back() noexcept
     {
-      return list_object.back();
+      return ring_object.back();
     }
 
-    explicit queue(const queue<queue_type> &queue_data)
+    [[nodiscard]] const queue_type &front() const noexcept
     {
-      list_object = queue_data.list_object;
+      return ring_object.front();
     }
 
-    queue(queue<queue_type> &&queue_type_data) noexcept
+    [[nodiscard]] const queue_type &back() const noexcept
+    {
+      return ring_object.back();
+    }
+
+    explicit queue(const queue &queue_data)
+    {
+      ring_object = queue_data.ring_object;
+    }
+
+    queue(queue &&queue_type_data) noexcept
     {
       // 移动构造
-      list_object = std::forward<list_based_queue>(queue_type_data.list_object);
+      ring_object = std::forward<ring_based_queue>(queue_type_data.ring_object);
     }
     queue(std::initializer_list<queue_type> queue_type_data)
     {
       // 链式构造
       for (auto &chained_values : queue_type_data)
       {
-        list_object.push_back(std::move(chained_values));
+        ring_object.push_back(std::move(chained_values));
       }
     }
     explicit queue(const queue_type &queue_type_data)
     {
-      list_object.push_back(queue_type_data);
+      ring_object.push_back(queue_type_data);
     }
     queue() = default;
-    queue &operator=(const queue<queue_type> &queue_data)
+    queue &operator=(const queue &queue_data)
     {
       if (this != &queue_data)
       {
-        list_object = queue_data.list_object;
+        ring_object = queue_data.ring_object;
       }
       return *this;
     }
-    queue &operator=(queue<queue_type> &&queue_data) noexcept
+    queue &operator=(queue &&queue_data) noexcept
     {
       if (this != &queue_data)
       {
-        list_object = std::forward<list_based_queue>(queue_data.list_object);
+        ring_object = std::forward<ring_based_queue>(queue_data.ring_object);
       }
       return *this;
     }
@@ -174,7 +187,11 @@ namespace queue_adapter
       *
       * * - `vector_based_priority_queue`: 底层容器类型，默认为 `standard_con::vector<priority_queue_type>`
       *
-      * * *   - 需支持随机访问、尾部插入删除等操作
+      * * *   - 需支持随机访问迭代器、尾部插入删除等操作
+      *
+      * * - `heap_arity`: 堆的分叉数，默认为 4
+      *
+      * * *   - 分叉越多树越矮，向下调整时同一父节点的孩子挨在一起，每层的缓存未命中更少
 
       * 构造函数:
 
@@ -212,7 +229,11 @@ namespace queue_adapter
 
       * 特性:
 
-      * * - 堆结构: 基于完全二叉树实现，确保 O(log n) 的插入和删除操作复杂度
+      * * - 堆结构: 基于完全 d 叉树实现，确保 O(log n) 的插入和删除操作复杂度
+      *
+      * * - 空位调整: 调整时先把元素取出留下空位，沿途元素只移动一次，最后放回，不做逐层交换
+      *
+      * * - 初始化列表构造自底向上建堆，O(n)
       *
       * * - 可定制性: 通过自定义比较器实现不同的优先级规则
       *
@@ -235,88 +256,122 @@ namespace queue_adapter
       * 详细请参考 https://github.com/Hatedatastructures/Custom-libraries/blob/main/template_container.md
   */
   template <typename priority_queue_type, typename container_imitate_function = standard_con::less<priority_queue_type>,
-            typename vector_based_priority_queue = standard_con::vector<priority_queue_type>>
+            typename vector_based_priority_queue = standard_con::vector<priority_queue_type>, uint64_t heap_arity = 4>
   class priority_queue
   {
+    static_assert(heap_arity >= 2, "priority_queue 的分叉数至少为 2");
     // 创建容器对象
     vector_based_priority_queue vector_container_object;
     container_imitate_function function_policy; // 仿函数：数据类型比较器，可自定义
     // 仿函数对象
 
-    void priority_queue_adjust_upwards(int adjust_upwards_child) noexcept
+    void priority_queue_adjust_upwards(uint64_t adjust_upwards_child)
     {
-      // 向上调整算法
-      int adjust_upwards_parent = (adjust_upwards_child - 1) / 2;
+      // 向上调整算法：把待调整元素取出来留一个空位，比它优先级低的父节点逐个下移，最后一次性放回
+      auto heap_data = vector_container_object.begin();
+      priority_queue_type hole_value = std::move(heap_data[adjust_upwards_child]);
       while (adjust_upwards_child > 0)
       {
-        if (function_policy(vector_container_object[adjust_upwards_parent], vector_container_object[adjust_upwards_child]))
-        {
-          standard_con::algorithm::swap(vector_container_object[adjust_upwards_parent], vector_container_object[adjust_upwards_child]);
-          adjust_upwards_child = adjust_upwards_parent;
-          adjust_upwards_parent = (adjust_upwards_child - 1) / 2;
-        }
-        else
+        const uint64_t adjust_upwards_parent = (adjust_upwards_child - 1) / heap_arity;
+        if (!function_policy(heap_data[adjust_upwards_parent], hole_value))
         {
           break;
         }
+        heap_data[adjust_upwards_child] = std::move(heap_data[adjust_upwards_parent]);
+        adjust_upwards_child = adjust_upwards_parent;
       }
+      heap_data[adjust_upwards_child] = std::move(hole_value);
     }
-    void priority_queue_adjust_downwards(int adjust_downwards_parent = 0) noexcept
+    void priority_queue_adjust_downwards(uint64_t adjust_downwards_parent = 0)
     {
-      int adjust_downwards_child = (adjust_downwards_parent * 2) + 1;
-      while (adjust_downwards_child < static_cast<int>(vector_container_object.size()))
+      // 向下调整算法：空位每次和 heap_arity 个孩子中优先级最高的比较，孩子更高就上移
+      auto heap_data = vector_container_object.begin();
+      const uint64_t heap_size = vector_container_object.size();
+      priority_queue_type hole_value = std::move(heap_data[adjust_downwards_parent]);
+      while (true)
       {
-        int adjust_downwards_left = adjust_downwards_child;
-        int adjust_downwards_right = adjust_downwards_left + 1;
-        if (adjust_downwards_right < static_cast<int>(vector_container_object.size()) &&
-            function_policy(vector_container_object[adjust_downwards_left], vector_container_object[adjust_downwards_right]))
+        const uint64_t first_child = adjust_downwards_parent * heap_arity + 1;
+        if (first_child >= heap_size)
         {
-          // 大堆找出左右节点哪个孩子大
-          adjust_downwards_child = adjust_downwards_right;
+          break;
         }
-        if (function_policy(vector_container_object[adjust_downwards_parent], vector_container_object[adjust_downwards_child]))
+        const uint64_t last_child = first_child + heap_arity < heap_size ? first_child + heap_arity : heap_size;
+        uint64_t best_child = first_child;
+        for (uint64_t child_traversal = first_child + 1; child_traversal < last_child; ++child_traversal)
         {
-          // 建大堆把小的换下去，建小堆把大的换下去
-          standard_con::algorithm::swap(vector_container_object[adjust_downwards_parent], vector_container_object[adjust_downwards_child]);
-
-          // 换完之后如果是大堆，则父亲节点是较大的值，需要更新孩子节点继续向下找比孩子节点大的值，如果有继续交换
-          adjust_downwards_parent = adjust_downwards_child;
-          adjust_downwards_child = (adjust_downwards_parent * 2) + 1;
+          if (function_policy(heap_data[best_child], heap_data[child_traversal]))
+          {
+            best_child = child_traversal;
+          }
         }
-        else
+        if (!function_policy(hole_value, heap_data[best_child]))
         {
           break;
         }
+        heap_data[adjust_downwards_parent] = std::move(heap_data[best_child]);
+        adjust_downwards_parent = best_child;
+      }
+      heap_data[adjust_downwards_parent] = std::move(hole_value);
+    }
+    void priority_queue_build()
+    {
+      // 自底向上建堆，O(n)
+      const uint64_t heap_size = vector_container_object.size();
+      if (heap_size < 2)
+      {
+        return;
+      }
+      for (uint64_t build_parent = (heap_size - 2) / heap_arity + 1; build_parent > 0; --build_parent)
+      {
+        priority_queue_adjust_downwards(build_parent - 1);
       }
     }
 
   public:
     ~priority_queue() noexcept
     {
-      vector_container_object.~vector();
+      ;
     }
     void push(const priority_queue_type &prioity_queue_type_data)
     {
       vector_container_object.push_back(prioity_queue_type_data);
-      priority_queue_adjust_upwards(static_cast<int>(vector_container_object.size() - 1));
+      priority_queue_adjust_upwards(vector_container_object.size() - 1);
+    }
+    void push(priority_queue_type &&prioity_queue_type_data)
+    {
+      vector_container_object.push_back(std::move(prioity_queue_type_data));
+      priority_queue_adjust_upwards(vector_container_object.size() - 1);
     }
     priority_queue_type &top() noexcept
     {
       return vector_container_object.front();
     }
-    bool empty() noexcept
+    const priority_queue_type &top() const noexcept
+    {
+      return vector_container_object.front();
+    }
+    [[nodiscard]] bool empty() const noexcept
     {
       return vector_container_object.empty();
     }
-    uint64_t size() noexcept
+    [[nodiscard]] uint64_t size() const noexcept
     {
       return vector_container_object.size();
     }
     void pop()
     {
-      standard_con::algorithm::swap(vector_container_object[0], vector_container_object[vector_container_object.size() - static_cast<uint64_t>(1)]);
+      // 末尾元素移到堆顶再向下调整，不做交换
+      const uint64_t heap_size = vector_container_object.size();
+      if (heap_size > 1)
+      {
+        auto heap_data = vector_container_object.begin();
+        heap_data[0] = std::move(heap_data[heap_size - 1]);
+      }
       vector_container_object.pop_back();
-      priority_queue_adjust_downwards();
+      if (heap_size > 2)
+      {
+        priority_queue_adjust_downwards();
+      }
     }
     priority_queue()
     {
@@ -324,15 +379,21 @@ namespace queue_adapter
     }
     priority_queue(std::initializer_list<priority_queue_type> lightweight_container)
     {
-      // 通过初始化列表构建一个list
+      // 先整体放入再自底向上建堆，底层容器有 reserve（如 vector）时一次预留好空间，deque 没有就直接追加
+      if constexpr (requires { vector_container_object.reserve(lightweight_container.size()); })
+      {
+        vector_container_object.reserve(lightweight_container.size());
+      }
       for (auto &chained_values : lightweight_container)
       {
-        push(std::move(chained_values));
+        vector_container_object.push_back(chained_values);
       }
+      priority_queue_build();
     }
     priority_queue(const priority_queue &priority_queue_data)
+        : function_policy(priority_queue_data.function_policy)
     {
-      // 拷贝构造
+      // 拷贝构造：比较器和元素一起拷贝，有状态的比较器才能保持原来的堆序
       vector_container_object = priority_queue_data.vector_container_object;
     }
     priority_queue(priority_queue &&priority_queue_data) noexcept
@@ -344,7 +405,6 @@ namespace queue_adapter
     explicit priority_queue(const priority_queue_type &priority_queue_type_data)
     {
       vector_container_object.push_back(priority_queue_type_data);
-      priority_queue_adjust_upwards((static_cast<int>(vector_container_object.size() - 1)));
     }
     priority_queue &operator=(priority_queue &&priority_queue_data) noexcept
     {
@@ -367,9 +427,248 @@ namespace queue_adapter
       return *this;
     }
   };
+  /*
+      * @brief  #### `indexed_priority_queue` 类模板
+
+      *   - 带句柄的 d 叉堆优先队列：`push()` 返回一个句柄，之后可以凭句柄修改优先级或删除元素
+
+      *   - 句柄到堆下标的映射随元素移动同步更新，`update_priority()` 和 `erase()` 都是 O(log n)
+
+      *   - 适合定时器、截止时间调度这类需要频繁调整已排队元素的场景
+
+      * 模板参数:
+
+      * * - `priority_queue_type`: 元素（优先级）类型
+      *
+      * * - `container_imitate_function`: 比较器类型，默认为 `standard_con::less<priority_queue_type>`，语义与 `priority_queue` 相同
+      *
+      * * - `heap_arity`: 堆的分叉数，默认为 4
+
+      * 主要操作方法:
+
+      * * - `push()`: 插入元素，返回句柄
+      *
+      * * - `top()` / `top_handle()`: 堆顶元素及其句柄
+      *
+      * * - `pop()`: 删除堆顶元素
+      *
+      * * - `update_priority(handle, value)`: 修改句柄对应元素的值并重新调整位置，句柄无效时抛出异常
+      *
+      * * - `erase(handle)`: 删除句柄对应的元素，句柄无效时返回 `false`
+      *
+      * * - `contains(handle)` / `priority(handle)`: 句柄是否有效 / 句柄对应的元素
+
+      * 注意事项:
+
+      * * - 元素被弹出或删除后句柄失效，失效的句柄会被之后的 `push()` 重新使用，不要继续持有
+      *
+      * * - 空队列调用 `top()` 或 `pop()` 为未定义行为
+  */
+  template <typename priority_queue_type, typename container_imitate_function = standard_con::less<priority_queue_type>, uint64_t heap_arity = 4>
+  class indexed_priority_queue
+  {
+    static_assert(heap_arity >= 2, "indexed_priority_queue 的分叉数至少为 2");
+
+  public:
+    using handle_type = uint64_t;
+
+  private:
+    static constexpr uint64_t invalid_position = ~static_cast<uint64_t>(0);
+    struct heap_entry
+    {
+      priority_queue_type priority_value;
+      handle_type handle;
+    };
+    standard_con::vector<heap_entry> heap_entries;
+    standard_con::vector<uint64_t> handle_position; // 句柄 -> 堆下标，失效句柄为 invalid_position
+    standard_con::vector<handle_type> free_handles; // 可复用的失效句柄
+    container_imitate_function function_policy;
+    void place_entry(heap_entry *entry_data, const uint64_t &heap_position, heap_entry &&moved_entry)
+    {
+      entry_data[heap_position] = std::move(moved_entry);
+      handle_position.begin()[entry_data[heap_position].handle] = heap_position;
+    }
+    void adjust_upwards(uint64_t heap_position)
+    {
+      heap_entry *entry_data = heap_entries.begin();
+      heap_entry hole_entry = std::move(entry_data[heap_position]);
+      while (heap_position > 0)
+      {
+        const uint64_t parent_position = (heap_position - 1) / heap_arity;
+        if (!function_policy(entry_data[parent_position].priority_value, hole_entry.priority_value))
+        {
+          break;
+        }
+        place_entry(entry_data, heap_position, std::move(entry_data[parent_position]));
+        heap_position = parent_position;
+      }
+      place_entry(entry_data, heap_position, std::move(hole_entry));
+    }
+    void adjust_downwards(uint64_t heap_position)
+    {
+      heap_entry *entry_data = heap_entries.begin();
+      const uint64_t heap_size = heap_entries.size();
+      heap_entry hole_entry = std::move(entry_data[heap_position]);
+      while (true)
+      {
+        const uint64_t first_child = heap_position * heap_arity + 1;
+        if (first_child >= heap_size)
+        {
+          break;
+        }
+        const uint64_t last_child = first_child + heap_arity < heap_size ? first_child + heap_arity : heap_size;
+        uint64_t best_child = first_child;
+        for (uint64_t child_traversal = first_child + 1; child_traversal < last_child; ++child_traversal)
+        {
+          if (function_policy(entry_data[best_child].priority_value, entry_data[child_traversal].priority_value))
+          {
+            best_child = child_traversal;
+          }
+        }
+        if (!function_policy(hole_entry.priority_value, entry_data[best_child].priority_value))
+        {
+          break;
+        }
+        place_entry(entry_data, heap_position, std::move(entry_data[best_child]));
+        heap_position = best_child;
+      }
+      place_entry(entry_data, heap_position, std::move(hole_entry));
+    }
+    void readjust(const uint64_t heap_position)
+    {
+      // 元素被替换后只可能需要往一个方向调整
+      heap_entry *entry_data = heap_entries.begin();
+      if (heap_position > 0 && function_policy(entry_data[(heap_position - 1) / heap_arity].priority_value, entry_data[heap_position].priority_value))
+      {
+        adjust_upwards(heap_position);
+      }
+      else
+      {
+        adjust_downwards(heap_position);
+      }
+    }
+    void remove_at(const uint64_t heap_position)
+    {
+      // 按值传入：heap_position 可能来自 handle_position，下面会改写它
+      // 先登记可复用句柄，申请内存失败时队列保持不变
+      heap_entry *entry_data = heap_entries.begin();
+      const handle_type removed_handle = entry_data[heap_position].handle;
+      free_handles.push_back(removed_handle);
+      handle_position.begin()[removed_handle] = invalid_position;
+      const uint64_t last_position = heap_entries.size() - 1;
+      if (heap_position != last_position)
+      {
+        place_entry(entry_data, heap_position, std::move(entry_data[last_position]));
+      }
+      heap_entries.pop_back();
+      if (heap_position < heap_entries.size())
+      {
+        readjust(heap_position);
+      }
+    }
+    void check_handle(const handle_type &handle_data, const char *function_name) const
+    {
+      try
+      {
+        if (!contains(handle_data))
+        {
+          throw custom_exception::fault("句柄无效或已失效", function_name, __LINE__);
+        }
+      }
+      catch (const custom_exception::fault &process)
+      {
+        std::cerr << process.what() << " " << process.function_name_get() << " " << process.line_number_get() << std::endl;
+        throw;
+      }
+    }
+
+  public:
+    indexed_priority_queue() { ; }
+    ~indexed_priority_queue() noexcept { ; }
+    template <typename push_value_type>
+    handle_type push(push_value_type &&push_value_data)
+    {
+      // 复用的句柄在插入成功后才从空闲表取走
+      const bool reuse_handle = !free_handles.empty();
+      handle_type new_handle = 0;
+      if (reuse_handle)
+      {
+        new_handle = free_handles.back();
+      }
+      else
+      {
+        new_handle = handle_position.size();
+        handle_position.push_back(invalid_position);
+      }
+      heap_entries.push_back(heap_entry{priority_queue_type(std::forward<push_value_type>(push_value_data)), new_handle});
+      if (reuse_handle)
+      {
+        free_handles.pop_back();
+      }
+      adjust_upwards(heap_entries.size() - 1);
+      return new_handle;
+    }
+    const priority_queue_type &top() const noexcept
+    {
+      return heap_entries.front().priority_value;
+    }
+    [[nodiscard]] handle_type top_handle() const noexcept
+    {
+      return heap_entries.front().handle;
+    }
+    void pop()
+    {
+      remove_at(0);
+    }
+    void update_priority(const handle_type &handle_data, const priority_queue_type &priority_data)
+    {
+      check_handle(handle_data, "indexed_priority_queue::update_priority");
+      const uint64_t heap_position = handle_position.begin()[handle_data];
+      heap_entries.begin()[heap_position].priority_value = priority_data;
+      readjust(heap_position);
+    }
+    bool erase(const handle_type &handle_data)
+    {
+      if (!contains(handle_data))
+      {
+        return false;
+      }
+      remove_at(handle_position.begin()[handle_data]);
+      return true;
+    }
+    [[nodiscard]] bool contains(const handle_type &handle_data) const noexcept
+    {
+      return handle_data < handle_position.size() && handle_position.begin()[handle_data] != invalid_position;
+    }
+    const priority_queue_type &priority(const handle_type &handle_data) const
+    {
+      check_handle(handle_data, "indexed_priority_queue::priority");
+      return heap_entries.begin()[handle_position.begin()[handle_data]].priority_value;
+    }
+    void reserve(const uint64_t &reserve_count)
+    {
+      heap_entries.reserve(reserve_count);
+      handle_position.reserve(reserve_count);
+    }
+    void clear() noexcept
+    {
+      heap_entries.clear();
+      handle_position.clear();
+      free_handles.clear();
+    }
+    [[nodiscard]] bool empty() const noexcept
+    {
+      return heap_entries.empty();
+    }
+    [[nodiscard]] uint64_t size() const noexcept
+    {
+      return heap_entries.size();
+    }
+  };
 }
 namespace standard_con
 {
+  using queue_adapter::indexed_priority_queue;
   using queue_adapter::priority_queue;
   using queue_adapter::queue;
 }
\ No newline at end of file
@@ -0,0 +1,1058 @@
+#pragma once
+#include <bit>
+#include <cstring>
+#include <initializer_list>
+#include <new>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+#include "simulate_algorithm.hpp"
+#include "simulate_utility.hpp"
+namespace radix_tree_container
+{
+  /*
+   * @brief  #### `radix_tree` 类模板
+
+      *   - 以字节串为键的自适应基数树（ART）：每层按键的一个字节分叉，节点按孩子数在 4 / 16 / 48 / 256 四种布局之间自动升降
+
+      *   - 只有一条出边的链被压缩成节点上的公共前缀（路径压缩），树高只和键的分叉点数量有关，与键长无关
+
+      *   - 适合路由表、域名、路径这类有大量公共前缀的键，支持精确查找、最长前缀匹配和按前缀有序遍历
+
+      * 模板参数:
+
+      * * - `radix_value`: 值类型
+
+      * 节点布局:
+
+      * * - `node4` / `node16`: 有序的字节数组加孩子数组，`node16` 在有 SSE2 时一次比较 16 个字节
+      *
+      * * - `node48`: 256 项的字节到槽位的索引表加 48 个孩子
+      *
+      * * - `node256`: 直接以字节为下标的孩子数组
+      *
+      * * - 每个内部节点内联保存前缀的前 12 个字节，更长的前缀在查找时先乐观跳过，最后与叶子中的完整键核对
+      *
+      * * - 键恰好在某个内部节点处结束时（另一个键是它的延长），叶子挂在该节点的 `terminal_leaf` 上，不需要终止符
+
+      * 主要操作方法:
+
+      * * - `push(key, value)`: 插入，键已存在时不覆盖，返回 `pair<value*, bool>`
+      *
+      * * - `pop(key)`: 删除，节点孩子数减少时降级，只剩一个孩子的节点与孩子合并前缀
+      *
+      * * - `find()` / `contains()` / `count()` / `operator[]`: 精确查找
+      *
+      * * - `longest_prefix(key)`: 返回树中是 `key` 前缀的最长键及其值，不存在时值指针为 `nullptr`
+      *
+      * * - `for_each_prefix(prefix, function)` / `for_each(function)`: 按键的字节序遍历，回调参数为 `(std::string_view, value&)`
+
+      * 注意事项:
+
+      * * - 键按字节比较，可以包含 `'\0'`
+      *
+      * * - 每个值放在单独申请的叶子里，增删其他键不会移动它，`find` 返回的指针在该键被删除前一直有效
+      *
+      * * - 遍历回调中不要修改树
+  */
+  template <typename radix_value>
+  class radix_tree
+  {
+    static constexpr uint32_t maximum_prefix = 12;
+    enum class node_kind : uint8_t
+    {
+      leaf,
+      node4,
+      node16,
+      node48,
+      node256
+    };
+    struct node_base
+    {
+      node_kind kind;
+    };
+    struct leaf_node : node_base
+    {
+      // 键的字节紧跟在叶子对象之后，与值在同一次申请里，核对键时不再多一次访存
+      uint64_t key_length;
+      radix_value value_data;
+      template <typename value_type>
+      leaf_node(const uint64_t key_length_value, value_type &&value_object)
+          : node_base{node_kind::leaf}, key_length(key_length_value), value_data(std::forward<value_type>(value_object)) { ; }
+      leaf_node(const leaf_node &) = delete;
+      leaf_node &operator=(const leaf_node &) = delete;
+      [[nodiscard]] const char *key_data() const noexcept { return reinterpret_cast<const char *>(this + 1); }
+      [[nodiscard]] std::string_view key() const noexcept { return std::string_view(key_data(), key_length); }
+    };
+    struct inner_node : node_base
+    {
+      uint16_t child_count;
+      uint32_t prefix_length;              // 压缩前缀的完整长度
+      uint8_t prefix_data[maximum_prefix]; // 前缀的前 maximum_prefix 个字节
+      leaf_node *terminal_leaf;            // 恰好在此节点结束的键
+      explicit inner_node(const node_kind kind_value) noexcept
+          : node_base{kind_value}, child_count(0), prefix_length(0), prefix_data{}, terminal_leaf(nullptr) { ; }
+    };
+    struct node4 : inner_node
+    {
+      uint8_t keys[4];
+      node_base *children[4];
+      node4() noexcept : inner_node(node_kind::node4), keys{}, children{} { ; }
+    };
+    struct node16 : inner_node
+    {
+      uint8_t keys[16];
+      node_base *children[16];
+      node16() noexcept : inner_node(node_kind::node16), keys{}, children{} { ; }
+    };
+    struct node48 : inner_node
+    {
+      uint8_t child_index[256]; // 0 表示没有孩子，否则为槽位下标 + 1
+      node_base *children[48];
+      node48() noexcept : inner_node(node_kind::node48), child_index{}, children{} { ; }
+    };
+    struct node256 : inner_node
+    {
+      node_base *children[256];
+      node256() noexcept : inner_node(node_kind::node256), children{} { ; }
+    };
+    node_base *_root;
+    uint64_t _size;
+
+    static_assert(alignof(leaf_node) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__, "radix_tree 的值类型不能超过默认的 new 对齐");
+    template <typename value_type>
+    static leaf_node *create_leaf(const std::string_view key_view, value_type &&value_object)
+    {
+      void *leaf_memory = ::operator new(sizeof(leaf_node) + key_view.size());
+      leaf_node *leaf_data = nullptr;
+      try
+      {
+        leaf_data = ::new (leaf_memory) leaf_node(key_view.size(), std::forward<value_type>(value_object));
+      }
+      catch (...)
+      {
+        ::operator delete(leaf_memory);
+        throw;
+      }
+      if (!key_view.empty())
+      {
+        std::memcpy(static_cast<void *>(leaf_data + 1), key_view.data(), key_view.size());
+      }
+      return leaf_data;
+    }
+    static void destroy_leaf(leaf_node *leaf_data) noexcept
+    {
+      leaf_data->~leaf_node();
+      ::operator delete(static_cast<void *>(leaf_data));
+    }
+
+    static void copy_header(inner_node *destination_node, const inner_node *source_node) noexcept
+    {
+      destination_node->child_count = source_node->child_count;
+      destination_node->prefix_length = source_node->prefix_length;
+      std::memcpy(destination_node->prefix_data, source_node->prefix_data, maximum_prefix);
+      destination_node->terminal_leaf = source_node->terminal_leaf;
+    }
+    static void destroy_inner_shell(inner_node *inner_data) noexcept
+    {
+      // 只释放节点本身，不动孩子和终止叶子
+      switch (inner_data->kind)
+      {
+      case node_kind::node4:
+        delete static_cast<node4 *>(inner_data);
+        break;
+      case node_kind::node16:
+        delete static_cast<node16 *>(inner_data);
+        break;
+      case node_kind::node48:
+        delete static_cast<node48 *>(inner_data);
+        break;
+      default:
+        delete static_cast<node256 *>(inner_data);
+        break;
+      }
+    }
+    static void destroy_node(node_base *node_data) noexcept
+    {
+      if (node_data->kind == node_kind::leaf)
+      {
+        destroy_leaf(static_cast<leaf_node *>(node_data));
+        return;
+      }
+      inner_node *inner_data = static_cast<inner_node *>(node_data);
+      if (inner_data->terminal_leaf != nullptr)
+      {
+        destroy_leaf(inner_data->terminal_leaf);
+      }
+      for_each_child(inner_data, [](const uint8_t, node_base *child_node)
+                     { destroy_node(child_node); });
+      destroy_inner_shell(inner_data);
+    }
+    template <typename child_function>
+    static void for_each_child(inner_node *inner_data, child_function &&function_object)
+    {
+      // 按字节从小到大访问孩子
+      switch (inner_data->kind)
+      {
+      case node_kind::node4:
+      {
+        node4 *node_data = static_cast<node4 *>(inner_data);
+        for (uint16_t child_position = 0; child_position < node_data->child_count; ++child_position)
+        {
+          function_object(node_data->keys[child_position], node_data->children[child_position]);
+        }
+        break;
+      }
+      case node_kind::node16:
+      {
+        node16 *node_data = static_cast<node16 *>(inner_data);
+        for (uint16_t child_position = 0; child_position < node_data->child_count; ++child_position)
+        {
+          function_object(node_data->keys[child_position], node_data->children[child_position]);
+        }
+        break;
+      }
+      case node_kind::node48:
+      {
+        node48 *node_data = static_cast<node48 *>(inner_data);
+        for (uint32_t byte_value = 0; byte_value < 256; ++byte_value)
+        {
+          if (node_data->child_index[byte_value] != 0)
+          {
+            function_object(static_cast<uint8_t>(byte_value), node_data->children[node_data->child_index[byte_value] - 1]);
+          }
+        }
+        break;
+      }
+      default:
+      {
+        node256 *node_data = static_cast<node256 *>(inner_data);
+        for (uint32_t byte_value = 0; byte_value < 256; ++byte_value)
+        {
+          if (node_data->children[byte_value] != nullptr)
+          {
+            function_object(static_cast<uint8_t>(byte_value), node_data->children[byte_value]);
+          }
+        }
+        break;
+      }
+      }
+    }
+    static node_base **find_child(inner_node *inner_data, const uint8_t byte_value) noexcept
+    {
+      switch (inner_data->kind)
+      {
+      case node_kind::node4:
+      {
+        node4 *node_data = static_cast<node4 *>(inner_data);
+        for (uint16_t child_position = 0; child_position < node_data->child_count; ++child_position)
+        {
+          if (node_data->keys[child_position] == byte_value)
+          {
+            return &node_data->children[child_position];
+          }
+        }
+        return nullptr;
+      }
+      case node_kind::node16:
+      {
+        node16 *node_data = static_cast<node16 *>(inner_data);
+#if defined(__SSE2__)
+        const __m128i compare_result = _mm_cmpeq_epi8(_mm_set1_epi8(static_cast<char>(byte_value)),
+                                                      _mm_loadu_si128(reinterpret_cast<const __m128i *>(node_data->keys)));
+        const uint32_t match_mask = static_cast<uint32_t>(_mm_movemask_epi8(compare_result)) & ((1U << node_data->child_count) - 1);
+        return match_mask != 0 ? &node_data->children[std::countr_zero(match_mask)] : nullptr;
+#else
+        for (uint16_t child_position = 0; child_position < node_data->child_count; ++child_position)
+        {
+          if (node_data->keys[child_position] == byte_value)
+          {
+            return &node_data->children[child_position];
+          }
+        }
+        return nullptr;
+#endif
+      }
+      case node_kind::node48:
+      {
+        node48 *node_data = static_cast<node48 *>(inner_data);
+        const uint8_t slot_index = node_data->child_index[byte_value];
+        return slot_index != 0 ? &node_data->children[slot_index - 1] : nullptr;
+      }
+      default:
+      {
+        node256 *node_data = static_cast<node256 *>(inner_data);
+        return node_data->children[byte_value] != nullptr ? &node_data->children[byte_value] : nullptr;
+      }
+      }
+    }
+    template <typename small_node>
+    static void sorted_insert(small_node *node_data, const uint8_t byte_value, node_base *child_node) noexcept
+    {
+      uint16_t insert_position = node_data->child_count;
+      while (insert_position > 0 && node_data->keys[insert_position - 1] > byte_value)
+      {
+        node_data->keys[insert_position] = node_data->keys[insert_position - 1];
+        node_data->children[insert_position] = node_data->children[insert_position - 1];
+        --insert_position;
+      }
+      node_data->keys[insert_position] = byte_value;
+      node_data->children[insert_position] = child_node;
+      ++node_data->child_count;
+    }
+    template <typename small_node>
+    static void sorted_erase(small_node *node_data, const uint8_t byte_value) noexcept
+    {
+      uint16_t erase_position = 0;
+      while (node_data->keys[erase_position] != byte_value)
+      {
+        ++erase_position;
+      }
+      for (; erase_position + 1 < node_data->child_count; ++erase_position)
+      {
+        node_data->keys[erase_position] = node_data->keys[erase_position + 1];
+        node_data->children[erase_position] = node_data->children[erase_position + 1];
+      }
+      --node_data->child_count;
+    }
+    static void add_child(node_base *&node_reference, const uint8_t byte_value, node_base *child_node)
+    {
+      // 节点满时先换成更大的布局；新节点申请失败时原节点保持不变
+      inner_node *inner_data = static_cast<inner_node *>(node_reference);
+      switch (inner_data->kind)
+      {
+      case node_kind::node4:
+      {
+        node4 *node_data = static_cast<node4 *>(inner_data);
+        if (node_data->child_count < 4)
+        {
+          sorted_insert(node_data, byte_value, child_node);
+          return;
+        }
+        node16 *grown_node = new node16;
+        copy_header(grown_node, node_data);
+        std::memcpy(grown_node->keys, node_data->keys, 4);
+        std::memcpy(grown_node->children, node_data->children, 4 * sizeof(node_base *));
+        delete node_data;
+        node_reference = grown_node;
+        sorted_insert(grown_node, byte_value, child_node);
+        return;
+      }
+      case node_kind::node16:
+      {
+        node16 *node_data = static_cast<node16 *>(inner_data);
+        if (node_data->child_count < 16)
+        {
+          sorted_insert(node_data, byte_value, child_node);
+          return;
+        }
+        node48 *grown_node = new node48;
+        copy_header(grown_node, node_data);
+        for (uint16_t child_position = 0; child_position < 16; ++child_position)
+        {
+          grown_node->child_index[node_data->keys[child_position]] = static_cast<uint8_t>(child_position + 1);
+          grown_node->children[child_position] = node_data->children[child_position];
+        }
+        delete node_data;
+        node_reference = grown_node;
+        grown_node->child_index[byte_value] = 17;
+        grown_node->children[16] = child_node;
+        ++grown_node->child_count;
+        return;
+      }
+      case node_kind::node48:
+      {
+        node48 *node_data = static_cast<node48 *>(inner_data);
+        if (node_data->child_count < 48)
+        {
+          uint8_t free_slot = 0;
+          while (node_data->children[free_slot] != nullptr)
+          {
+            ++free_slot;
+          }
+          node_data->child_index[byte_value] = static_cast<uint8_t>(free_slot + 1);
+          node_data->children[free_slot] = child_node;
+          ++node_data->child_count;
+          return;
+        }
+        node256 *grown_node = new node256;
+        copy_header(grown_node, node_data);
+        for (uint32_t index_byte = 0; index_byte < 256; ++index_byte)
+        {
+          if (node_data->child_index[index_byte] != 0)
+          {
+            grown_node->children[index_byte] = node_data->children[node_data->child_index[index_byte] - 1];
+          }
+        }
+        delete node_data;
+        node_reference = grown_node;
+        grown_node->children[byte_value] = child_node;
+        ++grown_node->child_count;
+        return;
+      }
+      default:
+      {
+        node256 *node_data = static_cast<node256 *>(inner_data);
+        node_data->children[byte_value] = child_node;
+        ++node_data->child_count;
+        return;
+      }
+      }
+    }
+    static void remove_child(node_base *&node_reference, const uint8_t byte_value) noexcept
+    {
+      // 孩子数降到阈值时换成更小的布局，阈值比升级点低一些，避免在边界上反复升降；降级失败时保留原布局
+      inner_node *inner_data = static_cast<inner_node *>(node_reference);
+      switch (inner_data->kind)
+      {
+      case node_kind::node4:
+        sorted_erase(static_cast<node4 *>(inner_data), byte_value);
+        return;
+      case node_kind::node16:
+      {
+        node16 *node_data = static_cast<node16 *>(inner_data);
+        sorted_erase(node_data, byte_value);
+        if (node_data->child_count > 3)
+        {
+          return;
+        }
+        node4 *shrunk_node = new (std::nothrow) node4;
+        if (shrunk_node == nullptr)
+        {
+          return;
+        }
+        copy_header(shrunk_node, node_data);
+        std::memcpy(shrunk_node->keys, node_data->keys, node_data->child_count);
+        std::memcpy(shrunk_node->children, node_data->children, node_data->child_count * sizeof(node_base *));
+        delete node_data;
+        node_reference = shrunk_node;
+        return;
+      }
+      case node_kind::node48:
+      {
+        node48 *node_data = static_cast<node48 *>(inner_data);
+        node_data->children[node_data->child_index[byte_value] - 1] = nullptr;
+        node_data->child_index[byte_value] = 0;
+        --node_data->child_count;
+        if (node_data->child_count > 12)
+        {
+          return;
+        }
+        node16 *shrunk_node = new (std::nothrow) node16;
+        if (shrunk_node == nullptr)
+        {
+          return;
+        }
+        copy_header(shrunk_node, node_data);
+        uint16_t child_position = 0;
+        for (uint32_t index_byte = 0; index_byte < 256; ++index_byte)
+        {
+          if (node_data->child_index[index_byte] != 0)
+          {
+            shrunk_node->keys[child_position] = static_cast<uint8_t>(index_byte);
+            shrunk_node->children[child_position] = node_data->children[node_data->child_index[index_byte] - 1];
+            ++child_position;
+          }
+        }
+        delete node_data;
+        node_reference = shrunk_node;
+        return;
+      }
+      default:
+      {
+        node256 *node_data = static_cast<node256 *>(inner_data);
+        node_data->children[byte_value] = nullptr;
+        --node_data->child_count;
+        if (node_data->child_count > 37)
+        {
+          return;
+        }
+        node48 *shrunk_node = new (std::nothrow) node48;
+        if (shrunk_node == nullptr)
+        {
+          return;
+        }
+        copy_header(shrunk_node, node_data);
+        uint8_t slot_position = 0;
+        for (uint32_t index_byte = 0; index_byte < 256; ++index_byte)
+        {
+          if (node_data->children[index_byte] != nullptr)
+          {
+            shrunk_node->child_index[index_byte] = static_cast<uint8_t>(slot_position + 1);
+            shrunk_node->children[slot_position] = node_data->children[index_byte];
+            ++slot_position;
+          }
+        }
+        delete node_data;
+        node_reference = shrunk_node;
+        return;
+      }
+      }
+    }
+    static void collapse(node_base *&node_reference) noexcept
+    {
+      // 删除后只剩一个分支的内部节点被它唯一的孩子或终止叶子取代
+      inner_node *inner_data = static_cast<inner_node *>(node_reference);
+      if (inner_data->child_count + (inner_data->terminal_leaf != nullptr ? 1 : 0) > 1)
+      {
+        return;
+      }
+      if (inner_data->child_count == 0)
+      {
+        node_reference = inner_data->terminal_leaf;
+        destroy_inner_shell(inner_data);
+        return;
+      }
+      uint8_t edge_byte = 0;
+      node_base *only_child = nullptr;
+      for_each_child(inner_data, [&edge_byte, &only_child](const uint8_t byte_value, node_base *child_node)
+                     {
+                       edge_byte = byte_value;
+                       only_child = child_node;
+                     });
+      if (only_child->kind != node_kind::leaf)
+      {
+        // 父前缀 + 边上的字节 + 子前缀拼成新的前缀，只需要保留前 maximum_prefix 个字节
+        inner_node *child_inner = static_cast<inner_node *>(only_child);
+        uint8_t merged_prefix[maximum_prefix];
+        uint32_t merged_stored = inner_data->prefix_length < maximum_prefix ? inner_data->prefix_length : maximum_prefix;
+        std::memcpy(merged_prefix, inner_data->prefix_data, merged_stored);
+        if (merged_stored < maximum_prefix)
+        {
+          merged_prefix[merged_stored++] = edge_byte;
+        }
+        const uint32_t child_stored = child_inner->prefix_length < maximum_prefix ? child_inner->prefix_length : maximum_prefix;
+        for (uint32_t copy_position = 0; merged_stored < maximum_prefix && copy_position < child_stored; ++copy_position)
+        {
+          merged_prefix[merged_stored++] = child_inner->prefix_data[copy_position];
+        }
+        child_inner->prefix_length += inner_data->prefix_length + 1;
+        std::memcpy(child_inner->prefix_data, merged_prefix, merged_stored);
+      }
+      node_reference = only_child;
+      destroy_inner_shell(inner_data);
+    }
+    static const leaf_node *minimum_leaf(const node_base *node_data) noexcept
+    {
+      while (node_data->kind != node_kind::leaf)
+      {
+        inner_node *inner_data = const_cast<inner_node *>(static_cast<const inner_node *>(node_data));
+        if (inner_data->terminal_leaf != nullptr)
+        {
+          return inner_data->terminal_leaf;
+        }
+        switch (inner_data->kind)
+        {
+        case node_kind::node4:
+          node_data = static_cast<node4 *>(inner_data)->children[0];
+          break;
+        case node_kind::node16:
+          node_data = static_cast<node16 *>(inner_data)->children[0];
+          break;
+        case node_kind::node48:
+        {
+          node48 *node48_data = static_cast<node48 *>(inner_data);
+          uint32_t index_byte = 0;
+          while (node48_data->child_index[index_byte] == 0)
+          {
+            ++index_byte;
+          }
+          node_data = node48_data->children[node48_data->child_index[index_byte] - 1];
+          break;
+        }
+        default:
+        {
+          node256 *node256_data = static_cast<node256 *>(inner_data);
+          uint32_t index_byte = 0;
+          while (node256_data->children[index_byte] == nullptr)
+          {
+            ++index_byte;
+          }
+          node_data = node256_data->children[index_byte];
+          break;
+        }
+        }
+      }
+      return static_cast<const leaf_node *>(node_data);
+    }
+    static uint64_t prefix_mismatch(const inner_node *inner_data, const std::string_view key_view, const uint64_t depth) noexcept
+    {
+      // 返回前缀中第一个与键不同的位置；键先结束时返回剩余的键长。超出内联部分的前缀与子树最小叶子的键比较
+      const uint64_t remaining_length = key_view.size() - depth;
+      const uint64_t compare_limit = inner_data->prefix_length < remaining_length ? inner_data->prefix_length : remaining_length;
+      const uint64_t stored_limit = compare_limit < maximum_prefix ? compare_limit : maximum_prefix;
+      for (uint64_t compare_position = 0; compare_position < stored_limit; ++compare_position)
+      {
+        if (inner_data->prefix_data[compare_position] != static_cast<uint8_t>(key_view[depth + compare_position]))
+        {
+          return compare_position;
+        }
+      }
+      if (compare_limit > maximum_prefix)
+      {
+        const std::string_view leaf_key = minimum_leaf(inner_data)->key();
+        for (uint64_t compare_position = maximum_prefix; compare_position < compare_limit; ++compare_position)
+        {
+          if (leaf_key[depth + compare_position] != key_view[depth + compare_position])
+          {
+            return compare_position;
+          }
+        }
+      }
+      return compare_limit;
+    }
+    static bool optimistic_prefix(const inner_node *inner_data, const std::string_view key_view, const uint64_t depth) noexcept
+    {
+      // 只比较内联的前缀字节，其余部分留给最终的叶子核对
+      if (key_view.size() - depth < inner_data->prefix_length)
+      {
+        return false;
+      }
+      const uint32_t stored_limit = inner_data->prefix_length < maximum_prefix ? inner_data->prefix_length : maximum_prefix;
+      return std::memcmp(inner_data->prefix_data, key_view.data() + depth, stored_limit) == 0;
+    }
+    template <typename value_function>
+    static void visit(node_base *node_data, value_function &function_object)
+    {
+      if (node_data->kind == node_kind::leaf)
+      {
+        leaf_node *leaf_data = static_cast<leaf_node *>(node_data);
+        function_object(leaf_data->key(), leaf_data->value_data);
+        return;
+      }
+      inner_node *inner_data = static_cast<inner_node *>(node_data);
+      if (inner_data->terminal_leaf != nullptr)
+      {
+        function_object(inner_data->terminal_leaf->key(), inner_data->terminal_leaf->value_data);
+      }
+      for_each_child(inner_data, [&function_object](const uint8_t, node_base *child_node)
+                     { visit(child_node, function_object); });
+    }
+    static void attach_leaf(node4 *node_data, leaf_node *leaf_data, const uint64_t depth) noexcept
+    {
+      if (leaf_data->key_length == depth)
+      {
+        node_data->terminal_leaf = leaf_data;
+      }
+      else
+      {
+        sorted_insert(node_data, static_cast<uint8_t>(leaf_data->key_data()[depth]), leaf_data);
+      }
+    }
+    template <typename value_type>
+    standard_con::pair<radix_value *, bool> insert_value(const std::string_view key_view, value_type &&value_object)
+    {
+      node_base **node_slot = &_root;
+      uint64_t depth = 0;
+      while (true)
+      {
+        node_base *node_data = *node_slot;
+        if (node_data == nullptr)
+        {
+          leaf_node *new_leaf = create_leaf(key_view, std::forward<value_type>(value_object));
+          *node_slot = new_leaf;
+          ++_size;
+          return standard_con::pair<radix_value *, bool>(&new_leaf->value_data, true);
+        }
+        if (node_data->kind == node_kind::leaf)
+        {
+          leaf_node *existing_leaf = static_cast<leaf_node *>(node_data);
+          const std::string_view existing_key = existing_leaf->key();
+          if (existing_key == key_view)
+          {
+            return standard_con::pair<radix_value *, bool>(&existing_leaf->value_data, false);
+          }
+          // 叶子分裂：两个键从 depth 起的公共部分成为新节点的前缀
+          uint64_t common_end = depth;
+          const uint64_t shorter_length = existing_key.size() < key_view.size() ? existing_key.size() : key_view.size();
+          while (common_end < shorter_length && existing_key[common_end] == key_view[common_end])
+          {
+            ++common_end;
+          }
+          leaf_node *new_leaf = create_leaf(key_view, std::forward<value_type>(value_object));
+          node4 *split_node = new (std::nothrow) node4;
+          if (split_node == nullptr)
+          {
+            destroy_leaf(new_leaf);
+            throw std::bad_alloc();
+          }
+          split_node->prefix_length = static_cast<uint32_t>(common_end - depth);
+          std::memcpy(split_node->prefix_data, key_view.data() + depth, split_node->prefix_length < maximum_prefix ? split_node->prefix_length : maximum_prefix);
+          attach_leaf(split_node, existing_leaf, common_end);
+          attach_leaf(split_node, new_leaf, common_end);
+          *node_slot = split_node;
+          ++_size;
+          return standard_con::pair<radix_value *, bool>(&new_leaf->value_data, true);
+        }
+        inner_node *inner_data = static_cast<inner_node *>(node_data);
+        if (inner_data->prefix_length != 0)
+        {
+          const uint64_t mismatch_position = prefix_mismatch(inner_data, key_view, depth);
+          if (mismatch_position < inner_data->prefix_length)
+          {
+            // 前缀分裂：新节点取前缀中相同的部分，原节点保留分叉字节之后的部分
+            leaf_node *new_leaf = create_leaf(key_view, std::forward<value_type>(value_object));
+            node4 *split_node = new (std::nothrow) node4;
+            if (split_node == nullptr)
+            {
+              destroy_leaf(new_leaf);
+              throw std::bad_alloc();
+            }
+            split_node->prefix_length = static_cast<uint32_t>(mismatch_position);
+            std::memcpy(split_node->prefix_data, inner_data->prefix_data, mismatch_position < maximum_prefix ? mismatch_position : maximum_prefix);
+            const uint32_t remaining_prefix = static_cast<uint32_t>(inner_data->prefix_length - mismatch_position - 1);
+            uint8_t edge_byte = 0;
+            if (inner_data->prefix_length <= maximum_prefix)
+            {
+              edge_byte = inner_data->prefix_data[mismatch_position];
+              std::memmove(inner_data->prefix_data, inner_data->prefix_data + mismatch_position + 1, remaining_prefix);
+            }
+            else
+            {
+              const std::string_view leaf_key = minimum_leaf(inner_data)->key();
+              edge_byte = static_cast<uint8_t>(leaf_key[depth + mismatch_position]);
+              std::memcpy(inner_data->prefix_data, leaf_key.data() + depth + mismatch_position + 1, remaining_prefix < maximum_prefix ? remaining_prefix : maximum_prefix);
+            }
+            inner_data->prefix_length = remaining_prefix;
+            sorted_insert(split_node, edge_byte, inner_data);
+            attach_leaf(split_node, new_leaf, depth + mismatch_position);
+            *node_slot = split_node;
+            ++_size;
+            return standard_con::pair<radix_value *, bool>(&new_leaf->value_data, true);
+          }
+          depth += inner_data->prefix_length;
+        }
+        if (depth == key_view.size())
+        {
+          if (inner_data->terminal_leaf != nullptr)
+          {
+            return standard_con::pair<radix_value *, bool>(&inner_data->terminal_leaf->value_data, false);
+          }
+          inner_data->terminal_leaf = create_leaf(key_view, std::forward<value_type>(value_object));
+          ++_size;
+          return standard_con::pair<radix_value *, bool>(&inner_data->terminal_leaf->value_data, true);
+        }
+        const uint8_t byte_value = static_cast<uint8_t>(key_view[depth]);
+        node_base **child_slot = find_child(inner_data, byte_value);
+        if (child_slot != nullptr)
+        {
+          node_slot = child_slot;
+          ++depth;
+          continue;
+        }
+        leaf_node *new_leaf = create_leaf(key_view, std::forward<value_type>(value_object));
+        try
+        {
+          add_child(*node_slot, byte_value, new_leaf);
+        }
+        catch (...)
+        {
+          destroy_leaf(new_leaf);
+          throw;
+        }
+        ++_size;
+        return standard_con::pair<radix_value *, bool>(&new_leaf->value_data, true);
+      }
+    }
+    leaf_node *find_leaf(const std::string_view key_view) const noexcept
+    {
+      node_base *node_data = _root;
+      uint64_t depth = 0;
+      while (node_data != nullptr)
+      {
+        if (node_data->kind == node_kind::leaf)
+        {
+          leaf_node *leaf_data = static_cast<leaf_node *>(node_data);
+          return leaf_data->key() == key_view ? leaf_data : nullptr;
+        }
+        inner_node *inner_data = static_cast<inner_node *>(node_data);
+        if (!optimistic_prefix(inner_data, key_view, depth))
+        {
+          return nullptr;
+        }
+        depth += inner_data->prefix_length;
+        if (depth == key_view.size())
+        {
+          leaf_node *leaf_data = inner_data->terminal_leaf;
+          return leaf_data != nullptr && leaf_data->key() == key_view ? leaf_data : nullptr;
+        }
+        node_base **child_slot = find_child(inner_data, static_cast<uint8_t>(key_view[depth]));
+        if (child_slot == nullptr)
+        {
+          return nullptr;
+        }
+        node_data = *child_slot;
+        ++depth;
+      }
+      return nullptr;
+    }
+    leaf_node *longest_prefix_leaf(const std::string_view key_view) const noexcept
+    {
+      // 沿路径逐段精确核对前缀，最后一个经过的终止叶子即为最长匹配
+      leaf_node *best_leaf = nullptr;
+      node_base *node_data = _root;
+      uint64_t depth = 0;
+      while (node_data != nullptr)
+      {
+        if (node_data->kind == node_kind::leaf)
+        {
+          leaf_node *leaf_data = static_cast<leaf_node *>(node_data);
+          if (key_view.starts_with(leaf_data->key()))
+          {
+            best_leaf = leaf_data;
+          }
+          break;
+        }
+        inner_node *inner_data = static_cast<inner_node *>(node_data);
+        if (inner_data->prefix_length != 0 && prefix_mismatch(inner_data, key_view, depth) != inner_data->prefix_length)
+        {
+          break;
+        }
+        depth += inner_data->prefix_length;
+        if (inner_data->terminal_leaf != nullptr)
+        {
+          best_leaf = inner_data->terminal_leaf;
+        }
+        if (depth == key_view.size())
+        {
+          break;
+        }
+        node_base **child_slot = find_child(inner_data, static_cast<uint8_t>(key_view[depth]));
+        if (child_slot == nullptr)
+        {
+          break;
+        }
+        node_data = *child_slot;
+        ++depth;
+      }
+      return best_leaf;
+    }
+    node_base *prefix_subtree(const std::string_view prefix_view) const noexcept
+    {
+      // 返回键都以 prefix_view 开头的最小子树；根为叶子时由调用方再核对
+      node_base *node_data = _root;
+      uint64_t depth = 0;
+      while (node_data != nullptr)
+      {
+        if (node_data->kind == node_kind::leaf)
+        {
+          return static_cast<leaf_node *>(node_data)->key().starts_with(prefix_view) ? node_data : nullptr;
+        }
+        inner_node *inner_data = static_cast<inner_node *>(node_data);
+        const uint64_t mismatch_position = prefix_mismatch(inner_data, prefix_view, depth);
+        if (mismatch_position < inner_data->prefix_length)
+        {
+          // 前缀在节点的压缩前缀中途结束时整棵子树都匹配
+          return depth + mismatch_position == prefix_view.size() ? node_data : nullptr;
+        }
+        depth += inner_data->prefix_length;
+        if (depth == prefix_view.size())
+        {
+          return node_data;
+        }
+        node_base **child_slot = find_child(inner_data, static_cast<uint8_t>(prefix_view[depth]));
+        if (child_slot == nullptr)
+        {
+          return nullptr;
+        }
+        node_data = *child_slot;
+        ++depth;
+      }
+      return nullptr;
+    }
+
+  public:
+    using value_type = radix_value;
+    using return_pair_value = standard_con::pair<radix_value *, bool>;
+    using match_pair_value = standard_con::pair<std::string_view, radix_value *>;
+    radix_tree() noexcept : _root(nullptr), _size(0) { ; }
+    radix_tree(const radix_tree &radix_tree_data)
+        : radix_tree()
+    {
+      // 委托构造已完成，中途抛异常时析构函数会回收已插入的部分
+      radix_tree_data.for_each([this](const std::string_view key_view, const radix_value &value_data)
+                               { insert_value(key_view, value_data); });
+    }
+    radix_tree(radix_tree &&radix_tree_data) noexcept
+        : _root(radix_tree_data._root), _size(radix_tree_data._size)
+    {
+      radix_tree_data._root = nullptr;
+      radix_tree_data._size = 0;
+    }
+    radix_tree(std::initializer_list<standard_con::pair<std::string_view, radix_value>> lightweight_container)
+        : radix_tree()
+    {
+      for (auto &chained_values : lightweight_container)
+      {
+        insert_value(chained_values.first, chained_values.second);
+      }
+    }
+    ~radix_tree() noexcept
+    {
+      clear();
+    }
+    radix_tree &operator=(const radix_tree &radix_tree_data)
+    {
+      if (this != &radix_tree_data)
+      {
+        radix_tree temporary_tree(radix_tree_data);
+        swap(temporary_tree);
+      }
+      return *this;
+    }
+    radix_tree &operator=(radix_tree &&radix_tree_data) noexcept
+    {
+      if (this != &radix_tree_data)
+      {
+        radix_tree temporary_tree(std::move(radix_tree_data));
+        swap(temporary_tree);
+      }
+      return *this;
+    }
+    void swap(radix_tree &radix_tree_data) noexcept
+    {
+      standard_con::algorithm::swap(_root, radix_tree_data._root);
+      standard_con::algorithm::swap(_size, radix_tree_data._size);
+    }
+    void clear() noexcept
+    {
+      if (_root != nullptr)
+      {
+        destroy_node(_root);
+      }
+      _root = nullptr;
+      _size = 0;
+    }
+    [[nodiscard]] uint64_t size() const noexcept { return _size; }
+
+    [[nodiscard]] bool empty() const noexcept { return _size == 0; }
+
+    return_pair_value push(const std::string_view key_view, const radix_value &value_data) { return insert_value(key_view, value_data); }
+
+    return_pair_value push(const std::string_view key_view, radix_value &&value_data) { return insert_value(key_view, std::move(value_data)); }
+
+    radix_value &operator[](const std::string_view key_view)
+    {
+      leaf_node *leaf_data = find_leaf(key_view);
+      return leaf_data != nullptr ? leaf_data->value_data : *insert_value(key_view, radix_value()).first;
+    }
+    bool pop(const std::string_view key_view)
+    {
+      node_base **node_slot = &_root;
+      uint64_t depth = 0;
+      while (*node_slot != nullptr)
+      {
+        node_base *node_data = *node_slot;
+        if (node_data->kind == node_kind::leaf)
+        {
+          // 只有根本身是叶子时才会走到这里，其余叶子在父节点一层处理
+          if (static_cast<leaf_node *>(node_data)->key() != key_view)
+          {
+            return false;
+          }
+          destroy_leaf(static_cast<leaf_node *>(node_data));
+          *node_slot = nullptr;
+          --_size;
+          return true;
+        }
+        inner_node *inner_data = static_cast<inner_node *>(node_data);
+        if (!optimistic_prefix(inner_data, key_view, depth))
+        {
+          return false;
+        }
+        depth += inner_data->prefix_length;
+        if (depth == key_view.size())
+        {
+          leaf_node *leaf_data = inner_data->terminal_leaf;
+          if (leaf_data == nullptr || leaf_data->key() != key_view)
+          {
+            return false;
+          }
+          destroy_leaf(leaf_data);
+          inner_data->terminal_leaf = nullptr;
+          --_size;
+          collapse(*node_slot);
+          return true;
+        }
+        const uint8_t byte_value = static_cast<uint8_t>(key_view[depth]);
+        node_base **child_slot = find_child(inner_data, byte_value);
+        if (child_slot == nullptr)
+        {
+          return false;
+        }
+        if ((*child_slot)->kind == node_kind::leaf)
+        {
+          leaf_node *leaf_data = static_cast<leaf_node *>(*child_slot);
+          if (leaf_data->key() != key_view)
+          {
+            return false;
+          }
+          remove_child(*node_slot, byte_value);
+          destroy_leaf(leaf_data);
+          --_size;
+          collapse(*node_slot);
+          return true;
+        }
+        node_slot = child_slot;
+        ++depth;
+      }
+      return false;
+    }
+    [[nodiscard]] radix_value *find(const std::string_view key_view) noexcept
+    {
+      leaf_node *leaf_data = find_leaf(key_view);
+      return leaf_data != nullptr ? &leaf_data->value_data : nullptr;
+    }
+    [[nodiscard]] const radix_value *find(const std::string_view key_view) const noexcept
+    {
+      const leaf_node *leaf_data = find_leaf(key_view);
+      return leaf_data != nullptr ? &leaf_data->value_data : nullptr;
+    }
+    [[nodiscard]] bool contains(const std::string_view key_view) const noexcept { return find_leaf(key_view) != nullptr; }
+
+    [[nodiscard]] uint64_t count(const std::string_view key_view) const noexcept { return find_leaf(key_view) != nullptr ? 1 : 0; }
+
+    [[nodiscard]] match_pair_value longest_prefix(const std::string_view key_view) const noexcept
+    {
+      leaf_node *leaf_data = longest_prefix_leaf(key_view);
+      return leaf_data != nullptr ? match_pair_value(leaf_data->key(), &leaf_data->value_data) : match_pair_value(std::string_view(), nullptr);
+    }
+    template <typename value_function>
+    void for_each_prefix(const std::string_view prefix_view, value_function function_object)
+    {
+      node_base *subtree_root = prefix_subtree(prefix_view);
+      if (subtree_root != nullptr)
+      {
+        visit(subtree_root, function_object);
+      }
+    }
+    template <typename value_function>
+    void for_each_prefix(const std::string_view prefix_view, value_function function_object) const
+    {
+      auto const_function = [&function_object](const std::string_view key_view, radix_value &value_data)
+      { function_object(key_view, static_cast<const radix_value &>(value_data)); };
+      node_base *subtree_root = prefix_subtree(prefix_view);
+      if (subtree_root != nullptr)
+      {
+        visit(subtree_root, const_function);
+      }
+    }
+    template <typename value_function>
+    void for_each(value_function function_object)
+    {
+      for_each_prefix(std::string_view(), std::move(function_object));
+    }
+    template <typename value_function>
+    void for_each(value_function function_object) const
+    {
+      for_each_prefix(std::string_view(), std::move(function_object));
+    }
+  };
+}
+namespace standard_con
+{
+  using radix_tree_container::radix_tree;
+}
@@ -0,0 +1,429 @@
+#pragma once
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include "simulate_exception.hpp"
+#include "simulate_algorithm.hpp"
+namespace ring_container
+{
+  /*
+   * @brief  #### `ring_buffer` 类模板
+
+      *   - 可增长的环形缓冲区：一段连续内存首尾相接，容量始终是 2 的幂，下标用 `& (容量 - 1)` 回绕，不需要取模
+
+      *   - 两端都可以 O(1) 插入删除，元素连续存放，入队出队不再为每个元素单独分配节点
+
+      *   - `standard_con::queue` 和 `standard_con::stack` 的默认底层容器
+
+      * 模板参数:
+
+      * * - `ring_type`: 元素类型
+      *
+      * * - `ring_allocator`: 分配器类型，默认为 `std::allocator<ring_type>`
+
+      * 元素操作方法:
+
+      * * - `push_back()` / `emplace_back()` / `push_front()` / `emplace_front()`: 两端插入，满了先扩容为 2 倍
+      *
+      * * - `pop_back()` / `pop_front()`: 两端删除，空时什么都不做
+      *
+      * * - `front()` / `back()` / `operator[]`: 访问元素，`operator[]` 越界时抛出异常
+      *
+      * * - `reserve()`: 预留容量（向上取 2 的幂），`clear()`: 析构所有元素保留容量
+
+      * 特性:
+
+      * * - 扩容时把回绕的两段按逻辑顺序搬到新数组开头：可平凡拷贝的类型分两次 memcpy，其余类型按 `std::move_if_noexcept` 搬运
+      *
+      * * - 最小容量为 16，之后每次翻倍，均摊 O(1)
+
+      * 注意事项:
+
+      * * - 扩容会使所有迭代器和引用失效
+      *
+      * * - 容量不会自动收缩
+  */
+  template <typename ring_type, typename ring_allocator = std::allocator<ring_type>>
+  class ring_buffer
+  {
+    using allocator_traits = std::allocator_traits<ring_allocator>;
+    static constexpr uint64_t minimum_capacity = 16;
+    ring_type *_data_pointer;
+    uint64_t _head;
+    uint64_t _size;
+    uint64_t _capacity;
+    [[no_unique_address]] ring_allocator allocator_object;
+    [[nodiscard]] uint64_t physical_index(const uint64_t &logical_index) const noexcept
+    {
+      return (_head + logical_index) & (_capacity - 1);
+    }
+    void destroy_elements() noexcept
+    {
+      if constexpr (!std::is_trivially_destructible_v<ring_type>)
+      {
+        for (uint64_t element_traversal = 0; element_traversal < _size; ++element_traversal)
+        {
+          allocator_traits::destroy(allocator_object, _data_pointer + physical_index(element_traversal));
+        }
+      }
+    }
+    void release_storage() noexcept
+    {
+      destroy_elements();
+      if (_data_pointer != nullptr)
+      {
+        allocator_traits::deallocate(allocator_object, _data_pointer, _capacity);
+      }
+      _data_pointer = nullptr;
+      _head = _size = _capacity = 0;
+    }
+    void reallocate(const uint64_t &new_ring_capacity)
+    {
+      // 按逻辑顺序搬到新数组开头，搬完后 _head 归零
+      ring_type *new_data_pointer = allocator_traits::allocate(allocator_object, new_ring_capacity);
+      if constexpr (std::is_trivially_copyable_v<ring_type>)
+      {
+        if (_size != 0)
+        {
+          const uint64_t first_segment = _size < _capacity - _head ? _size : _capacity - _head;
+          std::memcpy(static_cast<void *>(new_data_pointer), static_cast<const void *>(_data_pointer + _head), first_segment * sizeof(ring_type));
+          std::memcpy(static_cast<void *>(new_data_pointer + first_segment), static_cast<const void *>(_data_pointer), (_size - first_segment) * sizeof(ring_type));
+        }
+      }
+      else
+      {
+        uint64_t constructed_count = 0;
+        try
+        {
+          for (; constructed_count < _size; ++constructed_count)
+          {
+            allocator_traits::construct(allocator_object, new_data_pointer + constructed_count,
+                                        std::move_if_noexcept(_data_pointer[physical_index(constructed_count)]));
+          }
+        }
+        catch (...)
+        {
+          for (uint64_t destroy_traversal = 0; destroy_traversal < constructed_count; ++destroy_traversal)
+          {
+            allocator_traits::destroy(allocator_object, new_data_pointer + destroy_traversal);
+          }
+          allocator_traits::deallocate(allocator_object, new_data_pointer, new_ring_capacity);
+          throw;
+        }
+        destroy_elements();
+      }
+      if (_data_pointer != nullptr)
+      {
+        allocator_traits::deallocate(allocator_object, _data_pointer, _capacity);
+      }
+      _data_pointer = new_data_pointer;
+      _head = 0;
+      _capacity = new_ring_capacity;
+    }
+    void grow_if_full()
+    {
+      if (_size == _capacity)
+      {
+        reallocate(_capacity == 0 ? minimum_capacity : _capacity * 2);
+      }
+    }
+    void check_location(const uint64_t &access_location) const
+    {
+      try
+      {
+        if (access_location >= _size)
+        {
+          throw custom_exception::fault("传入参数越界", "ring_buffer::operator[]", __LINE__);
+        }
+      }
+      catch (const custom_exception::fault &process)
+      {
+        std::cerr << process.what() << " " << process.function_name_get() << " " << process.line_number_get() << std::endl;
+        throw;
+      }
+    }
+    template <typename ring_buffer_pointer, typename ring_value_reference>
+    class ring_iterator
+    {
+      ring_buffer_pointer ring_pointer;
+      uint64_t logical_index;
+
+    public:
+      ring_iterator(ring_buffer_pointer ring_data, const uint64_t index_data) noexcept : ring_pointer(ring_data), logical_index(index_data) { ; }
+      ring_value_reference operator*() const noexcept
+      {
+        return ring_pointer->_data_pointer[ring_pointer->physical_index(logical_index)];
+      }
+      auto operator->() const noexcept
+      {
+        return &operator*();
+      }
+      ring_iterator &operator++() noexcept
+      {
+        ++logical_index;
+        return *this;
+      }
+      ring_iterator operator++(int) noexcept
+      {
+        ring_iterator temporary_iterator(*this);
+        ++logical_index;
+        return temporary_iterator;
+      }
+      ring_iterator &operator--() noexcept
+      {
+        --logical_index;
+        return *this;
+      }
+      ring_iterator operator--(int) noexcept
+      {
+        ring_iterator temporary_iterator(*this);
+        --logical_index;
+        return temporary_iterator;
+      }
+      bool operator==(const ring_iterator &iterator_data) const noexcept
+      {
+        return ring_pointer == iterator_data.ring_pointer && logical_index == iterator_data.logical_index;
+      }
+      bool operator!=(const ring_iterator &iterator_data) const noexcept
+      {
+        return !(*this == iterator_data);
+      }
+    };
+
+  public:
+    using iterator = ring_iterator<ring_buffer *, ring_type &>;
+    using const_iterator = ring_iterator<const ring_buffer *, const ring_type &>;
+    using allocator_type = ring_allocator;
+    ring_buffer() noexcept(std::is_nothrow_default_constructible_v<ring_allocator>)
+        : _data_pointer(nullptr), _head(0), _size(0), _capacity(0), allocator_object() { ; }
+    explicit ring_buffer(const ring_allocator &allocator_data) noexcept
+        : _data_pointer(nullptr), _head(0), _size(0), _capacity(0), allocator_object(allocator_data) { ; }
+    ring_buffer(std::initializer_list<ring_type> lightweight_container)
+        : _data_pointer(nullptr), _head(0), _size(0), _capacity(0), allocator_object()
+    {
+      reserve(lightweight_container.size());
+      try
+      {
+        for (auto &chained_values : lightweight_container)
+        {
+          push_back(chained_values);
+        }
+      }
+      catch (...)
+      {
+        release_storage();
+        throw;
+      }
+    }
+    ring_buffer(const ring_buffer &ring_buffer_data)
+        : _data_pointer(nullptr), _head(0), _size(0), _capacity(0),
+          allocator_object(allocator_traits::select_on_container_copy_construction(ring_buffer_data.allocator_object))
+    {
+      reserve(ring_buffer_data._size);
+      try
+      {
+        for (uint64_t copy_traversal = 0; copy_traversal < ring_buffer_data._size; ++copy_traversal)
+        {
+          push_back(ring_buffer_data[copy_traversal]);
+        }
+      }
+      catch (...)
+      {
+        release_storage();
+        throw;
+      }
+    }
+    ring_buffer(ring_buffer &&ring_buffer_data) noexcept
+        : _data_pointer(ring_buffer_data._data_pointer), _head(ring_buffer_data._head), _size(ring_buffer_data._size),
+          _capacity(ring_buffer_data._capacity), allocator_object(std::move(ring_buffer_data.allocator_object))
+    {
+      ring_buffer_data._data_pointer = nullptr;
+      ring_buffer_data._head = ring_buffer_data._size = ring_buffer_data._capacity = 0;
+    }
+    ~ring_buffer() noexcept
+    {
+      release_storage();
+    }
+    ring_buffer &operator=(const ring_buffer &ring_buffer_data)
+    {
+      if (this != &ring_buffer_data)
+      {
+        ring_buffer temporary_ring_buffer(ring_buffer_data);
+        swap(temporary_ring_buffer);
+      }
+      return *this;
+    }
+    ring_buffer &operator=(ring_buffer &&ring_buffer_data) noexcept
+    {
+      if (this != &ring_buffer_data)
+      {
+        ring_buffer temporary_ring_buffer(std::move(ring_buffer_data));
+        swap(temporary_ring_buffer);
+      }
+      return *this;
+    }
+    void swap(ring_buffer &ring_buffer_data) noexcept
+    {
+      standard_con::algorithm::swap(_data_pointer, ring_buffer_data._data_pointer);
+      standard_con::algorithm::swap(_head, ring_buffer_data._head);
+      standard_con::algorithm::swap(_size, ring_buffer_data._size);
+      standard_con::algorithm::swap(_capacity, ring_buffer_data._capacity);
+      if constexpr (allocator_traits::propagate_on_container_swap::value)
+      {
+        standard_con::algorithm::swap(allocator_object, ring_buffer_data.allocator_object);
+      }
+    }
+    [[nodiscard]] iterator begin() noexcept
+    {
+      return iterator(this, 0);
+    }
+    [[nodiscard]] iterator end() noexcept
+    {
+      return iterator(this, _size);
+    }
+    [[nodiscard]] const_iterator begin() const noexcept
+    {
+      return const_iterator(this, 0);
+    }
+    [[nodiscard]] const_iterator end() const noexcept
+    {
+      return const_iterator(this, _size);
+    }
+    [[nodiscard]] uint64_t size() const noexcept
+    {
+      return _size;
+    }
+    [[nodiscard]] uint64_t capacity() const noexcept
+    {
+      return _capacity;
+    }
+    [[nodiscard]] bool empty() const noexcept
+    {
+      return _size == 0;
+    }
+    [[nodiscard]] ring_type &front() noexcept
+    {
+      return _data_pointer[_head];
+    }
+    [[nodiscard]] const ring_type &front() const noexcept
+    {
+      return _data_pointer[_head];
+    }
+    [[nodiscard]] ring_type &back() noexcept
+    {
+      return _data_pointer[physical_index(_size - 1)];
+    }
+    [[nodiscard]] const ring_type &back() const noexcept
+    {
+      return _data_pointer[physical_index(_size - 1)];
+    }
+    ring_type &operator[](const uint64_t &access_location)
+    {
+      check_location(access_location);
+      return _data_pointer[physical_index(access_location)];
+    }
+    const ring_type &operator[](const uint64_t &access_location) const
+    {
+      check_location(access_location);
+      return _data_pointer[physical_index(access_location)];
+    }
+    void reserve(const uint64_t &new_ring_capacity)
+    {
+      if (new_ring_capacity <= _capacity)
+      {
+        return;
+      }
+      uint64_t rounded_capacity = minimum_capacity;
+      while (rounded_capacity < new_ring_capacity)
+      {
+        rounded_capacity <<= 1;
+      }
+      reallocate(rounded_capacity);
+    }
+    void clear() noexcept
+    {
+      destroy_elements();
+      _head = _size = 0;
+    }
+    template <typename... construct_arguments>
+    ring_type &emplace_back(construct_arguments &&...ring_type_arguments)
+    {
+      if (_size == _capacity)
+      {
+        // 参数可能引用本容器里的元素，先构造出来再扩容
+        ring_type new_element(std::forward<construct_arguments>(ring_type_arguments)...);
+        grow_if_full();
+        allocator_traits::construct(allocator_object, _data_pointer + physical_index(_size), std::move(new_element));
+      }
+      else
+      {
+        allocator_traits::construct(allocator_object, _data_pointer + physical_index(_size), std::forward<construct_arguments>(ring_type_arguments)...);
+      }
+      ++_size;
+      return back();
+    }
+    template <typename... construct_arguments>
+    ring_type &emplace_front(construct_arguments &&...ring_type_arguments)
+    {
+      if (_size == _capacity)
+      {
+        ring_type new_element(std::forward<construct_arguments>(ring_type_arguments)...);
+        grow_if_full();
+        const uint64_t new_head = (_head - 1) & (_capacity - 1);
+        allocator_traits::construct(allocator_object, _data_pointer + new_head, std::move(new_element));
+        _head = new_head;
+      }
+      else
+      {
+        const uint64_t new_head = (_head - 1) & (_capacity - 1);
+        allocator_traits::construct(allocator_object, _data_pointer + new_head, std::forward<construct_arguments>(ring_type_arguments)...);
+        _head = new_head;
+      }
+      ++_size;
+      return front();
+    }
+    ring_buffer &push_back(const ring_type &ring_type_data)
+    {
+      emplace_back(ring_type_data);
+      return *this;
+    }
+    ring_buffer &push_back(ring_type &&ring_type_data)
+    {
+      emplace_back(std::move(ring_type_data));
+      return *this;
+    }
+    ring_buffer &push_front(const ring_type &ring_type_data)
+    {
+      emplace_front(ring_type_data);
+      return *this;
+    }
+    ring_buffer &push_front(ring_type &&ring_type_data)
+    {
+      emplace_front(std::move(ring_type_data));
+      return *this;
+    }
+    ring_buffer &pop_front() noexcept
+    {
+      if (_size != 0)
+      {
+        allocator_traits::destroy(allocator_object, _data_pointer + _head);
+        _head = (_head + 1) & (_capacity - 1);
+        --_size;
+      }
+      return *this;
+    }
+    ring_buffer &pop_back() noexcept
+    {
+      if (_size != 0)
+      {
+        --_size;
+        allocator_traits::destroy(allocator_object, _data_pointer + physical_index(_size));
+      }
+      return *this;
+    }
+  };
+}
+namespace standard_con
+{
+  using ring_container::ring_buffer;
+}
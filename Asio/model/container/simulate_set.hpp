@@ -95,6 +95,16 @@ namespace set_container
 
     tree_set() { ; }
 
+    // 从按键严格递增的区间 O(n) 建树，适合整体重建
+    template <std::forward_iterator sorted_iterator>
+    tree_set(sorted_iterator first_iterator, sorted_iterator last_iterator)
+        : instance_tree_set(first_iterator, last_iterator) { ; }
+
+    template <std::forward_iterator sorted_iterator>
+    void assign_sorted(sorted_iterator first_iterator, sorted_iterator last_iterator) { instance_tree_set.assign_sorted(first_iterator, last_iterator); }
+
+    void clear() noexcept { instance_tree_set.clear(); }
+
     ~tree_set() = default;
 
     tree_set(const tree_set &set_data) { instance_tree_set = set_data.instance_tree_set; }
@@ -109,6 +119,44 @@ namespace set_container
 
     iterator find(const key_val_type &set_type_data) { return instance_tree_set.find(set_type_data); }
 
+    [[nodiscard]] uint64_t count(const set_type &key_data) const { return instance_tree_set.contains(key_data) ? 1 : 0; }
+
+    // 比较器带有 `is_transparent` 时（如 `standard_con::less<>`），按键查询接受任意可与元素比较的类型
+    template <typename lookup_type>
+      requires standard_con::transparent_function<comparators>
+    iterator find(const lookup_type &key_data) { return instance_tree_set.find_key(key_data); }
+
+    template <typename lookup_type>
+      requires standard_con::transparent_function<comparators>
+    [[nodiscard]] uint64_t count(const lookup_type &key_data) const { return instance_tree_set.contains(key_data) ? 1 : 0; }
+
+    template <typename lookup_type>
+      requires standard_con::transparent_function<comparators>
+    [[nodiscard]] bool contains(const lookup_type &key_data) const { return instance_tree_set.contains(key_data); }
+
+    template <typename lookup_type>
+      requires standard_con::transparent_function<comparators>
+    iterator lower_bound(const lookup_type &key_data) { return instance_tree_set.lower_bound(key_data); }
+
+    template <typename lookup_type>
+      requires standard_con::transparent_function<comparators>
+    iterator upper_bound(const lookup_type &key_data) { return instance_tree_set.upper_bound(key_data); }
+
+    // 区间与名次查询，均为 O(log n)；rank 为严格小于 key 的元素个数，count_range 统计 [low, high)
+    iterator lower_bound(const set_type &key_data) { return instance_tree_set.lower_bound(key_data); }
+
+    iterator upper_bound(const set_type &key_data) { return instance_tree_set.upper_bound(key_data); }
+
+    standard_con::pair<iterator, iterator> equal_range(const set_type &key_data) { return instance_tree_set.equal_range(key_data); }
+
+    [[nodiscard]] bool contains(const set_type &key_data) const { return instance_tree_set.contains(key_data); }
+
+    iterator select(const uint64_t order_index) { return instance_tree_set.select(order_index); }
+
+    [[nodiscard]] uint64_t rank(const set_type &key_data) const { return instance_tree_set.rank(key_data); }
+
+    [[nodiscard]] uint64_t count_range(const set_type &low_key, const set_type &high_key) const { return instance_tree_set.count_range(low_key, high_key); }
+
     void middle_order_traversal() { instance_tree_set.middle_order_traversal(); }
 
     void pre_order_traversal() { instance_tree_set.pre_order_traversal(); }
@@ -166,17 +214,6 @@ namespace set_container
   class hash_set
   {
     using key_val_type = set_type_val;
-    class inbuilt_set_hash_functor
-    {
-    private:
-      external_hash_functions hash_functions_object;
-
-    public:
-      uint64_t operator()(const key_val_type &key_value)
-      {
-        return hash_functions_object(key_value) * 131;
-      }
-    };
     class key_val
     {
     public:
@@ -185,7 +222,7 @@ namespace set_container
         return key_value;
       }
     };
-    using hash_table = standard_con::hash_table<set_type_val, key_val_type, key_val, inbuilt_set_hash_functor>;
+    using hash_table = standard_con::hash_table<set_type_val, key_val_type, key_val, external_hash_functions>;
     hash_table instance_hash_set;
 
   public:
@@ -210,6 +247,23 @@ namespace set_container
 
     iterator find(const key_val_type &set_type_data) { return instance_hash_set.find(set_type_data); }
 
+    // 哈希函数带有 `is_transparent` 时（默认即是），按键查询接受任意与元素哈希一致、可用 `==` 比较的类型
+    template <typename lookup_type>
+      requires standard_con::transparent_function<external_hash_functions>
+    iterator find(const lookup_type &key_data) { return instance_hash_set[key_data]; }
+
+    [[nodiscard]] bool contains(const key_val_type &key_data) { return instance_hash_set.contains(key_data); }
+
+    template <typename lookup_type>
+      requires standard_con::transparent_function<external_hash_functions>
+    [[nodiscard]] bool contains(const lookup_type &key_data) { return instance_hash_set.contains(key_data); }
+
+    [[nodiscard]] uint64_t count(const key_val_type &key_data) { return instance_hash_set.contains(key_data) ? 1 : 0; }
+
+    template <typename lookup_type>
+      requires standard_con::transparent_function<external_hash_functions>
+    [[nodiscard]] uint64_t count(const lookup_type &key_data) { return instance_hash_set.contains(key_data) ? 1 : 0; }
+
     uint64_t size() { return instance_hash_set.size(); }
 
     bool empty() { return instance_hash_set.empty(); }
@@ -266,9 +320,124 @@ namespace set_container
       return *this;
     }
   };
+  /**
+   * @brief 基于开放寻址哈希表实现的无序集合容器
+   *
+   * 该容器是一个无序关联容器，存储唯一的元素，底层依赖 `flat_hash_table` 实现。
+   *
+   * 元素连续存放在槽位数组中，查找时按组并行比较控制字节，没有逐元素的节点分配，适合查找密集的场景。
+   *
+   * 元素的遍历顺序为槽位顺序而非插入顺序。
+   *
+   * 模板参数:
+   *
+   * * - `flat_hash_set_type_val`: 集合中存储的元素类型，既是数据也是哈希映射的键
+   *
+   * * - `external_hash_functions`: 外部哈希函数类型，默认为 `standard_con::hash_imitation_functions`
+   *
+   * 注意事项:
+   *
+   * * - 插入触发扩容时所有元素会被移动，迭代器和元素地址失效
+   */
+  template <typename flat_hash_set_type_val, typename external_hash_functions = standard_con::hash_imitation_functions>
+  class flat_hash_set
+  {
+    using key_val_type = flat_hash_set_type_val;
+    class key_val
+    {
+    public:
+      const key_val_type &operator()(const key_val_type &key_value)
+      {
+        return key_value;
+      }
+    };
+    using flat_hash_table = standard_con::flat_hash_table<flat_hash_set_type_val, key_val_type, key_val, external_hash_functions>;
+    flat_hash_table instance_flat_hash_set;
+
+  public:
+    using iterator = typename flat_hash_table::iterator;
+    using const_iterator = typename flat_hash_table::const_iterator;
+    flat_hash_set() { ; }
+
+    ~flat_hash_set() = default;
+
+    explicit flat_hash_set(const key_val_type &set_type_data) { instance_flat_hash_set.push(set_type_data); }
+
+    explicit flat_hash_set(key_val_type &&set_type_data) { instance_flat_hash_set.push(std::move(set_type_data)); }
+
+    flat_hash_set(const flat_hash_set &flat_hash_set_data) = default;
+
+    flat_hash_set(flat_hash_set &&flat_hash_set_data) noexcept = default;
+
+    flat_hash_set(std::initializer_list<key_val_type> lightweight_container)
+    {
+      instance_flat_hash_set.reserve(lightweight_container.size());
+      for (auto &chained_values : lightweight_container)
+      {
+        instance_flat_hash_set.push(chained_values);
+      }
+    }
+    flat_hash_set &operator=(const flat_hash_set &flat_hash_set_data) = default;
+
+    flat_hash_set &operator=(flat_hash_set &&flat_hash_set_data) noexcept = default;
+
+    bool push(const key_val_type &set_type_data) { return instance_flat_hash_set.push(set_type_data); }
+
+    bool push(key_val_type &&set_type_data) { return instance_flat_hash_set.push(std::move(set_type_data)); }
+
+    bool pop(const key_val_type &set_type_data) { return instance_flat_hash_set.pop(set_type_data); }
+
+    iterator find(const key_val_type &set_type_data) { return instance_flat_hash_set.find(set_type_data); }
+
+    template <typename lookup_type>
+      requires standard_con::transparent_function<external_hash_functions>
+    iterator find(const lookup_type &key_data) { return instance_flat_hash_set[key_data]; }
+
+    [[nodiscard]] bool contains(const key_val_type &key_data) { return instance_flat_hash_set.contains(key_data); }
+
+    template <typename lookup_type>
+      requires standard_con::transparent_function<external_hash_functions>
+    [[nodiscard]] bool contains(const lookup_type &key_data) { return instance_flat_hash_set.contains(key_data); }
+
+    [[nodiscard]] uint64_t count(const key_val_type &key_data) { return instance_flat_hash_set.contains(key_data) ? 1 : 0; }
+
+    template <typename lookup_type>
+      requires standard_con::transparent_function<external_hash_functions>
+    [[nodiscard]] uint64_t count(const lookup_type &key_data) { return instance_flat_hash_set.contains(key_data) ? 1 : 0; }
+
+    iterator operator[](const key_val_type &set_type_data) { return instance_flat_hash_set[set_type_data]; }
+
+    void reserve(const uint64_t element_count) { instance_flat_hash_set.reserve(element_count); }
+
+    void clear() { instance_flat_hash_set.clear(); }
+
+    [[nodiscard]] uint64_t size() const
+    {
+      return instance_flat_hash_set.size();
+    }
+
+    [[nodiscard]] uint64_t capacity() const
+    {
+      return instance_flat_hash_set.capacity();
+    }
+
+    [[nodiscard]] bool empty() const
+    {
+      return instance_flat_hash_set.empty();
+    }
+
+    iterator begin() { return instance_flat_hash_set.begin(); }
+
+    iterator end() { return instance_flat_hash_set.end(); }
+
+    const_iterator cbegin() const { return instance_flat_hash_set.cbegin(); }
+
+    const_iterator cend() const { return instance_flat_hash_set.cend(); }
+  };
 }
 namespace standard_con
 {
+  using set_container::flat_hash_set;
   using set_container::hash_set;
   using set_container::tree_set;
 }
\ No newline at end of file
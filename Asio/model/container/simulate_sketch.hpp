@@ -0,0 +1,753 @@
+#pragma once
+#include <bit>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+#include "simulate_algorithm.hpp"
+#include "simulate_base.hpp"
+#include "simulate_exception.hpp"
+#include "simulate_hash.hpp"
+#include "simulate_vector.hpp"
+namespace sketch_container
+{
+  /*
+   * @brief  #### `count_min_sketch` 类模板
+
+   *   - 计数最小草图：`depth` 行、每行 `width` 个计数器，一个元素在每行各落一个计数器，估计值取这些计数器的最小值
+
+   *   - 采用保守更新：插入时只把各行计数器抬到 “当前最小值 + 增量”，已经更大的不动，高估明显少于逐行相加
+
+   *   - 估计值不会低于真实值；真实值之上的误差以 `1 - failure_probability` 的概率不超过 `error_rate * total_count()`
+
+   * 模板参数:
+
+   * * - `count_min_type_value`: 计数的元素类型
+   *
+   * * - `count_min_hash_functor`: 哈希函数对象类型，默认为 `standard_con::hash_function<count_min_type_value>`，需提供 `hash_seeded`
+
+   * 构造:
+
+   * * - `count_min_sketch(double error_rate = 0.001, double failure_probability = 0.01)`: 宽度取 `e / error_rate` 向上取到 2 的幂，
+   *     行数取 `ln(1 / failure_probability)` 向上取整
+
+   * 核心方法:
+
+   * * - `add(const value&, uint64_t count = 1)` / `estimate(const value&)`: 计数 / 查询
+   *
+   * * - `merge(const count_min_sketch&)`: 逐个计数器相加，SSE2 下 4 个计数器一组饱和相加；两个草图的宽度和行数必须相同
+   *
+   * * - `error_bound()`、`total_count()`、`width()`、`depth()`、`clear()`
+
+   * 注意事项:
+
+   * * - 内存固定为 `width * depth * 4` 字节，计数器为 32 位，达到上限后饱和不再增长
+   *
+   * * - 保守更新的草图合并后仍然只会高估；多线程统计时每个线程各用一个草图，最后 `merge` 到一起
+   *
+   * * - 被移动后的草图为空但保留宽度和行数，可以继续 `add`、`merge`，计数器数组在第一次写入时重新分配
+  */
+  template <typename count_min_type_value, typename count_min_hash_functor = standard_con::hash_function<count_min_type_value>>
+  class count_min_sketch
+  {
+    static constexpr uint64_t maximum_depth = 32;
+    static constexpr uint64_t row_seed = 0x9e3779b97f4a7c15ULL;
+    static constexpr uint32_t counter_limit = std::numeric_limits<uint32_t>::max();
+    count_min_hash_functor hash_functions_object;
+    uint32_t *counter_array;
+    uint64_t _width;
+    uint64_t _depth;
+    uint64_t _total_count;
+    double _error_rate;
+    void locate(const count_min_type_value &sketch_value, uint64_t (&counter_positions)[maximum_depth])
+    {
+      // 双重哈希：一次基础哈希派生出每行的下标，第二个哈希值取奇数，对 2 的幂取模时各行下标互不相同的概率最大
+      // 下标取基础哈希的低位，先做终结混合，连续整数、等步长整数这类键的低位才不会成片落进同一批计数器
+      const uint64_t first_hash = hash::hash_finalize(hash_functions_object.hash_seeded(sketch_value, 0));
+      const uint64_t second_hash = hash::hash_mixing(first_hash, row_seed) | 1;
+      for (uint64_t row_position = 0; row_position < _depth; ++row_position)
+      {
+        counter_positions[row_position] = row_position * _width + ((first_hash + row_position * second_hash) & (_width - 1));
+      }
+    }
+    void allocate_counters()
+    {
+      // 被移动后计数器数组为空，宽度和行数仍然保留，再次使用时按原尺寸重新分配
+      if (counter_array == nullptr)
+      {
+        counter_array = new uint32_t[_width * _depth]();
+      }
+    }
+    [[nodiscard]] static uint32_t saturating_add(const uint32_t counter_value, const uint64_t increment) noexcept
+    {
+      return increment >= static_cast<uint64_t>(counter_limit - counter_value) ? counter_limit : static_cast<uint32_t>(counter_value + increment);
+    }
+
+  public:
+    explicit count_min_sketch(const double error_rate = 0.001, const double failure_probability = 0.01)
+        : counter_array(nullptr), _width(0), _depth(0), _total_count(0), _error_rate(error_rate)
+    {
+      try
+      {
+        if (!(error_rate > 0.0 && error_rate < 1.0) || !(failure_probability > 0.0 && failure_probability < 1.0))
+        {
+          throw custom_exception::fault("误差率和失败概率必须在(0,1)区间内！", "count_min_sketch", __LINE__);
+        }
+      }
+      catch (const custom_exception::fault &process)
+      {
+        std::cerr << process.what() << " " << process.function_name_get() << " " << process.line_number_get() << std::endl;
+        throw;
+      }
+      _width = std::bit_ceil(static_cast<uint64_t>(std::ceil(std::exp(1.0) / error_rate)));
+      _depth = static_cast<uint64_t>(std::ceil(std::log(1.0 / failure_probability)));
+      _depth = _depth == 0 ? 1 : (_depth > maximum_depth ? maximum_depth : _depth);
+      allocate_counters();
+    }
+    count_min_sketch(const count_min_sketch &sketch_data)
+        : hash_functions_object(sketch_data.hash_functions_object), counter_array(nullptr),
+          _width(sketch_data._width), _depth(sketch_data._depth), _total_count(sketch_data._total_count), _error_rate(sketch_data._error_rate)
+    {
+      if (sketch_data.counter_array != nullptr)
+      {
+        counter_array = new uint32_t[_width * _depth];
+        std::memcpy(counter_array, sketch_data.counter_array, _width * _depth * sizeof(uint32_t));
+      }
+    }
+    count_min_sketch(count_min_sketch &&sketch_data) noexcept
+        : hash_functions_object(std::move(sketch_data.hash_functions_object)), counter_array(sketch_data.counter_array),
+          _width(sketch_data._width), _depth(sketch_data._depth), _total_count(sketch_data._total_count), _error_rate(sketch_data._error_rate)
+    {
+      sketch_data.counter_array = nullptr;
+      sketch_data._total_count = 0;
+    }
+    count_min_sketch &operator=(count_min_sketch sketch_data) noexcept
+    {
+      swap(sketch_data);
+      return *this;
+    }
+    ~count_min_sketch() noexcept
+    {
+      delete[] counter_array;
+    }
+    void swap(count_min_sketch &sketch_data) noexcept
+    {
+      standard_con::algorithm::swap(hash_functions_object, sketch_data.hash_functions_object);
+      standard_con::algorithm::swap(counter_array, sketch_data.counter_array);
+      standard_con::algorithm::swap(_width, sketch_data._width);
+      standard_con::algorithm::swap(_depth, sketch_data._depth);
+      standard_con::algorithm::swap(_total_count, sketch_data._total_count);
+      standard_con::algorithm::swap(_error_rate, sketch_data._error_rate);
+    }
+    void add(const count_min_type_value &sketch_value, const uint64_t increment = 1)
+    {
+      allocate_counters();
+      uint64_t counter_positions[maximum_depth];
+      locate(sketch_value, counter_positions);
+      uint32_t minimum_value = counter_limit;
+      for (uint64_t row_position = 0; row_position < _depth; ++row_position)
+      {
+        minimum_value = counter_array[counter_positions[row_position]] < minimum_value ? counter_array[counter_positions[row_position]] : minimum_value;
+      }
+      // 保守更新：各行只抬到 min + increment，本来就更大的计数器已经包含了其他元素的计数，不需要再加
+      const uint32_t target_value = saturating_add(minimum_value, increment);
+      for (uint64_t row_position = 0; row_position < _depth; ++row_position)
+      {
+        uint32_t &counter_value = counter_array[counter_positions[row_position]];
+        counter_value = counter_value < target_value ? target_value : counter_value;
+      }
+      _total_count += increment;
+    }
+    [[nodiscard]] uint64_t estimate(const count_min_type_value &sketch_value)
+    {
+      if (counter_array == nullptr)
+      {
+        return 0;
+      }
+      uint64_t counter_positions[maximum_depth];
+      locate(sketch_value, counter_positions);
+      uint32_t minimum_value = counter_limit;
+      for (uint64_t row_position = 0; row_position < _depth; ++row_position)
+      {
+        minimum_value = counter_array[counter_positions[row_position]] < minimum_value ? counter_array[counter_positions[row_position]] : minimum_value;
+      }
+      return minimum_value;
+    }
+    void merge(const count_min_sketch &sketch_data)
+    {
+      try
+      {
+        if (_width != sketch_data._width || _depth != sketch_data._depth)
+        {
+          throw custom_exception::fault("合并的草图宽度和行数必须相同！", "count_min_sketch::merge", __LINE__);
+        }
+      }
+      catch (const custom_exception::fault &process)
+      {
+        std::cerr << process.what() << " " << process.function_name_get() << " " << process.line_number_get() << std::endl;
+        throw;
+      }
+      if (sketch_data.counter_array == nullptr)
+      {
+        return;
+      }
+      allocate_counters();
+      const uint64_t counter_count = _width * _depth;
+      uint64_t counter_position = 0;
+#if defined(__SSE2__)
+      // 无符号饱和加法：和小于任一加数说明溢出，SSE2 只有有符号比较，先把两边的最高位翻转再比
+      const __m128i sign_lane = _mm_set1_epi32(static_cast<int>(0x80000000U));
+      for (; counter_position + 4 <= counter_count; counter_position += 4)
+      {
+        const __m128i first_lane = _mm_loadu_si128(reinterpret_cast<const __m128i *>(counter_array + counter_position));
+        const __m128i second_lane = _mm_loadu_si128(reinterpret_cast<const __m128i *>(sketch_data.counter_array + counter_position));
+        const __m128i sum_lane = _mm_add_epi32(first_lane, second_lane);
+        const __m128i overflow_lane = _mm_cmpgt_epi32(_mm_xor_si128(first_lane, sign_lane), _mm_xor_si128(sum_lane, sign_lane));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(counter_array + counter_position), _mm_or_si128(sum_lane, overflow_lane));
+      }
+#endif
+      for (; counter_position < counter_count; ++counter_position)
+      {
+        counter_array[counter_position] = saturating_add(counter_array[counter_position], sketch_data.counter_array[counter_position]);
+      }
+      _total_count += sketch_data._total_count;
+    }
+    void clear() noexcept
+    {
+      if (counter_array != nullptr)
+      {
+        std::memset(counter_array, 0, _width * _depth * sizeof(uint32_t));
+      }
+      _total_count = 0;
+    }
+    [[nodiscard]] uint64_t error_bound() const noexcept
+    {
+      return static_cast<uint64_t>(std::ceil(_error_rate * static_cast<double>(_total_count)));
+    }
+    [[nodiscard]] uint64_t total_count() const noexcept
+    {
+      return _total_count;
+    }
+    [[nodiscard]] uint64_t width() const noexcept
+    {
+      return _width;
+    }
+    [[nodiscard]] uint64_t depth() const noexcept
+    {
+      return _depth;
+    }
+  };
+  /*
+   * @brief  #### `hyper_log_log` 类模板
+
+   *   - 基数估计：统计不同元素的个数，内存固定为 `2^precision` 个 8 位寄存器，与元素个数无关
+
+   *   - 基础哈希先经 `hash::hash_finalize` 混合，高 `precision` 位选寄存器，其余位中第一个 1 的位置记为秩，寄存器保存见过的最大秩
+
+   *   - 估计采用 Ertl 的改进估计量：按寄存器值的直方图计算，从空集到 2^64 量级都无需线性计数切换或经验偏差表
+
+   * 模板参数:
+
+   * * - `hyper_log_log_type_value`: 元素类型
+   *
+   * * - `hyper_log_log_hash_functor`: 哈希函数对象类型，默认为 `standard_con::hash_function<hyper_log_log_type_value>`，需提供 `hash_seeded`
+
+   * 核心方法:
+
+   * * - `add(const value&)`: 插入，同一元素插入多次不影响结果
+   *
+   * * - `estimate()`: 返回不同元素个数的估计值，相对标准误差约为 `1.04 / sqrt(2^precision)`（`standard_error()`）
+   *
+   * * - `merge(const hyper_log_log&)`: 逐个寄存器取最大值，得到两个集合并集的草图；SSE2 下 16 个寄存器一组
+   *
+   * * - `precision()`、`register_count()`、`clear()`
+
+   * 注意事项:
+
+   * * - `precision` 取值 [4, 18]，默认 14，即 16 KB、约 0.81% 的误差
+   *
+   * * - 只有精度相同的草图才能合并；多线程统计时每个线程各用一个草图，最后 `merge`
+   *
+   * * - 被移动后的草图为空但保留精度，`estimate()` 返回 0，可以继续 `add`、`merge`，寄存器在第一次写入时重新分配
+  */
+  template <typename hyper_log_log_type_value, typename hyper_log_log_hash_functor = standard_con::hash_function<hyper_log_log_type_value>>
+  class hyper_log_log
+  {
+    static constexpr uint64_t minimum_precision = 4;
+    static constexpr uint64_t maximum_precision = 18;
+    hyper_log_log_hash_functor hash_functions_object;
+    uint8_t *register_array;
+    uint64_t _precision;
+    void allocate_registers()
+    {
+      // 被移动后寄存器数组为空，精度仍然保留，再次使用时按原精度重新分配
+      if (register_array == nullptr)
+      {
+        register_array = new uint8_t[register_count()]();
+      }
+    }
+    [[nodiscard]] static double sigma(double register_ratio) noexcept
+    {
+      // sigma(x) = x + sum(x^(2^k) * 2^(k-1))，修正取值为 0 的寄存器
+      if (register_ratio == 1.0)
+      {
+        return std::numeric_limits<double>::infinity();
+      }
+      double weight_value = 1.0;
+      double sigma_value = register_ratio;
+      double previous_value;
+      do
+      {
+        register_ratio *= register_ratio;
+        previous_value = sigma_value;
+        sigma_value += register_ratio * weight_value;
+        weight_value += weight_value;
+      } while (sigma_value != previous_value);
+      return sigma_value;
+    }
+    [[nodiscard]] static double tau(double register_ratio) noexcept
+    {
+      // tau(x) = (1 - x - sum((1 - x^(2^-k))^2 * 2^-k)) / 3，修正取最大值的寄存器
+      if (register_ratio == 0.0 || register_ratio == 1.0)
+      {
+        return 0.0;
+      }
+      double weight_value = 1.0;
+      double tau_value = 1.0 - register_ratio;
+      double previous_value;
+      do
+      {
+        register_ratio = std::sqrt(register_ratio);
+        previous_value = tau_value;
+        weight_value *= 0.5;
+        tau_value -= (1.0 - register_ratio) * (1.0 - register_ratio) * weight_value;
+      } while (tau_value != previous_value);
+      return tau_value / 3.0;
+    }
+
+  public:
+    explicit hyper_log_log(const uint64_t precision_value = 14) : register_array(nullptr), _precision(precision_value)
+    {
+      try
+      {
+        if (precision_value < minimum_precision || precision_value > maximum_precision)
+        {
+          throw custom_exception::fault("精度必须在[4,18]区间内！", "hyper_log_log", __LINE__);
+        }
+      }
+      catch (const custom_exception::fault &process)
+      {
+        std::cerr << process.what() << " " << process.function_name_get() << " " << process.line_number_get() << std::endl;
+        throw;
+      }
+      allocate_registers();
+    }
+    hyper_log_log(const hyper_log_log &hyper_log_log_data)
+        : hash_functions_object(hyper_log_log_data.hash_functions_object), register_array(nullptr), _precision(hyper_log_log_data._precision)
+    {
+      if (hyper_log_log_data.register_array != nullptr)
+      {
+        register_array = new uint8_t[register_count()];
+        std::memcpy(register_array, hyper_log_log_data.register_array, register_count());
+      }
+    }
+    hyper_log_log(hyper_log_log &&hyper_log_log_data) noexcept
+        : hash_functions_object(std::move(hyper_log_log_data.hash_functions_object)), register_array(hyper_log_log_data.register_array),
+          _precision(hyper_log_log_data._precision)
+    {
+      hyper_log_log_data.register_array = nullptr;
+    }
+    hyper_log_log &operator=(hyper_log_log hyper_log_log_data) noexcept
+    {
+      swap(hyper_log_log_data);
+      return *this;
+    }
+    ~hyper_log_log() noexcept
+    {
+      delete[] register_array;
+    }
+    void swap(hyper_log_log &hyper_log_log_data) noexcept
+    {
+      standard_con::algorithm::swap(hash_functions_object, hyper_log_log_data.hash_functions_object);
+      standard_con::algorithm::swap(register_array, hyper_log_log_data.register_array);
+      standard_con::algorithm::swap(_precision, hyper_log_log_data._precision);
+    }
+    void add(const hyper_log_log_type_value &sketch_value)
+    {
+      allocate_registers();
+      // 寄存器下标取最高位、秩取其余位，两者都要求每一位独立均匀，基础哈希先做终结混合
+      const uint64_t hash_value = hash::hash_finalize(hash_functions_object.hash_seeded(sketch_value, 0));
+      const uint64_t register_index = hash_value >> (64 - _precision);
+      // 低位补一个哨兵 1，秩最大为 64 - precision + 1，countl_zero 不会看到全 0
+      const auto rank_value = static_cast<uint8_t>(std::countl_zero((hash_value << _precision) | (1ULL << (_precision - 1))) + 1);
+      register_array[register_index] = register_array[register_index] < rank_value ? rank_value : register_array[register_index];
+    }
+    [[nodiscard]] uint64_t estimate() const noexcept
+    {
+      if (register_array == nullptr)
+      {
+        return 0;
+      }
+      const uint64_t rank_limit = 64 - _precision;
+      uint64_t rank_histogram[66] = {};
+      const uint64_t register_total = register_count();
+      for (uint64_t register_position = 0; register_position < register_total; ++register_position)
+      {
+        ++rank_histogram[register_array[register_position]];
+      }
+      const auto register_number = static_cast<double>(register_total);
+      double harmonic_value = register_number * tau(1.0 - static_cast<double>(rank_histogram[rank_limit + 1]) / register_number);
+      for (uint64_t rank_position = rank_limit; rank_position >= 1; --rank_position)
+      {
+        harmonic_value = 0.5 * (harmonic_value + static_cast<double>(rank_histogram[rank_position]));
+      }
+      harmonic_value += register_number * sigma(static_cast<double>(rank_histogram[0]) / register_number);
+      const double alpha_value = 0.5 / std::log(2.0);
+      return static_cast<uint64_t>(std::llround(alpha_value * register_number * register_number / harmonic_value));
+    }
+    void merge(const hyper_log_log &hyper_log_log_data)
+    {
+      try
+      {
+        if (_precision != hyper_log_log_data._precision)
+        {
+          throw custom_exception::fault("合并的草图精度必须相同！", "hyper_log_log::merge", __LINE__);
+        }
+      }
+      catch (const custom_exception::fault &process)
+      {
+        std::cerr << process.what() << " " << process.function_name_get() << " " << process.line_number_get() << std::endl;
+        throw;
+      }
+      if (hyper_log_log_data.register_array == nullptr)
+      {
+        return;
+      }
+      allocate_registers();
+      const uint64_t register_total = register_count();
+      uint64_t register_position = 0;
+#if defined(__SSE2__)
+      for (; register_position + 16 <= register_total; register_position += 16)
+      {
+        const __m128i first_lane = _mm_loadu_si128(reinterpret_cast<const __m128i *>(register_array + register_position));
+        const __m128i second_lane = _mm_loadu_si128(reinterpret_cast<const __m128i *>(hyper_log_log_data.register_array + register_position));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(register_array + register_position), _mm_max_epu8(first_lane, second_lane));
+      }
+#endif
+      for (; register_position < register_total; ++register_position)
+      {
+        const uint8_t other_value = hyper_log_log_data.register_array[register_position];
+        register_array[register_position] = register_array[register_position] < other_value ? other_value : register_array[register_position];
+      }
+    }
+    void clear() noexcept
+    {
+      if (register_array != nullptr)
+      {
+        std::memset(register_array, 0, register_count());
+      }
+    }
+    [[nodiscard]] double standard_error() const noexcept
+    {
+      return 1.04 / std::sqrt(static_cast<double>(register_count()));
+    }
+    [[nodiscard]] uint64_t precision() const noexcept
+    {
+      return _precision;
+    }
+    [[nodiscard]] uint64_t register_count() const noexcept
+    {
+      return 1ULL << _precision;
+    }
+  };
+  // `top_k_sketch` 的一条结果：元素、计数估计值和其中可能多算的部分
+  template <typename top_k_type_value>
+  struct top_k_entry
+  {
+    top_k_type_value value;
+    uint64_t count = 0;
+    uint64_t error = 0;
+  };
+  /*
+   * @brief  #### `top_k_sketch` 类模板
+
+   *   - 用 Space-Saving 算法跟踪出现次数最多的 k 个元素，最多保存 k 个计数器，内存固定
+
+   *   - 元素已被跟踪时计数加一；未被跟踪且计数器已满时，替换计数最小的元素，新元素继承它的计数再加一，继承的部分记为误差
+
+   *   - 计数器放在 `hash_table` 里按元素查找，另用一个按计数排序的最小堆找最小值，堆里直接保存哈希表的迭代器，
+   *     替换时按迭代器删除，不需要再查一次表；每次 `add` 为 O(1) 查找加 O(log k) 调整堆
+
+   * 模板参数:
+
+   * * - `top_k_type_value`: 元素类型
+   *
+   * * - `top_k_hash_function`: 元素的哈希函数，默认为 `standard_con::hash_imitation_functions`
+
+   * 核心方法:
+
+   * * - `add(const value&, uint64_t weight = 1)`: 计数
+   *
+   * * - `estimate(const value&)`: 返回计数的估计值，未被跟踪时返回 0；估计值减去 `error` 是真实次数的下界
+   *
+   * * - `top(uint64_t count)`: 按计数降序返回至多 `count` 个 `top_k_entry { value, count, error }`
+   *
+   * * - `merge(const top_k_sketch&)`: 按可合并摘要的规则合并，只在一边出现的元素加上另一边的最小计数，保留计数最大的 k 个
+   *
+   * * - `size()`、`capacity()`、`total_count()`、`clear()`
+
+   * 注意事项:
+
+   * * - 出现次数超过 `total_count() / capacity()` 的元素一定在结果里，每个计数的高估不超过 `total_count() / capacity()`
+   *
+   * * - 多线程统计时每个线程各用一个草图，最后 `merge`
+   *
+   * * - 被移动后的草图为空但保留容量，可以继续 `add`、`merge`
+  */
+  template <typename top_k_type_value, typename top_k_hash_function = standard_con::hash_imitation_functions>
+  class top_k_sketch
+  {
+    struct top_k_node
+    {
+      top_k_entry<top_k_type_value> _entry;
+      uint64_t _heap_position;
+    };
+    struct key_val
+    {
+      const top_k_type_value &operator()(const top_k_node &node_data)
+      {
+        return node_data._entry.value;
+      }
+    };
+    using hash_table = standard_con::hash_table<top_k_type_value, top_k_node, key_val, top_k_hash_function>;
+    using iterator = typename hash_table::iterator;
+    using entry_vector = standard_con::vector<top_k_entry<top_k_type_value>>;
+    struct count_greater
+    {
+      bool operator()(const top_k_entry<top_k_type_value> &first_entry, const top_k_entry<top_k_type_value> &second_entry) const noexcept
+      {
+        return first_entry.count > second_entry.count;
+      }
+    };
+    hash_table instance_hash_table;
+    standard_con::vector<iterator> heap_array;
+    uint64_t _capacity;
+    uint64_t _total_count;
+    void heap_place(const uint64_t heap_position, iterator node_position)
+    {
+      heap_array[heap_position] = node_position;
+      node_position->_heap_position = heap_position;
+    }
+    void sift_up(uint64_t heap_position)
+    {
+      iterator node_position = heap_array[heap_position];
+      while (heap_position > 0)
+      {
+        const uint64_t parent_position = (heap_position - 1) / 2;
+        if (heap_array[parent_position]->_entry.count <= node_position->_entry.count)
+        {
+          break;
+        }
+        heap_place(heap_position, heap_array[parent_position]);
+        heap_position = parent_position;
+      }
+      heap_place(heap_position, node_position);
+    }
+    void sift_down(uint64_t heap_position)
+    {
+      iterator node_position = heap_array[heap_position];
+      const uint64_t heap_size = instance_hash_table.size();
+      while (true)
+      {
+        uint64_t child_position = heap_position * 2 + 1;
+        if (child_position >= heap_size)
+        {
+          break;
+        }
+        if (child_position + 1 < heap_size && heap_array[child_position + 1]->_entry.count < heap_array[child_position]->_entry.count)
+        {
+          ++child_position;
+        }
+        if (node_position->_entry.count <= heap_array[child_position]->_entry.count)
+        {
+          break;
+        }
+        heap_place(heap_position, heap_array[child_position]);
+        heap_position = child_position;
+      }
+      heap_place(heap_position, node_position);
+    }
+    void push_entry(const top_k_entry<top_k_type_value> &entry_data)
+    {
+      // 调用者保证元素不在表中且未满；被移动后堆数组为空，第一次插入时按容量重新分配
+      if (heap_array.size() < _capacity)
+      {
+        heap_array.resize(_capacity);
+      }
+      const uint64_t heap_position = instance_hash_table.size();
+      iterator node_position = instance_hash_table.insert(top_k_node{entry_data, heap_position}).first;
+      heap_place(heap_position, node_position);
+      sift_up(heap_position);
+    }
+    [[nodiscard]] uint64_t minimum_count() const
+    {
+      // 未满时没有被替换掉的元素，缺席元素的计数可能为 0
+      if (instance_hash_table.size() < _capacity)
+      {
+        return 0;
+      }
+      iterator minimum_position = heap_array[0];
+      return minimum_position->_entry.count;
+    }
+
+  public:
+    explicit top_k_sketch(const uint64_t top_k_capacity = 100)
+        : instance_hash_table(top_k_capacity * 2 + 1), _capacity(top_k_capacity == 0 ? 1 : top_k_capacity), _total_count(0)
+    {
+      heap_array.resize(_capacity);
+    }
+    top_k_sketch(const top_k_sketch &top_k_data) : instance_hash_table(top_k_data._capacity * 2 + 1), _capacity(top_k_data._capacity), _total_count(0)
+    {
+      // 堆里保存的是迭代器，不能直接拷贝，按条目重建
+      heap_array.resize(_capacity);
+      for (auto copy_position = top_k_data.instance_hash_table.cbegin(); copy_position != top_k_data.instance_hash_table.cend(); ++copy_position)
+      {
+        push_entry(copy_position->_entry);
+      }
+      _total_count = top_k_data._total_count;
+    }
+    top_k_sketch(top_k_sketch &&top_k_data) noexcept
+        : instance_hash_table(std::move(top_k_data.instance_hash_table)), heap_array(std::move(top_k_data.heap_array)),
+          _capacity(top_k_data._capacity), _total_count(top_k_data._total_count)
+    {
+      // 节点地址在移动后不变，堆里的迭代器继续有效；原草图保留容量，之后还能继续使用
+      top_k_data._total_count = 0;
+    }
+    top_k_sketch &operator=(top_k_sketch top_k_data) noexcept
+    {
+      swap(top_k_data);
+      return *this;
+    }
+    ~top_k_sketch() = default;
+
+    void swap(top_k_sketch &top_k_data) noexcept
+    {
+      instance_hash_table.swap(top_k_data.instance_hash_table);
+      heap_array.swap(top_k_data.heap_array);
+      standard_con::algorithm::swap(_capacity, top_k_data._capacity);
+      standard_con::algorithm::swap(_total_count, top_k_data._total_count);
+    }
+    void add(const top_k_type_value &sketch_value, const uint64_t weight = 1)
+    {
+      _total_count += weight;
+      iterator find_position = instance_hash_table[sketch_value];
+      if (find_position != instance_hash_table.end())
+      {
+        find_position->_entry.count += weight;
+        sift_down(find_position->_heap_position);
+        return;
+      }
+      if (instance_hash_table.size() < _capacity)
+      {
+        push_entry(top_k_entry<top_k_type_value>{sketch_value, weight, 0});
+        return;
+      }
+      // 替换计数最小的元素：新元素继承它的计数作为误差，放回堆顶再下沉
+      const uint64_t inherited_count = heap_array[0]->_entry.count;
+      instance_hash_table.erase(heap_array[0]);
+      iterator node_position = instance_hash_table.insert(top_k_node{top_k_entry<top_k_type_value>{sketch_value, inherited_count + weight, inherited_count}, 0}).first;
+      heap_place(0, node_position);
+      sift_down(0);
+    }
+    [[nodiscard]] uint64_t estimate(const top_k_type_value &sketch_value)
+    {
+      iterator find_position = instance_hash_table[sketch_value];
+      return find_position == instance_hash_table.end() ? 0 : find_position->_entry.count;
+    }
+    [[nodiscard]] bool contains(const top_k_type_value &sketch_value) { return instance_hash_table.contains(sketch_value); }
+
+    [[nodiscard]] entry_vector top(const uint64_t result_count) const
+    {
+      entry_vector result_entries;
+      for (auto entry_position = instance_hash_table.cbegin(); entry_position != instance_hash_table.cend(); ++entry_position)
+      {
+        result_entries.push_back(entry_position->_entry);
+      }
+      standard_con::algorithm::sort(result_entries.begin(), result_entries.end(), count_greater());
+      if (result_entries.size() > result_count)
+      {
+        result_entries.resize(result_count);
+      }
+      return result_entries;
+    }
+    void merge(const top_k_sketch &top_k_data)
+    {
+      // 一边缺席的元素，它在那一边的真实次数不超过那一边的最小计数，按此补齐后两边相加，再保留计数最大的 k 个
+      const uint64_t self_minimum = minimum_count();
+      const uint64_t other_minimum = top_k_data.minimum_count();
+      constexpr uint64_t merged_mark = std::numeric_limits<uint64_t>::max();
+      entry_vector merged_entries;
+      for (auto other_position = top_k_data.instance_hash_table.cbegin(); other_position != top_k_data.instance_hash_table.cend(); ++other_position)
+      {
+        top_k_entry<top_k_type_value> merged_entry = other_position->_entry;
+        iterator find_position = instance_hash_table[merged_entry.value];
+        if (find_position != instance_hash_table.end())
+        {
+          merged_entry.count += find_position->_entry.count;
+          merged_entry.error += find_position->_entry.error;
+          find_position->_heap_position = merged_mark;
+        }
+        else
+        {
+          merged_entry.count += self_minimum;
+          merged_entry.error += self_minimum;
+        }
+        merged_entries.push_back(merged_entry);
+      }
+      for (iterator self_position = instance_hash_table.begin(); self_position != instance_hash_table.end(); ++self_position)
+      {
+        if (self_position->_heap_position != merged_mark)
+        {
+          top_k_entry<top_k_type_value> merged_entry = self_position->_entry;
+          merged_entry.count += other_minimum;
+          merged_entry.error += other_minimum;
+          merged_entries.push_back(merged_entry);
+        }
+      }
+      standard_con::algorithm::sort(merged_entries.begin(), merged_entries.end(), count_greater());
+      instance_hash_table.clear();
+      const uint64_t keep_count = merged_entries.size() < _capacity ? merged_entries.size() : _capacity;
+      for (uint64_t entry_position = 0; entry_position < keep_count; ++entry_position)
+      {
+        push_entry(merged_entries[entry_position]);
+      }
+      _total_count += top_k_data._total_count;
+    }
+    void clear() noexcept
+    {
+      instance_hash_table.clear();
+      _total_count = 0;
+    }
+    [[nodiscard]] uint64_t size() const noexcept
+    {
+      return instance_hash_table.size();
+    }
+    [[nodiscard]] uint64_t capacity() const noexcept
+    {
+      return _capacity;
+    }
+    [[nodiscard]] uint64_t total_count() const noexcept
+    {
+      return _total_count;
+    }
+  };
+}
+namespace standard_con
+{
+  using sketch_container::count_min_sketch;
+  using sketch_container::hyper_log_log;
+  using sketch_container::top_k_entry;
+  using sketch_container::top_k_sketch;
+}
@@ -1,5 +1,6 @@
 #pragma once
 #include "simulate_vector.hpp"
+#include "simulate_ring.hpp"
 #include "simulate_algorithm.hpp"
 #include "simulate_exception.hpp"
 namespace stack_adapter
@@ -9,18 +10,18 @@ namespace stack_adapter
 
       *   - 自定义栈容器适配器，遵循 LIFO（后进先出）原则
 
-      *   - 基于底层容器实现（默认为 `standard_con::vector`），提供栈的标准操作接口
+      *   - 基于底层容器实现（默认为 `standard_con::ring_buffer`），提供栈的标准操作接口
 
       * 模板参数:
 
       * * - `stack_type`: 栈中存储的元素类型
       *
-      * * - `vector_based_stack`: 底层容器类型，默认为 `standard_con::vector<stack_type>`
+      * * - `ring_based_stack`: 底层容器类型，默认为 `standard_con::ring_buffer<stack_type>`
       *   - 需支持 `push_back()`、`pop_back()`、`back()`、`size()`、`empty()` 等操作
 
       * 成员变量:
 
-      * * - `vector_object`: 底层容器对象，用于存储栈中的元素
+      * * - `ring_object`: 底层容器对象，用于存储栈中的元素
 
       * 构造函数:
 
@@ -60,7 +61,7 @@ namespace stack_adapter
 
       * 特性:
 
-      * * - 适配性: 可基于不同底层容器实现（如 vector、list 等）
+      * * - 适配性: 可基于不同底层容器实现（如 ring_buffer、vector、list 等）
       *
       * * - 移动语义: 支持高效的资源转移
       *
@@ -77,83 +78,88 @@ namespace stack_adapter
 
       * 详细请参考 https://github.com/Hatedatastructures/Custom-libraries/blob/main/template_container.md
   */
-  template <typename stack_type, typename vector_based_stack = standard_con::vector<stack_type>>
+  template <typename stack_type, typename ring_based_stack = standard_con::ring_buffer<stack_type>>
   class stack
   {
   private:
-    vector_based_stack vector_object;
+    ring_based_stack ring_object;
 
   public:
     ~stack() { ; }
 
     void push(stack_type &&stack_type_data)
     {
-      vector_object.push_back(std::forward<stack_type>(stack_type_data));
+      ring_object.push_back(std::forward<stack_type>(stack_type_data));
     }
 
     void push(const stack_type &stack_type_data)
     {
-      vector_object.push_back(stack_type_data);
+      ring_object.push_back(stack_type_data);
     }
 
     void pop()
     {
-      vector_object.pop_back();
+      ring_object.pop_back();
     }
 
-    uint64_t size() noexcept
+    [[nodiscard]] uint64_t size() const noexcept
     {
-      return vector_object.size();
+      return ring_object.size();
     }
 
-    [[nodiscard]] stack_type &top() const noexcept
+    [[nodiscard]] stack_type &top() noexcept
     {
-      return vector_object.back();
+      return ring_object.back();
+    }
+
+    [[nodiscard]] const stack_type &top() const noexcept
+    {
+      return ring_object.back();
     }
 
     [[nodiscard]] bool empty() const noexcept
     {
-      return vector_object.empty();
+      return ring_object.empty();
     }
 
-    explicit stack(const stack<stack_type> &stack_data)
+    explicit stack(const stack &stack_data)
     {
-      vector_object = stack_data.vector_object;
+      ring_object = stack_data.ring_object;
     }
 
     stack_type &footer() noexcept
     {
-      return vector_object.back();
+      return ring_object.back();
     }
 
-    explicit stack(stack<stack_type> &&stack_data) noexcept
+    explicit stack(stack &&stack_data) noexcept
     {
-      vector_object = std::move(stack_data.vector_object); // std::move将对象转换为右值引用
+      ring_object = std::move(stack_data.ring_object); // std::move将对象转换为右值引用
     }
     stack(std::initializer_list<stack_type> stack_type_data)
     {
       for (auto &chained_values : stack_type_data)
       {
-        vector_object.push_back(chained_values);
+        ring_object.push_back(chained_values);
       }
     }
     explicit stack(const stack_type &stack_type_data)
     {
-      vector_object.push_back(stack_type_data);
+      ring_object.push_back(stack_type_data);
     }
-    stack &operator=(const stack<stack_type> &stack_data)
+    stack &operator=(const stack &stack_data)
     {
       if (this != &stack_data)
       {
-        vector_object = stack_data.vector_object;
+        ring_object = stack_data.ring_object;
       }
       return *this;
     }
-    stack &operator=(stack<stack_type> &&stack_data) noexcept
+    stack &operator=(stack &&stack_data) noexcept
     {
       if (this != &stack_data)
       {
-        vector_object = std::move(stack_data.vector_object);
+        ring_object = std::move(stack_data.ring_object);
       }
       return *this;
     }
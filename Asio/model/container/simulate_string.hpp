@@ -1,8 +1,416 @@
 #pragma once
+#include <bit>
+#include <cstdint>
+#include <string_view>
 #include "simulate_exception.hpp"
 #include "simulate_algorithm.hpp"
+#include "simulate_vector.hpp"
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+#define SIMULATE_STRING_X86_DISPATCH 1
+#include <immintrin.h>
+#endif
 namespace string_container
 {
+	/*
+			* @brief  #### `string_kernels` 字符串向量化内核
+
+			*   - 为 `string` 的查找、大小写转换、忽略大小写比较提供标量 / SSE2 / AVX2 三套实现
+
+			*   - x86-64 下第一次调用时用 `__builtin_cpu_supports` 检测 CPU，选定一套函数指针之后不再判断；其他平台只用标量实现
+
+			*   - AVX2 版本用 `target("avx2")` 属性单独编译，整个工程不需要加 `-mavx2`
+
+			* 内核:
+
+			* * - `find_byte`: 查找单个字符
+			*
+			* * - `find_substring` / `rfind_substring`: 子串正向 / 反向查找，先用首尾两个字符整块过滤候选位置，再 `memcmp` 确认
+			*
+			* * - `find_any`: 查找字符集合中任意字符第一次出现的位置，集合不超过 16 个字符时逐个广播比较，否则查 256 项表
+			*
+			* * - `lowercase` / `uppercase`: 原地大小写转换，只改 ASCII 字母
+			*
+			* * - `mismatch_ignore_case`: 忽略大小写时第一个不同字符的位置
+
+			* 注意事项:
+
+			* * - 找不到时统一返回 `nops`（即 `uint64_t(-1)`）
+	*/
+	namespace string_kernels
+	{
+		inline constexpr uint64_t nops = static_cast<uint64_t>(-1);
+		struct kernel_table
+		{
+			uint64_t (*find_byte)(const char *, uint64_t, char) noexcept;
+			uint64_t (*find_substring)(const char *, uint64_t, const char *, uint64_t) noexcept;
+			uint64_t (*rfind_substring)(const char *, uint64_t, const char *, uint64_t) noexcept;
+			uint64_t (*find_any)(const char *, uint64_t, const char *, uint64_t) noexcept;
+			void (*lowercase)(char *, uint64_t) noexcept;
+			void (*uppercase)(char *, uint64_t) noexcept;
+			uint64_t (*mismatch_ignore_case)(const char *, const char *, uint64_t) noexcept;
+		};
+		[[nodiscard]] constexpr char ascii_lower(const char character) noexcept
+		{
+			return (character >= 'A' && character <= 'Z') ? static_cast<char>(character + 32) : character;
+		}
+		[[nodiscard]] constexpr char ascii_upper(const char character) noexcept
+		{
+			return (character >= 'a' && character <= 'z') ? static_cast<char>(character - 32) : character;
+		}
+		// 标量实现，也负责各个向量版本处理不满一整块的尾部
+		[[nodiscard]] inline uint64_t scalar_find_byte(const char *data, const uint64_t length, const char character) noexcept
+		{
+			for (uint64_t position = 0; position < length; ++position)
+			{
+				if (data[position] == character)
+				{
+					return position;
+				}
+			}
+			return nops;
+		}
+		[[nodiscard]] inline uint64_t scalar_find_substring(const char *haystack, const uint64_t haystack_length, const char *needle, const uint64_t needle_length) noexcept
+		{
+			for (uint64_t position = 0; position + needle_length <= haystack_length; ++position)
+			{
+				if (haystack[position] == needle[0] && std::memcmp(haystack + position, needle, needle_length) == 0)
+				{
+					return position;
+				}
+			}
+			return nops;
+		}
+		[[nodiscard]] inline uint64_t scalar_rfind_substring(const char *haystack, const uint64_t haystack_length, const char *needle, const uint64_t needle_length) noexcept
+		{
+			for (uint64_t position = haystack_length - needle_length + 1; position-- > 0;)
+			{
+				if (haystack[position] == needle[0] && std::memcmp(haystack + position, needle, needle_length) == 0)
+				{
+					return position;
+				}
+			}
+			return nops;
+		}
+		[[nodiscard]] inline uint64_t scalar_find_any(const char *data, const uint64_t length, const char *character_set, const uint64_t set_length) noexcept
+		{
+			bool character_table[256] = {};
+			for (uint64_t set_position = 0; set_position < set_length; ++set_position)
+			{
+				character_table[static_cast<unsigned char>(character_set[set_position])] = true;
+			}
+			for (uint64_t position = 0; position < length; ++position)
+			{
+				if (character_table[static_cast<unsigned char>(data[position])])
+				{
+					return position;
+				}
+			}
+			return nops;
+		}
+		inline void scalar_lowercase(char *data, const uint64_t length) noexcept
+		{
+			for (uint64_t position = 0; position < length; ++position)
+			{
+				data[position] = ascii_lower(data[position]);
+			}
+		}
+		inline void scalar_uppercase(char *data, const uint64_t length) noexcept
+		{
+			for (uint64_t position = 0; position < length; ++position)
+			{
+				data[position] = ascii_upper(data[position]);
+			}
+		}
+		[[nodiscard]] inline uint64_t scalar_mismatch_ignore_case(const char *first_data, const char *second_data, const uint64_t length) noexcept
+		{
+			for (uint64_t position = 0; position < length; ++position)
+			{
+				if (ascii_lower(first_data[position]) != ascii_lower(second_data[position]))
+				{
+					return position;
+				}
+			}
+			return length;
+		}
+#if defined(SIMULATE_STRING_X86_DISPATCH)
+		// SSE2 实现：x86-64 基线指令集，一次处理 16 字节
+		[[nodiscard]] inline __m128i sse2_fold_case(const __m128i block, const char range_begin, const char range_end, const bool to_lower) noexcept
+		{
+			// 有符号比较：0x80 以上的字节是负数，不会落进字母区间
+			const __m128i in_range = _mm_and_si128(_mm_cmpgt_epi8(block, _mm_set1_epi8(static_cast<char>(range_begin - 1))),
+																						 _mm_cmpgt_epi8(_mm_set1_epi8(static_cast<char>(range_end + 1)), block));
+			const __m128i case_bit = _mm_and_si128(in_range, _mm_set1_epi8(0x20));
+			return to_lower ? _mm_add_epi8(block, case_bit) : _mm_sub_epi8(block, case_bit);
+		}
+		[[nodiscard]] inline uint64_t sse2_find_byte(const char *data, const uint64_t length, const char character) noexcept
+		{
+			const __m128i pattern = _mm_set1_epi8(character);
+			uint64_t position = 0;
+			for (; position + 16 <= length; position += 16)
+			{
+				const auto match_mask = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(data + position)), pattern)));
+				if (match_mask != 0)
+				{
+					return position + static_cast<uint64_t>(std::countr_zero(match_mask));
+				}
+			}
+			const uint64_t tail_position = scalar_find_byte(data + position, length - position, character);
+			return tail_position == nops ? nops : position + tail_position;
+		}
+		[[nodiscard]] inline uint64_t sse2_find_substring(const char *haystack, const uint64_t haystack_length, const char *needle, const uint64_t needle_length) noexcept
+		{
+			const __m128i first_pattern = _mm_set1_epi8(needle[0]);
+			const __m128i last_pattern = _mm_set1_epi8(needle[needle_length - 1]);
+			uint64_t position = 0;
+			for (; position + needle_length - 1 + 16 <= haystack_length; position += 16)
+			{
+				const __m128i first_block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(haystack + position));
+				const __m128i last_block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(haystack + position + needle_length - 1));
+				auto candidate_mask = static_cast<uint32_t>(_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(first_block, first_pattern), _mm_cmpeq_epi8(last_block, last_pattern))));
+				while (candidate_mask != 0)
+				{
+					const uint64_t candidate = position + static_cast<uint64_t>(std::countr_zero(candidate_mask));
+					if (std::memcmp(haystack + candidate + 1, needle + 1, needle_length - 2) == 0)
+					{
+						return candidate;
+					}
+					candidate_mask &= candidate_mask - 1;
+				}
+			}
+			const uint64_t tail_position = scalar_find_substring(haystack + position, haystack_length - position, needle, needle_length);
+			return tail_position == nops ? nops : position + tail_position;
+		}
+		[[nodiscard]] inline uint64_t sse2_rfind_substring(const char *haystack, const uint64_t haystack_length, const char *needle, const uint64_t needle_length) noexcept
+		{
+			const __m128i first_pattern = _mm_set1_epi8(needle[0]);
+			const __m128i last_pattern = _mm_set1_epi8(needle[needle_length - 1]);
+			// candidate_end 之前（不含）的起始位置还没检查，从后往前整块过滤
+			uint64_t candidate_end = haystack_length - needle_length + 1;
+			for (; candidate_end >= 16; candidate_end -= 16)
+			{
+				const uint64_t block_begin = candidate_end - 16;
+				const __m128i first_block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(haystack + block_begin));
+				const __m128i last_block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(haystack + block_begin + needle_length - 1));
+				auto candidate_mask = static_cast<uint32_t>(_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(first_block, first_pattern), _mm_cmpeq_epi8(last_block, last_pattern))));
+				while (candidate_mask != 0)
+				{
+					const uint64_t bit_position = 31 - static_cast<uint64_t>(std::countl_zero(candidate_mask));
+					if (std::memcmp(haystack + block_begin + bit_position + 1, needle + 1, needle_length - 2) == 0)
+					{
+						return block_begin + bit_position;
+					}
+					candidate_mask &= ~(1U << bit_position);
+				}
+			}
+			return candidate_end == 0 ? nops : scalar_rfind_substring(haystack, candidate_end + needle_length - 1, needle, needle_length);
+		}
+		[[nodiscard]] inline uint64_t sse2_find_any(const char *data, const uint64_t length, const char *character_set, const uint64_t set_length) noexcept
+		{
+			if (set_length > 16)
+			{
+				return scalar_find_any(data, length, character_set, set_length);
+			}
+			uint64_t position = 0;
+			for (; position + 16 <= length; position += 16)
+			{
+				const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + position));
+				__m128i match_block = _mm_setzero_si128();
+				for (uint64_t set_position = 0; set_position < set_length; ++set_position)
+				{
+					match_block = _mm_or_si128(match_block, _mm_cmpeq_epi8(block, _mm_set1_epi8(character_set[set_position])));
+				}
+				const auto match_mask = static_cast<uint32_t>(_mm_movemask_epi8(match_block));
+				if (match_mask != 0)
+				{
+					return position + static_cast<uint64_t>(std::countr_zero(match_mask));
+				}
+			}
+			const uint64_t tail_position = scalar_find_any(data + position, length - position, character_set, set_length);
+			return tail_position == nops ? nops : position + tail_position;
+		}
+		inline void sse2_lowercase(char *data, const uint64_t length) noexcept
+		{
+			uint64_t position = 0;
+			for (; position + 16 <= length; position += 16)
+			{
+				auto *block_pointer = reinterpret_cast<__m128i *>(data + position);
+				_mm_storeu_si128(block_pointer, sse2_fold_case(_mm_loadu_si128(block_pointer), 'A', 'Z', true));
+			}
+			scalar_lowercase(data + position, length - position);
+		}
+		inline void sse2_uppercase(char *data, const uint64_t length) noexcept
+		{
+			uint64_t position = 0;
+			for (; position + 16 <= length; position += 16)
+			{
+				auto *block_pointer = reinterpret_cast<__m128i *>(data + position);
+				_mm_storeu_si128(block_pointer, sse2_fold_case(_mm_loadu_si128(block_pointer), 'a', 'z', false));
+			}
+			scalar_uppercase(data + position, length - position);
+		}
+		[[nodiscard]] inline uint64_t sse2_mismatch_ignore_case(const char *first_data, const char *second_data, const uint64_t length) noexcept
+		{
+			uint64_t position = 0;
+			for (; position + 16 <= length; position += 16)
+			{
+				const __m128i first_block = sse2_fold_case(_mm_loadu_si128(reinterpret_cast<const __m128i *>(first_data + position)), 'A', 'Z', true);
+				const __m128i second_block = sse2_fold_case(_mm_loadu_si128(reinterpret_cast<const __m128i *>(second_data + position)), 'A', 'Z', true);
+				const auto equal_mask = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(first_block, second_block)));
+				if (equal_mask != 0xFFFF)
+				{
+					return position + static_cast<uint64_t>(std::countr_zero(~equal_mask));
+				}
+			}
+			return position + scalar_mismatch_ignore_case(first_data + position, second_data + position, length - position);
+		}
+		// AVX2 实现：一次处理 32 字节，只在运行时确认 CPU 支持后才会被调用
+		[[nodiscard]] __attribute__((target("avx2"))) inline __m256i avx2_fold_case(const __m256i block, const char range_begin, const char range_end, const bool to_lower) noexcept
+		{
+			const __m256i in_range = _mm256_and_si256(_mm256_cmpgt_epi8(block, _mm256_set1_epi8(static_cast<char>(range_begin - 1))),
+																								_mm256_cmpgt_epi8(_mm256_set1_epi8(static_cast<char>(range_end + 1)), block));
+			const __m256i case_bit = _mm256_and_si256(in_range, _mm256_set1_epi8(0x20));
+			return to_lower ? _mm256_add_epi8(block, case_bit) : _mm256_sub_epi8(block, case_bit);
+		}
+		[[nodiscard]] __attribute__((target("avx2"))) inline uint64_t avx2_find_byte(const char *data, const uint64_t length, const char character) noexcept
+		{
+			const __m256i pattern = _mm256_set1_epi8(character);
+			uint64_t position = 0;
+			for (; position + 32 <= length; position += 32)
+			{
+				const auto match_mask = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + position)), pattern)));
+				if (match_mask != 0)
+				{
+					return position + static_cast<uint64_t>(std::countr_zero(match_mask));
+				}
+			}
+			const uint64_t tail_position = sse2_find_byte(data + position, length - position, character);
+			return tail_position == nops ? nops : position + tail_position;
+		}
+		[[nodiscard]] __attribute__((target("avx2"))) inline uint64_t avx2_find_substring(const char *haystack, const uint64_t haystack_length, const char *needle, const uint64_t needle_length) noexcept
+		{
+			const __m256i first_pattern = _mm256_set1_epi8(needle[0]);
+			const __m256i last_pattern = _mm256_set1_epi8(needle[needle_length - 1]);
+			uint64_t position = 0;
+			for (; position + needle_length - 1 + 32 <= haystack_length; position += 32)
+			{
+				const __m256i first_block = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(haystack + position));
+				const __m256i last_block = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(haystack + position + needle_length - 1));
+				auto candidate_mask = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(first_block, first_pattern), _mm256_cmpeq_epi8(last_block, last_pattern))));
+				while (candidate_mask != 0)
+				{
+					const uint64_t candidate = position + static_cast<uint64_t>(std::countr_zero(candidate_mask));
+					if (std::memcmp(haystack + candidate + 1, needle + 1, needle_length - 2) == 0)
+					{
+						return candidate;
+					}
+					candidate_mask &= candidate_mask - 1;
+				}
+			}
+			const uint64_t tail_position = sse2_find_substring(haystack + position, haystack_length - position, needle, needle_length);
+			return tail_position == nops ? nops : position + tail_position;
+		}
+		[[nodiscard]] __attribute__((target("avx2"))) inline uint64_t avx2_rfind_substring(const char *haystack, const uint64_t haystack_length, const char *needle, const uint64_t needle_length) noexcept
+		{
+			const __m256i first_pattern = _mm256_set1_epi8(needle[0]);
+			const __m256i last_pattern = _mm256_set1_epi8(needle[needle_length - 1]);
+			uint64_t candidate_end = haystack_length - needle_length + 1;
+			for (; candidate_end >= 32; candidate_end -= 32)
+			{
+				const uint64_t block_begin = candidate_end - 32;
+				const __m256i first_block = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(haystack + block_begin));
+				const __m256i last_block = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(haystack + block_begin + needle_length - 1));
+				auto candidate_mask = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(first_block, first_pattern), _mm256_cmpeq_epi8(last_block, last_pattern))));
+				while (candidate_mask != 0)
+				{
+					const uint64_t bit_position = 31 - static_cast<uint64_t>(std::countl_zero(candidate_mask));
+					if (std::memcmp(haystack + block_begin + bit_position + 1, needle + 1, needle_length - 2) == 0)
+					{
+						return block_begin + bit_position;
+					}
+					candidate_mask &= ~(1U << bit_position);
+				}
+			}
+			return candidate_end == 0 ? nops : sse2_rfind_substring(haystack, candidate_end + needle_length - 1, needle, needle_length);
+		}
+		[[nodiscard]] __attribute__((target("avx2"))) inline uint64_t avx2_find_any(const char *data, const uint64_t length, const char *character_set, const uint64_t set_length) noexcept
+		{
+			if (set_length > 16)
+			{
+				return scalar_find_any(data, length, character_set, set_length);
+			}
+			uint64_t position = 0;
+			for (; position + 32 <= length; position += 32)
+			{
+				const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + position));
+				__m256i match_block = _mm256_setzero_si256();
+				for (uint64_t set_position = 0; set_position < set_length; ++set_position)
+				{
+					match_block = _mm256_or_si256(match_block, _mm256_cmpeq_epi8(block, _mm256_set1_epi8(character_set[set_position])));
+				}
+				const auto match_mask = static_cast<uint32_t>(_mm256_movemask_epi8(match_block));
+				if (match_mask != 0)
+				{
+					return position + static_cast<uint64_t>(std::countr_zero(match_mask));
+				}
+			}
+			const uint64_t tail_position = sse2_find_any(data + position, length - position, character_set, set_length);
+			return tail_position == nops ? nops : position + tail_position;
+		}
+		__attribute__((target("avx2"))) inline void avx2_lowercase(char *data, const uint64_t length) noexcept
+		{
+			uint64_t position = 0;
+			for (; position + 32 <= length; position += 32)
+			{
+				auto *block_pointer = reinterpret_cast<__m256i *>(data + position);
+				_mm256_storeu_si256(block_pointer, avx2_fold_case(_mm256_loadu_si256(block_pointer), 'A', 'Z', true));
+			}
+			sse2_lowercase(data + position, length - position);
+		}
+		__attribute__((target("avx2"))) inline void avx2_uppercase(char *data, const uint64_t length) noexcept
+		{
+			uint64_t position = 0;
+			for (; position + 32 <= length; position += 32)
+			{
+				auto *block_pointer = reinterpret_cast<__m256i *>(data + position);
+				_mm256_storeu_si256(block_pointer, avx2_fold_case(_mm256_loadu_si256(block_pointer), 'a', 'z', false));
+			}
+			sse2_uppercase(data + position, length - position);
+		}
+		[[nodiscard]] __attribute__((target("avx2"))) inline uint64_t avx2_mismatch_ignore_case(const char *first_data, const char *second_data, const uint64_t length) noexcept
+		{
+			uint64_t position = 0;
+			for (; position + 32 <= length; position += 32)
+			{
+				const __m256i first_block = avx2_fold_case(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(first_data + position)), 'A', 'Z', true);
+				const __m256i second_block = avx2_fold_case(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(second_data + position)), 'A', 'Z', true);
+				const auto equal_mask = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(first_block, second_block)));
+				if (equal_mask != 0xFFFFFFFFU)
+				{
+					return position + static_cast<uint64_t>(std::countr_zero(~equal_mask));
+				}
+			}
+			return position + sse2_mismatch_ignore_case(first_data + position, second_data + position, length - position);
+		}
+#endif
+		[[nodiscard]] inline kernel_table select_kernels() noexcept
+		{
+#if defined(SIMULATE_STRING_X86_DISPATCH)
+			__builtin_cpu_init();
+			if (__builtin_cpu_supports("avx2"))
+			{
+				return {avx2_find_byte, avx2_find_substring, avx2_rfind_substring, avx2_find_any, avx2_lowercase, avx2_uppercase, avx2_mismatch_ignore_case};
+			}
+			return {sse2_find_byte, sse2_find_substring, sse2_rfind_substring, sse2_find_any, sse2_lowercase, sse2_uppercase, sse2_mismatch_ignore_case};
+#else
+			return {scalar_find_byte, scalar_find_substring, scalar_rfind_substring, scalar_find_any, scalar_lowercase, scalar_uppercase, scalar_mismatch_ignore_case};
+#endif
+		}
+		[[nodiscard]] inline const kernel_table &active_kernels() noexcept
+		{
+			static const kernel_table kernel_table_instance = select_kernels();
+			return kernel_table_instance;
+		}
+	}
 	/*
 			* @brief  #### `string` 类
 
@@ -26,11 +434,11 @@ namespace string_container
 
 			* 成员变量:
 
-			* * - `_data`: 指向字符数组的指针，存储字符串数据
+			* * - `_data`: 指向当前字符数组的指针，短字符串指向对象内的 `_local_buffer`，长字符串指向堆内存
 			*
 			* * - `_size`: 字符串当前长度（不包含终止符 '\0'）
 			*
-			* * - `_capacity`: 字符串当前容量（可容纳的最大字符数，含终止符）
+			* * - `_capacity` / `_local_buffer`: 共用同一块空间，堆模式下存容量（不含终止符），短字符串模式下直接存放至多 23 个字符和终止符
 
 			* 迭代器相关方法:
 
@@ -106,9 +514,17 @@ namespace string_container
 
 			* 字符串处理方法:
 
-			* * - `uppercase()`: 将字符串转换为大写
+			* * - `uppercase()`: 将字符串转换为大写（向量化）
 			*
-			* * - `lowercase()`: 将字符串转换为小写
+			* * - `lowercase()`: 将字符串转换为小写（向量化）
+			*
+			* * - `find()` / `rfind()`: 正向 / 反向查找字符或子串，返回位置，找不到返回 `nops`（向量化）
+			*
+			* * - `find_first_of()`: 查找字符集合中任意字符第一次出现的位置（向量化）
+			*
+			* * - `compare_ignore_case()` / `equal_ignore_case()`: 忽略 ASCII 大小写比较（向量化）
+			*
+			* * - `split()`: 按字符或子串切分，返回指向本字符串内部的 `std::string_view`，不拷贝；字符串修改或析构后视图失效
 			*
 			* * - `sub_string()`: 提取从指定位置开始或指定范围的子字符串
 			*
@@ -134,6 +550,10 @@ namespace string_container
 			*
 			* * - `operator>`: 判断当前字符串是否大于另一个字符串（字典序）
 			*
+			* * - `==` / `<` / `>` 另有 `std::string_view` 和 `const char*` 的重载（含左操作数版本），比较时不分配内存
+			*
+			* * - `operator std::string_view`: 隐式转换为只读视图，可直接传给接受 `std::string_view` 的接口
+			*
 			* * - 友元 `operator<<`: 输出字符串到流
 			*
 			* * - 友元 `operator>>`: 从流读取字符串
@@ -144,7 +564,9 @@ namespace string_container
 			*
 			* * - 包含异常处理，对越界访问等情况抛出异常
 			*
-			* * - 自动扩容机制，容量不足时翻倍扩展（初始容量为 2）
+			* * - 短字符串优化：长度不超过 23 的字符串（包括默认构造的 " "）直接存在对象内，不分配堆内存
+			*
+			* * - 自动扩容机制，容量不足时翻倍扩展
 			*
 			* * - 所有字符串以 '\0' 结尾，兼容 C 风格字符串操作
 
@@ -156,16 +578,102 @@ namespace string_container
 			*
 			* * - 与标准库 `std::string` 接口类似，但实现细节可能不同
 			*
-			* * - 移动构造后原字符串对象会被重置（内部指针为 nullptr）
+			* * - 移动构造 / 移动赋值后原字符串对象变为空字符串，仍可继续使用
+			*
+			* * - 短字符串存放在对象内部，移动或交换后原来取得的迭代器和 `c_str()` 指针会失效
 
 			* 详细请参考 https://github.com/Hatedatastructures/Custom-libraries/blob/main/template_container.md
 	*/
 	class string
 	{
 	private:
+		static constexpr uint64_t local_capacity = 23;
 		char *_data;
 		uint64_t _size;
-		uint64_t _capacity;
+		union
+		{
+			uint64_t _capacity;
+			char _local_buffer[local_capacity + 1];
+		};
+		[[nodiscard]] bool is_local() const noexcept
+		{
+			return _data == _local_buffer;
+		}
+		void become_local() noexcept
+		{
+			// 回到对象内缓冲区的空字符串状态，不释放原有内存，由调用者负责
+			_data = _local_buffer;
+			_size = 0;
+			_local_buffer[0] = '\0';
+		}
+		void release_resources() noexcept
+		{
+			if (!is_local())
+			{
+				delete[] _data;
+			}
+		}
+		void assign_characters(const char *str_data, const uint64_t &str_length)
+		{
+			// 容量够用就原地覆盖（memmove 允许源和目标重叠），不够再整体重新分配，不需要保留旧内容
+			if (str_length > capacity())
+			{
+				char *temporary_str_array = new char[str_length + 1];
+				std::memcpy(temporary_str_array, str_data, str_length);
+				release_resources();
+				_data = temporary_str_array;
+				_capacity = str_length;
+			}
+			else
+			{
+				std::memmove(_data, str_data, str_length);
+			}
+			_size = str_length;
+			_data[_size] = '\0';
+		}
+		void steal_resources(string &str_data) noexcept
+		{
+			// 堆内存直接接管指针，对象内缓冲区只能拷贝
+			if (str_data.is_local())
+			{
+				_data = _local_buffer;
+				std::memcpy(_local_buffer, str_data._local_buffer, str_data._size + 1);
+			}
+			else
+			{
+				_data = str_data._data;
+				_capacity = str_data._capacity;
+			}
+			_size = str_data._size;
+			str_data.become_local();
+		}
+		[[nodiscard]] uint64_t inside_offset(const char *source_pointer) const noexcept
+		{
+			// 源指针落在自身 [_data, _data + _size] 内时返回它的偏移，否则返回 nops；扩容会释放旧缓冲区，只能按偏移重新定位
+			const auto source_address = reinterpret_cast<uintptr_t>(source_pointer);
+			const auto data_address = reinterpret_cast<uintptr_t>(_data);
+			return source_address >= data_address && source_address <= data_address + _size ? source_address - data_address : nops;
+		}
+		void fill_gap(const uint64_t gap_position, const char *sub_string, const uint64_t source_offset, const uint64_t len) noexcept
+		{
+			// 已经把 gap_position 之后的内容后移了 len，把子串填进空位；子串取自自身时，插入点之前的部分没动，之后的部分跟着后移了 len
+			if (source_offset == nops)
+			{
+				std::memcpy(_data + gap_position, sub_string, len);
+				return;
+			}
+			const uint64_t front_part = source_offset >= gap_position ? 0 : (gap_position - source_offset < len ? gap_position - source_offset : len);
+			std::memcpy(_data + gap_position, _data + source_offset, front_part);
+			std::memcpy(_data + gap_position + front_part, _data + source_offset + front_part + len, len - front_part);
+		}
+		void grow_for(const uint64_t &required_capacity)
+		{
+			// 追加时按 2 倍增长，避免连续拼接退化成平方复杂度
+			if (required_capacity > capacity())
+			{
+				allocate_resources(required_capacity > capacity() * 2 ? required_capacity : capacity() * 2);
+			}
+		}
 
 	public:
 		using iterator = char *;
@@ -225,7 +733,7 @@ namespace string_container
 
 		[[nodiscard]] uint64_t capacity() const noexcept
 		{
-			return _capacity;
+			return is_local() ? local_capacity : _capacity;
 		}
 
 		[[nodiscard]] const char *c_str() const noexcept
@@ -244,113 +752,194 @@ namespace string_container
 		} // 返回头字符
 
 		string(const char *str_data = " ")
-				: _size(str_data == nullptr ? 0 : strlen(str_data)), _capacity(_size)
+				: _data(_local_buffer), _size(0)
 		{
-			// 传进来的字符串是常量字符串，不能直接修改，需要拷贝一份，并且常量字符串在数据段(常量区)浅拷贝会导致程序崩溃
+			// 传进来的字符串是常量字符串，不能直接修改，需要拷贝一份；只扫描一次长度，短字符串直接放进对象内
+			_local_buffer[0] = '\0';
 			if (str_data != nullptr)
 			{
-				_data = new char[_capacity + 1];
-				std::strncpy(_data, str_data, std::strlen(str_data));
-				_data[_size] = '\0';
-			}
-			else
-			{
-				_data = new char[1];
-				_data[0] = '\0';
+				assign_characters(str_data, std::strlen(str_data));
 			}
 		}
 		string(char *&&str_data) noexcept
-				: _data(nullptr), _size(str_data == nullptr ? 0 : strlen(str_data)), _capacity(_size)
+				: _data(_local_buffer), _size(0)
 		{
-			// 移动构造函数，拿传入对象的变量初始化本地变量，对于涉及开辟内存的都要深拷贝
+			// 接管传入的堆上字符数组（必须由 new[] 分配），不再拷贝
+			_local_buffer[0] = '\0';
 			if (str_data != nullptr)
 			{
+				_size = std::strlen(str_data);
 				_data = str_data;
+				_capacity = _size;
 				str_data = nullptr;
 			}
-			else
-			{
-				_data = new char[1];
-				_data[0] = '\0';
-			}
 		}
 		string(const string &str_data)
-				: _data(nullptr), _size(str_data._size), _capacity(str_data._capacity)
+				: _data(_local_buffer), _size(0)
 		{
-			// 拷贝构造函数，拿传入对象的变量初始化本地变量，对于涉及开辟内存的都要深拷贝
-			uint64_t capacity = str_data._capacity;
-			_data = new char[capacity + 1];
-			// algorithm::copy(_data,_data+capacity,str_data._data); const对象出错
-			std::strcpy(_data, str_data._data);
+			// 拷贝构造函数，只按实际长度分配，短字符串不分配堆内存
+			_local_buffer[0] = '\0';
+			assign_characters(str_data._data, str_data._size);
 		}
 		string(string &&str_data) noexcept
-				: _data(nullptr), _size(str_data._size), _capacity(str_data._capacity)
+				: _data(_local_buffer), _size(0)
 		{
-			// 移动构造函数，拿传入对象的变量初始化本地变量，对于涉及开辟内存的都要深拷贝
-			//  template_container::algorithm::swap(str_data._data,_data);
-			_data = str_data._data;
-			_size = str_data._size;
-			_capacity = str_data._capacity;
-			str_data._data = nullptr;
+			steal_resources(str_data);
 		}
 		string(const std::initializer_list<char> str_data)
+				: _data(_local_buffer), _size(0)
 		{
 			// 初始化列表构造函数
-			_size = str_data.size();
-			_capacity = _size;
-			_data = new char[_capacity + 1];
-			standard_con::algorithm::copy(str_data.begin(), str_data.end(), _data);
-			_data[_size] = '\0';
+			_local_buffer[0] = '\0';
+			assign_characters(str_data.begin(), str_data.size());
 		}
 		~string() noexcept
 		{
-			delete[] _data;
+			release_resources();
 			_data = nullptr;
-			_capacity = _size = 0;
+			_size = 0;
 		}
 		string &uppercase() noexcept
 		{
 			// 字符串转大写
-			for (string::iterator start_position = _data; start_position != _data + _size; start_position++)
+			string_kernels::active_kernels().uppercase(_data, _size);
+			return *this;
+		}
+		string &lowercase() noexcept
+		{
+			// 字符串转小写
+			string_kernels::active_kernels().lowercase(_data, _size);
+			return *this;
+		}
+		operator std::string_view() const noexcept
+		{
+			return {_data, _size};
+		}
+		[[nodiscard]] uint64_t find(const char &target_character, const uint64_t &start_position = 0) const noexcept
+		{
+			if (start_position >= _size)
 			{
-				if (*start_position >= 'a' && *start_position <= 'z')
+				return nops;
+			}
+			const uint64_t match_position = string_kernels::active_kernels().find_byte(_data + start_position, _size - start_position, target_character);
+			return match_position == nops ? nops : start_position + match_position;
+		}
+		[[nodiscard]] uint64_t find(const std::string_view sub_string_view, const uint64_t &start_position = 0) const noexcept
+		{
+			// 查找子串：空子串匹配起始位置，单字符退化为字符查找
+			if (start_position > _size || sub_string_view.size() > _size - start_position)
+			{
+				return nops;
+			}
+			if (sub_string_view.size() <= 1)
+			{
+				return sub_string_view.empty() ? start_position : find(sub_string_view[0], start_position);
+			}
+			const uint64_t match_position = string_kernels::active_kernels().find_substring(_data + start_position, _size - start_position,
+																																											sub_string_view.data(), sub_string_view.size());
+			return match_position == nops ? nops : start_position + match_position;
+		}
+		[[nodiscard]] uint64_t rfind(const char &target_character, const uint64_t &start_position = nops) const noexcept
+		{
+			// 反向查找：返回不大于 start_position 的最后一个匹配位置
+			for (uint64_t match_position = (start_position < _size ? start_position + 1 : _size); match_position-- > 0;)
+			{
+				if (_data[match_position] == target_character)
 				{
-					*start_position -= 32;
+					return match_position;
 				}
 			}
-			return *this;
+			return nops;
 		}
-		string &lowercase() noexcept
+		[[nodiscard]] uint64_t rfind(const std::string_view sub_string_view, const uint64_t &start_position = nops) const noexcept
 		{
-			// 字符串转小写
-			for (string::iterator start_position = _data; start_position != _data + _size; start_position++)
+			if (sub_string_view.size() > _size)
+			{
+				return nops;
+			}
+			const uint64_t last_start = _size - sub_string_view.size() < start_position ? _size - sub_string_view.size() : start_position;
+			if (sub_string_view.size() <= 1)
+			{
+				return sub_string_view.empty() ? last_start : rfind(sub_string_view[0], last_start);
+			}
+			return string_kernels::active_kernels().rfind_substring(_data, last_start + sub_string_view.size(), sub_string_view.data(), sub_string_view.size());
+		}
+		[[nodiscard]] uint64_t find_first_of(const std::string_view character_set, const uint64_t &start_position = 0) const noexcept
+		{
+			if (start_position >= _size || character_set.empty())
+			{
+				return nops;
+			}
+			const uint64_t match_position = string_kernels::active_kernels().find_any(_data + start_position, _size - start_position,
+																																								 character_set.data(), character_set.size());
+			return match_position == nops ? nops : start_position + match_position;
+		}
+		[[nodiscard]] int compare_ignore_case(const std::string_view compare_string) const noexcept
+		{
+			// 忽略大小写的字典序比较：小于返回负数，相等返回 0，大于返回正数
+			const uint64_t min_len = _size < compare_string.size() ? _size : compare_string.size();
+			const uint64_t mismatch_position = string_kernels::active_kernels().mismatch_ignore_case(_data, compare_string.data(), min_len);
+			if (mismatch_position < min_len)
+			{
+				const auto self_character = static_cast<unsigned char>(string_kernels::ascii_lower(_data[mismatch_position]));
+				const auto compare_character = static_cast<unsigned char>(string_kernels::ascii_lower(compare_string[mismatch_position]));
+				return self_character < compare_character ? -1 : 1;
+			}
+			return _size == compare_string.size() ? 0 : (_size < compare_string.size() ? -1 : 1);
+		}
+		[[nodiscard]] bool equal_ignore_case(const std::string_view compare_string) const noexcept
+		{
+			return _size == compare_string.size() && string_kernels::active_kernels().mismatch_ignore_case(_data, compare_string.data(), _size) == _size;
+		}
+		[[nodiscard]] standard_con::vector<std::string_view> split(const char &delimiter) const
+		{
+			// 按单个字符切分，相邻分隔符之间的空段也会保留
+			standard_con::vector<std::string_view> split_result;
+			uint64_t segment_begin = 0;
+			while (true)
 			{
-				if (*start_position >= 'A' && *start_position <= 'Z')
+				const uint64_t delimiter_position = find(delimiter, segment_begin);
+				if (delimiter_position == nops)
 				{
-					*start_position += 32;
+					split_result.push_back(std::string_view(_data + segment_begin, _size - segment_begin));
+					return split_result;
 				}
+				split_result.push_back(std::string_view(_data + segment_begin, delimiter_position - segment_begin));
+				segment_begin = delimiter_position + 1;
+			}
+		}
+		[[nodiscard]] standard_con::vector<std::string_view> split(const std::string_view delimiter) const
+		{
+			// 按子串切分（如 "\r\n"），空分隔符时整个字符串作为唯一一段
+			standard_con::vector<std::string_view> split_result;
+			if (delimiter.empty())
+			{
+				split_result.push_back(std::string_view(_data, _size));
+				return split_result;
+			}
+			uint64_t segment_begin = 0;
+			while (true)
+			{
+				const uint64_t delimiter_position = find(delimiter, segment_begin);
+				if (delimiter_position == nops)
+				{
+					split_result.push_back(std::string_view(_data + segment_begin, _size - segment_begin));
+					return split_result;
+				}
+				split_result.push_back(std::string_view(_data + segment_begin, delimiter_position - segment_begin));
+				segment_begin = delimiter_position + delimiter.size();
 			}
-			return *this;
 		}
-		// uint64_t str_substring_kmp(const char*& sub_string)
-		// {
-		//     //查找子串
-		// }
 		string &prepend(const char *sub_string)
 		{
-			// 前duan插入子串
+			// 前端插入子串：扩容后原内容整体后移，再把子串拷到开头，不需要临时缓冲区
 			uint64_t len = strlen(sub_string);
 			uint64_t new_size = _size + len;
-			allocate_resources(new_size);
-			char *temporary_buffers = new char[_capacity + 1];
-			// 临时变量
-			memmove(temporary_buffers, _data, _size + 1);
-			memmove(_data, sub_string, len);
-			memmove(_data + len, temporary_buffers, _size + 1);
-			// 比memcpy更安全，memcpy会覆盖原有数据，memmove会先拷贝到临时变量再拷贝到目标地址
+			const uint64_t source_offset = inside_offset(sub_string);
+			grow_for(new_size);
+			std::memmove(_data + len, _data, _size + 1);
+			fill_gap(0, sub_string, source_offset, len);
 			_size = new_size;
-			_data[_size] = '\0';
-			delete[] temporary_buffers;
 			return *this;
 		}
 		string &insert_sub_string(const char *sub_string, const uint64_t &start_position)
@@ -364,16 +953,12 @@ namespace string_container
 				}
 				uint64_t len = strlen(sub_string);
 				uint64_t new_size = _size + len;
-				allocate_resources(new_size);
-				char *temporary_buffers = new char[new_size + 1];
-				// 临时变量
-				memmove(temporary_buffers, _data, _size + 1);
-				// 从oid_pos开始插入
-				memmove(_data + start_position + len, temporary_buffers + start_position, _size - start_position + 1);
-				memmove(_data + start_position, sub_string, len);
+				const uint64_t source_offset = inside_offset(sub_string);
+				grow_for(new_size);
+				// 从start_position开始的内容连同终止符整体后移，再把子串填进空出来的位置
+				std::memmove(_data + start_position + len, _data + start_position, _size - start_position + 1);
+				fill_gap(start_position, sub_string, source_offset, len);
 				_size = new_size;
-				_data[_size] = '\0';
-				delete[] temporary_buffers;
 				return *this;
 			}
 			catch (const custom_exception::fault &process)
@@ -398,11 +983,7 @@ namespace string_container
 				throw;
 			}
 			string result;
-			uint64_t sub_len = _size - start_position;
-			result.allocate_resources(sub_len);
-			std::strncpy(result._data, _data + start_position, sub_len);
-			result._size = sub_len;
-			result._data[result._size] = '\0';
+			result.assign_characters(_data + start_position, _size - start_position);
 			return result;
 		}
 		[[nodiscard]] string sub_string_from(const uint64_t &start_position) const
@@ -421,11 +1002,7 @@ namespace string_container
 				throw;
 			}
 			string result;
-			uint64_t sub_len = _size - start_position;
-			result.allocate_resources(sub_len);
-			std::strncpy(result._data, _data + start_position, sub_len);
-			result._size = sub_len;
-			result._data[result._size] = '\0';
+			result.assign_characters(_data + start_position, _size - start_position);
 			return result;
 		}
 		[[nodiscard]] string sub_string(const uint64_t &start_position, const uint64_t &terminate_position) const
@@ -444,37 +1021,26 @@ namespace string_container
 				throw;
 			}
 			string result;
-			uint64_t sub_len = terminate_position - start_position;
-			result.allocate_resources(sub_len);
-			// strncpy更安全
-			std::strncpy(result._data, _data + start_position, sub_len);
-			result._size = sub_len;
-			result._data[result._size] = '\0';
+			result.assign_characters(_data + start_position, terminate_position - start_position);
 			return result;
 		}
 		void allocate_resources(const uint64_t &new_inaugurate_capacity)
 		{
 			// 检查string空间大小，来分配内存
-			if (new_inaugurate_capacity <= _capacity)
+			if (new_inaugurate_capacity <= capacity())
 			{
-				// 防止无意义频繁拷贝
+				// 防止无意义频繁拷贝，对象内缓冲区放得下时也不分配
 				return;
 			}
 			char *temporary_str_array = new char[new_inaugurate_capacity + 1];
 			std::memcpy(temporary_str_array, _data, _size + 1);
-
-			temporary_str_array[_size] = '\0';
-			delete[] _data;
+			release_resources();
 			_data = temporary_str_array;
 			_capacity = new_inaugurate_capacity;
 		}
 		string &push_back(const char &temporary_str_data)
 		{
-			if (_size == _capacity)
-			{
-				uint64_t newcapacity = _capacity == 0 ? 2 : _capacity * 2;
-				allocate_resources(newcapacity);
-			}
+			grow_for(_size + 1);
 			_data[_size] = temporary_str_data;
 			++_size;
 			_data[_size] = '\0';
@@ -482,13 +1048,8 @@ namespace string_container
 		}
 		string &push_back(const string &temporary_string_data)
 		{
-			uint64_t len = _size + temporary_string_data._size;
-			if (len > _capacity)
-			{
-				uint64_t new_container_capacity = len;
-				allocate_resources(new_container_capacity);
-			}
-			std::strncpy(_data + _size, temporary_string_data._data, temporary_string_data.size());
+			grow_for(_size + temporary_string_data._size);
+			std::memcpy(_data + _size, temporary_string_data._data, temporary_string_data.size());
 			_size = _size + temporary_string_data._size;
 			_data[_size] = '\0';
 			return *this;
@@ -500,12 +1061,9 @@ namespace string_container
 				return *this;
 			}
 			const uint64_t len = strlen(temporary_str_ptr_data);
-			const uint64_t new_container_capacity = len + _size;
-			if (new_container_capacity > _capacity)
-			{
-				allocate_resources(new_container_capacity);
-			}
-			std::strncpy(_data + _size, temporary_str_ptr_data, len);
+			const uint64_t source_offset = inside_offset(temporary_str_ptr_data);
+			grow_for(len + _size);
+			std::memcpy(_data + _size, source_offset == nops ? temporary_str_ptr_data : _data + source_offset, len);
 			_size = _size + len;
 			_data[_size] = '\0';
 			return *this;
@@ -513,7 +1071,7 @@ namespace string_container
 		string &resize(const uint64_t &inaugurate_size, const char &default_data = '\0')
 		{
 			// 扩展字符串长度
-			if (inaugurate_size > _capacity)
+			if (inaugurate_size > _size)
 			{
 				// 长度大于容量，重新开辟内存
 				try
@@ -525,10 +1083,7 @@ namespace string_container
 					std::cerr << new_charptr_abnormal.what() << std::endl;
 					throw;
 				}
-				for (string::iterator start_position = _data + _size; start_position != _data + inaugurate_size; start_position++)
-				{
-					*start_position = default_data;
-				}
+				std::memset(_data + _size, default_data, inaugurate_size - _size);
 				_size = inaugurate_size;
 				_data[_size] = '\0';
 			}
@@ -556,9 +1111,21 @@ namespace string_container
 		}
 		string &swap(string &str_data) noexcept
 		{
-			standard_con::algorithm::swap(_data, str_data._data);
-			standard_con::algorithm::swap(_size, str_data._size);
-			standard_con::algorithm::swap(_capacity, str_data._capacity);
+			if (this == &str_data)
+			{
+				return *this;
+			}
+			if (!is_local() && !str_data.is_local())
+			{
+				standard_con::algorithm::swap(_data, str_data._data);
+				standard_con::algorithm::swap(_size, str_data._size);
+				standard_con::algorithm::swap(_capacity, str_data._capacity);
+				return *this;
+			}
+			// 有一方在对象内缓冲区时不能只交换指针，借助移动完成交换
+			string temporary_string(std::move(str_data));
+			str_data.steal_resources(*this);
+			steal_resources(temporary_string);
 			return *this;
 		}
 		[[nodiscard]] string reverse() const
@@ -623,13 +1190,7 @@ namespace string_container
 			{
 				if (this != &str_data) // 防止无意义拷贝
 				{
-					delete[] _data;
-					uint64_t capacity = str_data._capacity;
-					_data = new char[capacity + 1];
-					std::strncpy(_data, str_data._data, str_data.size());
-					_capacity = str_data._capacity;
-					_size = str_data._size;
-					_data[_size] = '\0';
+					assign_characters(str_data._data, str_data._size);
 				}
 			}
 			catch (const std::bad_alloc &process)
@@ -643,13 +1204,7 @@ namespace string_container
 		{
 			try
 			{
-				delete[] _data;
-				uint64_t capacity = strlen(str_data);
-				_data = new char[capacity + 1];
-				std::strncpy(_data, str_data, strlen(str_data));
-				_capacity = capacity;
-				_size = capacity;
-				_data[_size] = '\0';
+				assign_characters(str_data, strlen(str_data));
 			}
 			catch (const std::bad_alloc &process)
 			{
@@ -662,37 +1217,22 @@ namespace string_container
 		{
 			if (this != &str_data)
 			{
-				delete[] _data;
-				_size = str_data._size;
-				_capacity = str_data._capacity;
-				_data = str_data._data;
-				str_data._data = nullptr;
+				release_resources();
+				steal_resources(str_data);
 			}
 			return *this;
 		}
 		string &operator+=(const string &str_data)
 		{
-			uint64_t len = _size + str_data._size;
-			allocate_resources(len);
-			std::strncpy(_data + _size, str_data._data, str_data.size());
+			grow_for(_size + str_data._size);
+			std::memcpy(_data + _size, str_data._data, str_data.size());
 			_size = _size + str_data._size;
 			_data[_size] = '\0';
 			return *this;
 		}
 		bool operator==(const string &str_data) const noexcept
 		{
-			if (_size != str_data._size)
-			{
-				return false;
-			}
-			for (uint64_t compare_traversal = 0; compare_traversal < _size; compare_traversal++)
-			{
-				if (_data[compare_traversal] != str_data._data[compare_traversal])
-				{
-					return false;
-				}
-			}
-			return true;
+			return _size == str_data._size && std::memcmp(_data, str_data._data, _size) == 0;
 		}
 		bool operator<(const string &str_data) const noexcept
 		{
@@ -718,6 +1258,47 @@ namespace string_container
 			}
 			return _size > str_data._size;
 		}
+		// 与 `std::string_view` / `const char*` 直接比较，不构造临时字符串；透明比较器和透明哈希查找依赖这些重载
+		bool operator==(const std::string_view string_view_data) const noexcept
+		{
+			return std::string_view(_data, _size) == string_view_data;
+		}
+		bool operator==(const char *str_data) const noexcept
+		{
+			return std::string_view(_data, _size) == std::string_view(str_data);
+		}
+		bool operator<(const std::string_view string_view_data) const noexcept
+		{
+			return std::string_view(_data, _size) < string_view_data;
+		}
+		bool operator<(const char *str_data) const noexcept
+		{
+			return std::string_view(_data, _size) < std::string_view(str_data);
+		}
+		bool operator>(const std::string_view string_view_data) const noexcept
+		{
+			return std::string_view(_data, _size) > string_view_data;
+		}
+		bool operator>(const char *str_data) const noexcept
+		{
+			return std::string_view(_data, _size) > std::string_view(str_data);
+		}
+		friend bool operator<(const std::string_view string_view_data, const string &str_data) noexcept
+		{
+			return str_data > string_view_data;
+		}
+		friend bool operator<(const char *left_data, const string &str_data) noexcept
+		{
+			return str_data > left_data;
+		}
+		friend bool operator>(const std::string_view string_view_data, const string &str_data) noexcept
+		{
+			return str_data < string_view_data;
+		}
+		friend bool operator>(const char *left_data, const string &str_data) noexcept
+		{
+			return str_data < left_data;
+		}
 		char &operator[](const uint64_t &access_location)
 		{
 			try
@@ -762,8 +1343,8 @@ namespace string_container
 			string return_string_object;
 			const uint64_t object_len = _size + string_array._size;
 			return_string_object.allocate_resources(object_len);
-			std::strncpy(return_string_object._data, _data, size());
-			std::strncpy(return_string_object._data + _size, string_array._data, string_array.size());
+			std::memcpy(return_string_object._data, _data, size());
+			std::memcpy(return_string_object._data + _size, string_array._data, string_array.size());
 			return_string_object._size = _size + string_array._size;
 			return_string_object._data[return_string_object._size] = '\0';
 			return return_string_object; // 不能转为右值，编译器会再做一次优化
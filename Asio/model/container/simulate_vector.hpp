@@ -1,8 +1,425 @@
 #pragma once
+#include <cstring>
+#include <memory>
+#include <new>
+#include <type_traits>
 #include "simulate_exception.hpp"
 #include "simulate_algorithm.hpp"
 namespace vector_container
 {
+  /*
+   * @brief  #### `vector_base` 类模板
+
+      *   - `vector` 和 `small_vector` 共用的实现：三个指针、分配器，以及扩容搬运、插入、删除等与存储位置无关的逻辑
+
+      *   - 按 CRTP 方式继承，修改类接口返回派生类引用，派生类只负责存储从哪里来、到哪里去
+
+      * 模板参数:
+
+      * * - `derived_type`: 派生的容器类型
+      *
+      * * - `vector_type`: 元素类型
+      *
+      * * - `vector_allocator`: 分配器类型
+
+      * 派生类需要提供:
+
+      * * - `release_buffer()`: 释放当前数组的内存（不析构元素、不修改指针），不是自己分配的内存时什么都不做
+
+      * 注意事项:
+
+      * * - 扩容时容量为 0 的容器先分配 10 个位置，否则容量翻倍
+      *
+      * * - 构造、析构、移动和交换与存储方式相关，由派生类实现
+  */
+  template <typename derived_type, typename vector_type, typename vector_allocator>
+  class vector_base
+  {
+  public:
+    using iterator = vector_type *;
+    using const_iterator = const vector_type *;
+    using reverse_iterator = iterator;
+    using const_reverse_iterator = const_iterator;
+    using allocator_type = vector_allocator;
+
+  protected:
+    using allocator_traits = std::allocator_traits<vector_allocator>;
+    iterator _data_pointer;     // 指向数据的头
+    iterator _size_pointer;     // 指向数据的尾
+    iterator _capacity_pointer; // 指向容量的尾
+    [[no_unique_address]] vector_allocator allocator_object;
+    vector_base() noexcept(std::is_nothrow_default_constructible_v<vector_allocator>)
+        : _data_pointer(nullptr), _size_pointer(nullptr), _capacity_pointer(nullptr), allocator_object()
+    {
+      ;
+    }
+    explicit vector_base(const vector_allocator &allocator_data) noexcept
+        : _data_pointer(nullptr), _size_pointer(nullptr), _capacity_pointer(nullptr), allocator_object(allocator_data)
+    {
+      ;
+    }
+    explicit vector_base(vector_allocator &&allocator_data) noexcept
+        : _data_pointer(nullptr), _size_pointer(nullptr), _capacity_pointer(nullptr), allocator_object(std::move(allocator_data))
+    {
+      ;
+    }
+    vector_base(const vector_base &) = delete;
+    vector_base &operator=(const vector_base &) = delete;
+    ~vector_base() noexcept = default;
+    [[nodiscard]] derived_type &derived_object() noexcept
+    {
+      return static_cast<derived_type &>(*this);
+    }
+    [[nodiscard]] uint64_t growth_capacity(const uint64_t &required_capacity) const noexcept
+    {
+      const uint64_t doubled_capacity = capacity() == 0 ? 10 : capacity() * 2;
+      return doubled_capacity < required_capacity ? required_capacity : doubled_capacity;
+    }
+    void destroy_range(iterator destroy_begin, iterator destroy_end) noexcept
+    {
+      if constexpr (!std::is_trivially_destructible_v<vector_type>)
+      {
+        for (; destroy_begin != destroy_end; ++destroy_begin)
+        {
+          allocator_traits::destroy(allocator_object, destroy_begin);
+        }
+      }
+    }
+    void relocate_elements(iterator source_begin, iterator source_end, iterator destination)
+    {
+      // 可平凡拷贝的类型整段 memcpy；其余类型移动构造不抛异常时移动，否则拷贝，拷贝失败时旧数组保持不变
+      if constexpr (std::is_trivially_copyable_v<vector_type>)
+      {
+        if (source_begin != source_end)
+        {
+          std::memcpy(static_cast<void *>(destination), static_cast<const void *>(source_begin),
+                      static_cast<uint64_t>(source_end - source_begin) * sizeof(vector_type));
+        }
+      }
+      else
+      {
+        iterator constructed_end = destination;
+        try
+        {
+          for (iterator source_position = source_begin; source_position != source_end; ++source_position, ++constructed_end)
+          {
+            allocator_traits::construct(allocator_object, constructed_end, std::move_if_noexcept(*source_position));
+          }
+        }
+        catch (...)
+        {
+          destroy_range(destination, constructed_end);
+          throw;
+        }
+        destroy_range(source_begin, source_end);
+      }
+    }
+    void adopt_buffer(iterator new_data_pointer, const uint64_t &new_size, const uint64_t &new_container_capacity) noexcept
+    {
+      // 旧元素已经搬走，只释放旧内存再换上新数组
+      derived_object().release_buffer();
+      _data_pointer = new_data_pointer;
+      _size_pointer = _data_pointer + new_size;
+      _capacity_pointer = _data_pointer + new_container_capacity;
+    }
+    void reallocate(const uint64_t &new_container_capacity)
+    {
+      // 新数组只分配不构造，旧元素搬过去后只释放旧内存（元素已在 relocate_elements 中析构）
+      const uint64_t original_size = size();
+      iterator new_data_pointer = allocator_traits::allocate(allocator_object, new_container_capacity);
+      try
+      {
+        relocate_elements(_data_pointer, _size_pointer, new_data_pointer);
+      }
+      catch (...)
+      {
+        allocator_traits::deallocate(allocator_object, new_data_pointer, new_container_capacity);
+        throw;
+      }
+      adopt_buffer(new_data_pointer, original_size, new_container_capacity);
+    }
+    void fill_construct(const uint64_t &fill_count, const vector_type &vector_data)
+    {
+      iterator fill_begin = _size_pointer;
+      try
+      {
+        for (uint64_t fill_traversal = 0; fill_traversal < fill_count; ++fill_traversal, ++_size_pointer)
+        {
+          allocator_traits::construct(allocator_object, _size_pointer, vector_data);
+        }
+      }
+      catch (...)
+      {
+        destroy_range(fill_begin, _size_pointer);
+        _size_pointer = fill_begin;
+        throw;
+      }
+    }
+    template <typename input_iterator>
+    void copy_construct(input_iterator copy_begin, input_iterator copy_end)
+    {
+      iterator copy_destination_begin = _size_pointer;
+      try
+      {
+        for (; copy_begin != copy_end; ++copy_begin, ++_size_pointer)
+        {
+          allocator_traits::construct(allocator_object, _size_pointer, *copy_begin);
+        }
+      }
+      catch (...)
+      {
+        destroy_range(copy_destination_begin, _size_pointer);
+        _size_pointer = copy_destination_begin;
+        throw;
+      }
+    }
+    void check_location(const uint64_t &access_location, const char *function_name) const
+    {
+      try
+      {
+        if (access_location >= size())
+        {
+          throw custom_exception::fault("传入参数越界", function_name, __LINE__);
+        }
+      }
+      catch (const custom_exception::fault &process)
+      {
+        std::cerr << process.what() << " " << process.function_name_get() << " " << process.line_number_get() << std::endl;
+        throw;
+      }
+    }
+
+  public:
+    [[nodiscard]] iterator begin() noexcept
+    {
+      return _data_pointer;
+    }
+
+    [[nodiscard]] iterator end() noexcept
+    {
+      return _size_pointer;
+    }
+
+    [[nodiscard]] const_iterator begin() const noexcept
+    {
+      return _data_pointer;
+    }
+
+    [[nodiscard]] const_iterator end() const noexcept
+    {
+      return _size_pointer;
+    }
+
+    [[nodiscard]] vector_type *data() noexcept
+    {
+      return _data_pointer;
+    }
+
+    [[nodiscard]] const vector_type *data() const noexcept
+    {
+      return _data_pointer;
+    }
+
+    [[nodiscard]] uint64_t size() const noexcept
+    {
+      return static_cast<uint64_t>(_size_pointer - _data_pointer);
+    }
+
+    [[nodiscard]] uint64_t capacity() const noexcept
+    {
+      return static_cast<uint64_t>(_capacity_pointer - _data_pointer);
+    }
+
+    [[nodiscard]] allocator_type get_allocator() const noexcept
+    {
+      return allocator_object;
+    }
+
+    [[nodiscard]] vector_type &front() const noexcept
+    {
+      return head();
+    }
+
+    [[nodiscard]] vector_type &back() const noexcept
+    {
+      return tail();
+    }
+
+    [[nodiscard]] bool empty() const noexcept
+    {
+      return _size_pointer == _data_pointer;
+    }
+
+    [[nodiscard]] vector_type &head() const noexcept
+    {
+      return *_data_pointer;
+    }
+
+    [[nodiscard]] vector_type &tail() const noexcept
+    {
+      return *(_size_pointer - 1);
+    }
+
+    iterator erase(iterator delete_position) noexcept(std::is_nothrow_move_assignable_v<vector_type>)
+    {
+      // 删除元素：后面的元素逐个前移，最后一个位置析构
+      for (iterator next_position = delete_position + 1; next_position != _size_pointer; ++next_position)
+      {
+        *(next_position - 1) = std::move(*next_position);
+      }
+      --_size_pointer;
+      allocator_traits::destroy(allocator_object, _size_pointer);
+      return delete_position; // 返回被删除元素之后的那个元素现在所在的位置
+    }
+    void clear() noexcept
+    {
+      destroy_range(_data_pointer, _size_pointer);
+      _size_pointer = _data_pointer;
+    }
+    derived_type &reserve(const uint64_t &new_container_capacity)
+    {
+      // 只扩容不构造元素，已有元素按 relocate_elements 的规则搬到新数组
+      if (new_container_capacity > capacity())
+      {
+        reallocate(new_container_capacity);
+      }
+      return derived_object();
+    }
+    derived_type &resize(const uint64_t &new_container_size, const vector_type &vector_data = vector_type())
+    {
+      // 调整元素个数：变小时析构多余元素，变大时先扩容再用 vector_data 拷贝构造新元素
+      try
+      {
+        const uint64_t original_size = size();
+        if (new_container_size < original_size)
+        {
+          destroy_range(_data_pointer + new_container_size, _size_pointer);
+          _size_pointer = _data_pointer + new_container_size;
+        }
+        else if (new_container_size > original_size)
+        {
+          if (new_container_size > capacity())
+          {
+            // vector_data 可能引用本容器里的元素，先拷贝一份再扩容
+            const vector_type fill_value(vector_data);
+            reallocate(new_container_size);
+            fill_construct(new_container_size - original_size, fill_value);
+          }
+          else
+          {
+            fill_construct(new_container_size - original_size, vector_data);
+          }
+        }
+      }
+      catch (const std::bad_alloc &process)
+      {
+        std::cerr << process.what() << std::endl;
+        throw;
+      }
+      return derived_object();
+    }
+    derived_type &size_adjust(const uint64_t &data_size, const vector_type &padding_temp_data = vector_type())
+    {
+      // 与 resize 相同：调整元素个数，多出的位置用 padding_temp_data 填充
+      return resize(data_size, padding_temp_data);
+    }
+    template <typename... construct_arguments>
+    vector_type &emplace_back(construct_arguments &&...vector_type_arguments)
+    {
+      // 原地构造，不经过默认构造 + 赋值
+      if (_size_pointer == _capacity_pointer)
+      {
+        // 先在新数组的末尾构造新元素，再搬运旧元素，这样参数引用本容器里的元素时也是安全的
+        const uint64_t original_size = size();
+        const uint64_t new_container_capacity = growth_capacity(original_size + 1);
+        iterator new_data_pointer = allocator_traits::allocate(allocator_object, new_container_capacity);
+        try
+        {
+          allocator_traits::construct(allocator_object, new_data_pointer + original_size, std::forward<construct_arguments>(vector_type_arguments)...);
+        }
+        catch (...)
+        {
+          allocator_traits::deallocate(allocator_object, new_data_pointer, new_container_capacity);
+          throw;
+        }
+        try
+        {
+          relocate_elements(_data_pointer, _size_pointer, new_data_pointer);
+        }
+        catch (...)
+        {
+          allocator_traits::destroy(allocator_object, new_data_pointer + original_size);
+          allocator_traits::deallocate(allocator_object, new_data_pointer, new_container_capacity);
+          throw;
+        }
+        adopt_buffer(new_data_pointer, original_size + 1, new_container_capacity);
+        return *(_size_pointer - 1);
+      }
+      allocator_traits::construct(allocator_object, _size_pointer, std::forward<construct_arguments>(vector_type_arguments)...);
+      ++_size_pointer;
+      return *(_size_pointer - 1);
+    }
+    derived_type &push_back(const vector_type &vector_type_data)
+    {
+      emplace_back(vector_type_data);
+      return derived_object();
+    }
+    derived_type &push_back(vector_type &&vector_type_data)
+    {
+      emplace_back(std::move(vector_type_data));
+      return derived_object();
+    }
+    derived_type &pop_back()
+    {
+      if (_size_pointer > _data_pointer)
+      {                  // 至少有一个元素
+        --_size_pointer; // 尾指针前移
+        allocator_traits::destroy(allocator_object, _size_pointer);
+      }
+      return derived_object();
+    }
+    derived_type &push_front(const vector_type &vector_type_data)
+    {
+      // 头插：先在末尾构造一个元素占位，其余元素依次后移，最后把新值赋给头部
+      vector_type front_value(vector_type_data);
+      if (empty())
+      {
+        emplace_back(std::move(front_value));
+        return derived_object();
+      }
+      emplace_back(std::move(*(_size_pointer - 1)));
+      for (iterator move_position = _size_pointer - 2; move_position != _data_pointer; --move_position)
+      {
+        *move_position = std::move(*(move_position - 1));
+      }
+      *_data_pointer = std::move(front_value);
+      return derived_object();
+    }
+    derived_type &pop_front()
+    {
+      if (!empty())
+      {
+        erase(_data_pointer);
+      }
+      return derived_object();
+    }
+    derived_type &operator+=(const derived_type &vector_data)
+    {
+      if (vector_data.empty())
+      {
+        return derived_object();
+      }
+      if (&vector_data == &derived_object())
+      {
+        // 自拼接：扩容会让源指针失效，先拷贝一份
+        const derived_type self_copy(vector_data);
+        return operator+=(self_copy);
+      }
+      reserve(size() + vector_data.size());
+      copy_construct(vector_data.begin(), vector_data.end());
+      return derived_object();
+    }
+  };
   /*
    * @brief  #### `vector` 类模板
 
@@ -15,6 +432,8 @@ namespace vector_container
       * 模板参数:
 
       * * - `vector_type`: 容器中存储的元素类型
+      *
+      * * - `vector_allocator`: 内存分配器类型，默认为 `std::allocator<vector_type>`，通过 `std::allocator_traits` 分配和构造
 
       * 类型别名:
 
@@ -48,9 +467,13 @@ namespace vector_container
       *
       * * - `empty()`: 判断容器是否为空（元素数量为 0）
       *
-      * * - `resize()`: 调整容器容量，不足时填充指定元素，超出时截断
+      * * - `resize()`: 调整元素个数，不足时用指定元素拷贝构造填充，超出时析构截断
+      *
+      * * - `size_adjust()`: 同 `resize()`
       *
-      * * - `size_adjust()`: 调整容器大小，不足时填充指定元素
+      * * - `reserve()`: 只扩充容量，不构造元素
+      *
+      * * - `clear()`: 析构所有元素，保留容量
 
       * 元素访问方法:
 
@@ -64,7 +487,9 @@ namespace vector_container
       *
       * * - `find()`: 根据索引查找元素，超出范围时抛出异常
       *
-      * * - `operator[]`: 通过索引访问元素（支持读写和只读版本）
+      * * - `data()`: 返回底层数组首地址
+      *
+      * * - `operator[]`: 通过索引访问元素（支持读写和只读版本），索引不小于 `size()` 时抛出异常
 
       * 构造函数:
 
@@ -86,11 +511,13 @@ namespace vector_container
 
       * * - `push_back()`: 向容器末尾添加元素（支持拷贝和移动语义）
       *
-      * * - `pop_back()`: 移除容器末尾的元素（尾指针前移）
+      * * - `emplace_back()`: 用参数在容器末尾原地构造元素，返回新元素的引用
+      *
+      * * - `pop_back()`: 析构并移除容器末尾的元素
       *
       * * - `push_front()`: 向容器头部插入元素（元素后移，效率较低）
       *
-      * * - `erase()`: 删除指定位置的元素，后续元素前移，返回下一个元素的迭代器
+      * * - `erase()`: 删除指定位置的元素，后续元素前移，返回原位置（现在是下一个元素）的迭代器
       *
       * * - `swap()`: 与另一个容器交换内部资源（指针和容量信息）
 
@@ -106,6 +533,10 @@ namespace vector_container
 
       * * - 容量自动扩展: 当元素数量达到容量时，容量翻倍（初始容量为 10）
       *
+      * * - 未初始化存储: 容量部分只分配内存不构造对象，元素在插入时才用 placement 方式构造
+      *
+      * * - 扩容搬运: 可平凡拷贝的类型直接 memcpy；其余类型移动构造为 noexcept 时移动，否则拷贝（`std::move_if_noexcept`），拷贝失败时原容器不变
+      *
       * * - 支持移动语义: 减少不必要的元素拷贝，提高性能
       *
       * * - 异常处理: 越界访问等操作会抛出 `fault` 异常
@@ -120,367 +551,412 @@ namespace vector_container
       *
       * * - 越界访问会抛出异常，使用时需确保索引在有效范围内
       *
-      * * - 移动构造/赋值后，原容器会被清空（指针置空），不可再使用
+      * * - 移动构造/赋值后，原容器为空容器，可以继续使用
 
       * 详细请参考 https://github.com/Hatedatastructures/Custom-libraries/blob/main/template_container.md
   */
-  template <typename vector_type>
-  class vector
+  template <typename vector_type, typename vector_allocator = std::allocator<vector_type>>
+  class vector : public vector_base<vector<vector_type, vector_allocator>, vector_type, vector_allocator>
   {
-  public:
-    using iterator = vector_type *;
-    using const_iterator = const vector_type *;
-    using reverse_iterator = iterator;
-    using const_reverse_iterator = const_iterator;
+    using base_type = vector_base<vector<vector_type, vector_allocator>, vector_type, vector_allocator>;
+    friend base_type;
 
-  private:
-    iterator _data_pointer;     // 指向数据的头
-    iterator _size_pointer;     // 指向数据的尾
-    iterator _capacity_pointer; // 指向容量的尾
   public:
-    [[nodiscard]] iterator begin() noexcept
-    {
-      return _data_pointer;
-    }
+    using typename base_type::allocator_type;
+    using typename base_type::const_iterator;
+    using typename base_type::const_reverse_iterator;
+    using typename base_type::iterator;
+    using typename base_type::reverse_iterator;
+    using base_type::capacity;
 
-    [[nodiscard]] iterator end() noexcept
-    {
-      return _size_pointer;
-    }
-    [[nodiscard]] uint64_t size() const noexcept
-    {
-      return _data_pointer ? (_size_pointer - _data_pointer) : 0;
-    }
-
-    [[nodiscard]] uint64_t capacity() const noexcept
-    {
-      return _data_pointer ? (_capacity_pointer - _data_pointer) : 0;
-    }
-
-    [[nodiscard]] vector_type &front() const noexcept
-    {
-      return head();
-    }
-
-    [[nodiscard]] vector_type &back() const noexcept
-    {
-      return tail();
-    }
-
-    [[nodiscard]] bool empty() const noexcept
+  private:
+    using typename base_type::allocator_traits;
+    using base_type::_capacity_pointer;
+    using base_type::_data_pointer;
+    using base_type::_size_pointer;
+    using base_type::allocator_object;
+    using base_type::check_location;
+    using base_type::copy_construct;
+    using base_type::destroy_range;
+    using base_type::fill_construct;
+    using base_type::reallocate;
+    void release_buffer() noexcept
     {
-      return size() == 0;
+      if (_data_pointer != nullptr)
+      {
+        allocator_traits::deallocate(allocator_object, _data_pointer, capacity());
+      }
     }
-
-    [[nodiscard]] vector_type &head() const noexcept
+    void release_storage() noexcept
     {
-      return *_data_pointer;
+      destroy_range(_data_pointer, _size_pointer);
+      release_buffer();
+      _data_pointer = _size_pointer = _capacity_pointer = nullptr;
     }
 
-    [[nodiscard]] vector_type &tail() const noexcept
+  public:
+    vector() noexcept(std::is_nothrow_default_constructible_v<vector_allocator>) : base_type()
     {
-      return *(_size_pointer - 1);
+      ;
     }
-
-    vector() noexcept
+    explicit vector(const vector_allocator &allocator_data) noexcept : base_type(allocator_data)
     {
-      _data_pointer = nullptr;
-      _size_pointer = nullptr;
-      _capacity_pointer = nullptr;
+      ;
     }
-    explicit vector(const uint64_t &container_capacity, const vector_type &vector_data = vector_type())
-        : _data_pointer(new vector_type[container_capacity]), _size_pointer(_data_pointer + container_capacity), _capacity_pointer(_data_pointer + container_capacity)
+    explicit vector(const uint64_t &container_capacity, const vector_type &vector_data = vector_type(), const vector_allocator &allocator_data = vector_allocator())
+        : base_type(allocator_data)
     {
-      for (uint64_t corresponding_location = 0; corresponding_location < container_capacity; corresponding_location++)
+      if (container_capacity != 0)
       {
-        _data_pointer[corresponding_location] = vector_data;
+        reallocate(container_capacity);
+        try
+        {
+          fill_construct(container_capacity, vector_data);
+        }
+        catch (...)
+        {
+          release_storage();
+          throw;
+        }
       }
     }
-    vector(std::initializer_list<vector_type> lightweight_container)
-        : _data_pointer(new vector_type[lightweight_container.size()]), _size_pointer(_data_pointer + lightweight_container.size()), _capacity_pointer(_data_pointer + lightweight_container.size())
+    vector(std::initializer_list<vector_type> lightweight_container, const vector_allocator &allocator_data = vector_allocator())
+        : base_type(allocator_data)
     {
-      // 链式拷贝
-      uint64_t corresponding_location = 0;
-      for (auto &chained_values : lightweight_container)
+      // 初始化列表里的元素是 const 的，只能逐个拷贝构造
+      if (lightweight_container.size() != 0)
       {
-        _data_pointer[corresponding_location] = std::move(chained_values);
-        corresponding_location++;
+        reallocate(lightweight_container.size());
+        try
+        {
+          copy_construct(lightweight_container.begin(), lightweight_container.end());
+        }
+        catch (...)
+        {
+          release_storage();
+          throw;
+        }
       }
     }
     vector_type &find(const uint64_t &find_size)
     {
-      try
+      check_location(find_size, "vector::find");
+      return _data_pointer[find_size];
+    }
+    vector(const vector<vector_type, vector_allocator> &vector_data)
+        : base_type(allocator_traits::select_on_container_copy_construction(vector_data.allocator_object))
+    {
+      // 只按元素个数分配并拷贝构造，不会把对方多余的容量也默认构造一遍
+      if (vector_data.size() != 0)
       {
-        if (find_size >= size())
+        reallocate(vector_data.size());
+        try
         {
-          throw custom_exception::fault("传入数据超出容器范围", "vector::find", __LINE__);
+          copy_construct(vector_data._data_pointer, vector_data._size_pointer);
         }
-        else
+        catch (...)
         {
-          return _data_pointer[find_size];
+          release_storage();
+          throw;
         }
       }
-      catch (const custom_exception::fault &process)
-      {
-        std::cerr << process.what() << " " << process.function_name_get() << " " << process.line_number_get() << std::endl;
-        throw;
-      }
     }
-    vector<vector_type> &size_adjust(const uint64_t &data_size, const vector_type &padding_temp_data = vector_type())
+    vector(vector<vector_type, vector_allocator> &&vector_data) noexcept
+        : base_type(std::move(vector_data.allocator_object))
     {
-      uint64_t container_size = size();
-      uint64_t container_capacity = capacity();
-      if (data_size > container_capacity)
+      _data_pointer = vector_data._data_pointer;
+      _size_pointer = vector_data._size_pointer;
+      _capacity_pointer = vector_data._capacity_pointer;
+      vector_data._data_pointer = vector_data._size_pointer = vector_data._capacity_pointer = nullptr;
+    }
+    ~vector() noexcept
+    {
+      release_storage();
+    }
+    void swap(vector<vector_type, vector_allocator> &vector_data) noexcept
+    {
+      standard_con::algorithm::swap(_data_pointer, vector_data._data_pointer);
+      standard_con::algorithm::swap(_size_pointer, vector_data._size_pointer);
+      standard_con::algorithm::swap(_capacity_pointer, vector_data._capacity_pointer);
+      if constexpr (allocator_traits::propagate_on_container_swap::value)
       {
-        resize(data_size);
-        for (uint64_t assignment_traversal = container_capacity; assignment_traversal < data_size; ++assignment_traversal)
-        {
-          _data_pointer[assignment_traversal] = padding_temp_data;
-        }
+        standard_con::algorithm::swap(allocator_object, vector_data.allocator_object);
       }
-      else
+    }
+    vector_type &operator[](const uint64_t &access_location)
+    {
+      check_location(access_location, "vector::operatot[]");
+      return _data_pointer[access_location];
+    }
+    const vector_type &operator[](const uint64_t &access_location) const
+    {
+      check_location(access_location, "vector::operatot[]");
+      return _data_pointer[access_location];
+    }
+    vector<vector_type, vector_allocator> &operator=(const vector<vector_type, vector_allocator> &vector_data)
+    {
+      if (this != &vector_data)
       {
-        if (data_size > container_size)
-        {
-          for (uint64_t assignment_traversal = container_size; assignment_traversal < data_size; ++assignment_traversal)
-          {
-            _data_pointer[assignment_traversal] = padding_temp_data;
-          }
-        }
-        else if (data_size < container_size)
-        {
-          _size_pointer = _data_pointer + data_size;
-        }
+        vector<vector_type, vector_allocator> return_vector_object(vector_data); // 拷贝构造
+        swap(return_vector_object);                                              // 交换资源，temp析构时会释放原资源
       }
       return *this;
     }
-    vector(const vector<vector_type> &vector_data)
-        : _data_pointer(vector_data.capacity() ? new vector_type[vector_data.capacity()] : nullptr),
-          _size_pointer(_data_pointer + vector_data.size()), _capacity_pointer(_data_pointer + vector_data.capacity())
+    vector<vector_type, vector_allocator> &operator=(vector<vector_type, vector_allocator> &&vector_mobile_data) noexcept
     {
-      for (uint64_t copy_assignment_traversal = 0; copy_assignment_traversal < vector_data.size(); copy_assignment_traversal++)
+      if (this != &vector_mobile_data)
       {
-        _data_pointer[copy_assignment_traversal] = vector_data._data_pointer[copy_assignment_traversal];
+        // 交换后原有资源随 vector_mobile_data 一起释放
+        vector<vector_type, vector_allocator> temporary_vector_object(std::move(vector_mobile_data));
+        swap(temporary_vector_object);
       }
+      return *this;
     }
-    vector(vector<vector_type> &&vector_data) noexcept
+    template <typename const_vector_output_templates, typename const_vector_output_allocator>
+    friend std::ostream &operator<<(std::ostream &vector_ostream, const vector<const_vector_output_templates, const_vector_output_allocator> &dynamic_arrays_data);
+  };
+  template <typename const_vector_output_templates, typename const_vector_output_allocator>
+  std::ostream &operator<<(std::ostream &vector_ostream, const vector<const_vector_output_templates, const_vector_output_allocator> &dynamic_arrays_data)
+  {
+    for (uint64_t input_traversal = 0; input_traversal < dynamic_arrays_data.size(); input_traversal++)
     {
-      _data_pointer = std::move(vector_data._data_pointer);
-      _size_pointer = std::move(vector_data._size_pointer);
-      _capacity_pointer = std::move(vector_data._capacity_pointer);
-      vector_data._data_pointer = vector_data._size_pointer = vector_data._capacity_pointer = nullptr;
+      vector_ostream << dynamic_arrays_data[input_traversal] << " ";
     }
-    ~vector() noexcept
+    return vector_ostream;
+  }
+  /*
+   * @brief  #### `small_vector` 类模板
+
+      *   - 带内联容量的动态数组：前 `inline_capacity` 个元素直接存放在对象内部，超过后才搬到堆上
+
+      *   - 接口与 `vector` 保持一致，适合大多数情况下只有几个元素的临时数组，避免每次都分配堆内存
+
+      *   - 扩容、插入、删除等逻辑与 `vector` 共用 `vector_base`，本类只负责内联存储与堆存储之间的切换
+
+      * 模板参数:
+
+      * * - `vector_type`: 元素类型
+      *
+      * * - `inline_capacity`: 对象内可存放的元素个数
+      *
+      * * - `vector_allocator`: 溢出到堆上时使用的分配器，默认为 `std::allocator<vector_type>`
+
+      * 新增方法:
+
+      * * - `is_inline()`: 元素当前是否存放在对象内部
+
+      * 注意事项:
+
+      * * - 对象大小至少为 `inline_capacity * sizeof(vector_type)`，不宜把内联容量设得过大
+      *
+      * * - 元素在对象内部时，移动和交换需要逐个移动元素（O(n)），原迭代器失效；在堆上时只交换指针
+      *
+      * * - 容量变小不会搬回对象内部，`clear()` 后仍使用原来的堆内存
+  */
+  template <typename vector_type, uint64_t inline_capacity, typename vector_allocator = std::allocator<vector_type>>
+  class small_vector : public vector_base<small_vector<vector_type, inline_capacity, vector_allocator>, vector_type, vector_allocator>
+  {
+    using base_type = vector_base<small_vector<vector_type, inline_capacity, vector_allocator>, vector_type, vector_allocator>;
+    friend base_type;
+
+  public:
+    using typename base_type::allocator_type;
+    using typename base_type::const_iterator;
+    using typename base_type::const_reverse_iterator;
+    using typename base_type::iterator;
+    using typename base_type::reverse_iterator;
+    using base_type::capacity;
+
+  private:
+    static_assert(inline_capacity > 0, "small_vector 的内联容量必须大于 0");
+    using typename base_type::allocator_traits;
+    using base_type::_capacity_pointer;
+    using base_type::_data_pointer;
+    using base_type::_size_pointer;
+    using base_type::allocator_object;
+    using base_type::check_location;
+    using base_type::copy_construct;
+    using base_type::destroy_range;
+    alignas(vector_type) unsigned char inline_buffer[inline_capacity * sizeof(vector_type)];
+    [[nodiscard]] iterator inline_data() noexcept
     {
-      delete[] _data_pointer;
-      _data_pointer = _size_pointer = _capacity_pointer = nullptr;
+      return std::launder(reinterpret_cast<vector_type *>(inline_buffer));
     }
-    void swap(vector<vector_type> &vector_data) noexcept
+    void reset_to_inline() noexcept
     {
-      standard_con::algorithm::swap(_data_pointer, vector_data._data_pointer);
-      standard_con::algorithm::swap(_size_pointer, vector_data._size_pointer);
-      standard_con::algorithm::swap(_capacity_pointer, vector_data._capacity_pointer);
+      _data_pointer = _size_pointer = inline_data();
+      _capacity_pointer = _data_pointer + inline_capacity;
     }
-    iterator erase(iterator delete_position) noexcept
+    void release_buffer() noexcept
     {
-      // 删除元素
-      iterator next_position = delete_position + 1;
-      while (next_position != _size_pointer)
+      // 内联存储不是分配出来的，不需要释放
+      if (!is_inline())
       {
-        *(next_position - 1) = *next_position; //(temp-1)就是pos的位置，从pos位置开始覆盖，覆盖到倒数第1个结束，最后一个会被--屏蔽掉
-        ++next_position;
+        allocator_traits::deallocate(allocator_object, _data_pointer, capacity());
       }
-      --_size_pointer;
-      return next_position; // 返回下一个位置地址
     }
-    vector<vector_type> &resize(const uint64_t &new_container_capacity, const vector_type &vector_data = vector_type())
+    void release_storage() noexcept
     {
-      try
+      destroy_range(_data_pointer, _size_pointer);
+      release_buffer();
+      reset_to_inline();
+    }
+    void steal_resources(small_vector &vector_data) noexcept(std::is_nothrow_move_constructible_v<vector_type>)
+    {
+      // 调用前本对象必须为空且处于内联状态：堆上的数组直接接管指针，内联元素只能逐个移动
+      if (vector_data.is_inline())
       {
-        uint64_t original_size = size(); // 先保存原来的元素数量
-        if (static_cast<uint64_t>(_capacity_pointer - _data_pointer) < new_container_capacity)
+        for (iterator source_position = vector_data._data_pointer; source_position != vector_data._size_pointer; ++source_position, ++_size_pointer)
         {
-          // 涉及到迭代器失效问题，不能调用size()函数，会释放未知空间
-          auto new_vector_type_array = new vector_type[new_container_capacity];
-          // 复制原先的数据
-          for (uint64_t original_data_traversal = 0; original_data_traversal < original_size; original_data_traversal++)
-          {
-            new_vector_type_array[original_data_traversal] = std::move(_data_pointer[original_data_traversal]);
-          }
-          for (uint64_t assignment_traversal = original_size; assignment_traversal < new_container_capacity; ++assignment_traversal)
-          {
-            new_vector_type_array[assignment_traversal] = vector_data;
-          }
-          delete[] _data_pointer;
-          _data_pointer = new_vector_type_array;
-          _size_pointer = _data_pointer + original_size; // 使用 original_size 来重建 _size_pointer
-          _capacity_pointer = _data_pointer + new_container_capacity;
+          allocator_traits::construct(allocator_object, _size_pointer, std::move(*source_position));
         }
+        vector_data.clear();
       }
-      catch (const std::bad_alloc &process)
+      else
       {
-        delete[] _data_pointer;
-        _data_pointer = _size_pointer = _capacity_pointer = nullptr;
-        std::cerr << process.what() << std::endl;
-        throw;
+        _data_pointer = vector_data._data_pointer;
+        _size_pointer = vector_data._size_pointer;
+        _capacity_pointer = vector_data._capacity_pointer;
+        vector_data.reset_to_inline();
       }
-      return *this;
     }
-    vector<vector_type> &push_back(const vector_type &vector_type_data)
+
+  public:
+    using base_type::reserve;
+    using base_type::resize;
+    [[nodiscard]] bool is_inline() const noexcept
     {
-      if (_size_pointer == _capacity_pointer)
-      {
-        const uint64_t new_container_capacity = _data_pointer == nullptr ? 10 : static_cast<uint64_t>((_capacity_pointer - _data_pointer) * 2);
-        resize(new_container_capacity);
-      }
-      // 注意—_size_pointer是原生迭代器指针，需要解引用才能赋值
-      *_size_pointer = vector_type_data;
-      ++_size_pointer;
-      return *this;
+      return static_cast<const void *>(_data_pointer) == static_cast<const void *>(inline_buffer);
     }
-    vector<vector_type> &push_back(vector_type &&vector_type_data)
+
+    small_vector() noexcept(std::is_nothrow_default_constructible_v<vector_allocator>) : base_type()
     {
-      if (_size_pointer == _capacity_pointer)
-      {
-        const uint64_t new_container_capacity = _data_pointer == nullptr ? 10 : static_cast<uint64_t>((_capacity_pointer - _data_pointer) * 2);
-        resize(new_container_capacity);
-      }
-      // 注意_size_pointer是原生迭代器指针，需要解引用才能赋值
-      *_size_pointer = std::move(vector_type_data);
-      // new (_data_pointer) vector_type(std::forward<vector_type>(vector_type_data));
-      ++_size_pointer;
-      return *this;
+      reset_to_inline();
     }
-    vector<vector_type> &pop_back()
+    explicit small_vector(const vector_allocator &allocator_data) noexcept : base_type(allocator_data)
     {
-      if (_size_pointer > _data_pointer)
-      {                  // 至少有一个元素
-        --_size_pointer; // 尾指针前移
-      }
-      return *this;
+      reset_to_inline();
     }
-    vector<vector_type> &push_front(const vector_type &vector_type_data)
+    explicit small_vector(const uint64_t &container_capacity, const vector_type &vector_data = vector_type(),
+                          const vector_allocator &allocator_data = vector_allocator())
+        : base_type(allocator_data)
     {
-      // 头插
-      if (_size_pointer == _capacity_pointer)
+      reset_to_inline();
+      try
       {
-        const uint64_t new_container_size = _data_pointer == nullptr ? 10 : static_cast<uint64_t>((_capacity_pointer - _data_pointer) * 2);
-        resize(new_container_size);
+        resize(container_capacity, vector_data);
       }
-      for (uint64_t container_size = size(); container_size > 0; --container_size)
+      catch (...)
       {
-        _data_pointer[container_size] = _data_pointer[container_size - 1];
+        release_storage();
+        throw;
       }
-      *_data_pointer = vector_type_data;
-      ++_size_pointer;
-      return *this;
     }
-    vector<vector_type> &pop_front()
+    small_vector(std::initializer_list<vector_type> lightweight_container, const vector_allocator &allocator_data = vector_allocator())
+        : base_type(allocator_data)
     {
-      if (size() > 0)
+      reset_to_inline();
+      try
       {
-        for (uint64_t assignment_traversal = 1; assignment_traversal < size(); assignment_traversal++)
-        {
-          _data_pointer[assignment_traversal - 1] = _data_pointer[assignment_traversal];
-        }
-        --_size_pointer;
+        reserve(lightweight_container.size());
+        copy_construct(lightweight_container.begin(), lightweight_container.end());
+      }
+      catch (...)
+      {
+        release_storage();
+        throw;
       }
-      return *this;
     }
-    vector_type &operator[](const uint64_t &access_location)
+    small_vector(const small_vector &vector_data)
+        : base_type(allocator_traits::select_on_container_copy_construction(vector_data.allocator_object))
     {
+      reset_to_inline();
       try
       {
-        if (access_location >= capacity())
-        {
-          throw custom_exception::fault("传入参数越界", "vector::operatot[]", __LINE__);
-        }
-        else
-        {
-          return _data_pointer[access_location];
-        }
+        reserve(vector_data.size());
+        copy_construct(vector_data._data_pointer, vector_data._size_pointer);
       }
-      catch (const custom_exception::fault &process)
+      catch (...)
       {
-        std::cerr << process.what() << " " << process.function_name_get() << " " << process.line_number_get() << std::endl;
+        release_storage();
         throw;
       }
     }
-    const vector_type &operator[](const uint64_t &access_location) const
+    small_vector(small_vector &&vector_data) noexcept(std::is_nothrow_move_constructible_v<vector_type>)
+        : base_type(std::move(vector_data.allocator_object))
     {
-      // return _data_pointer[access_location];
-      try
+      reset_to_inline();
+      steal_resources(vector_data);
+    }
+    ~small_vector() noexcept
+    {
+      release_storage();
+    }
+    vector_type &find(const uint64_t &find_size)
+    {
+      check_location(find_size, "small_vector::find");
+      return _data_pointer[find_size];
+    }
+    void swap(small_vector &vector_data) noexcept(std::is_nothrow_move_constructible_v<vector_type>)
+    {
+      if (this == &vector_data)
       {
-        if (access_location >= capacity())
-        {
-          throw custom_exception::fault("传入参数越界", "vector::operatot[]", __LINE__);
-        }
-        else
-        {
-          return _data_pointer[access_location];
-        }
+        return;
       }
-      catch (const custom_exception::fault &process)
+      if (!is_inline() && !vector_data.is_inline())
       {
-        std::cerr << process.what() << " " << process.function_name_get() << " " << process.line_number_get() << std::endl;
-        throw;
+        standard_con::algorithm::swap(_data_pointer, vector_data._data_pointer);
+        standard_con::algorithm::swap(_size_pointer, vector_data._size_pointer);
+        standard_con::algorithm::swap(_capacity_pointer, vector_data._capacity_pointer);
+        return;
       }
+      // 有一方是内联存储时借助移动完成交换
+      small_vector temporary_vector_object(std::move(vector_data));
+      vector_data.release_storage();
+      vector_data.steal_resources(*this);
+      release_storage();
+      steal_resources(temporary_vector_object);
+    }
+    vector_type &operator[](const uint64_t &access_location)
+    {
+      check_location(access_location, "small_vector::operator[]");
+      return _data_pointer[access_location];
+    }
+    const vector_type &operator[](const uint64_t &access_location) const
+    {
+      check_location(access_location, "small_vector::operator[]");
+      return _data_pointer[access_location];
     }
-    vector<vector_type> &operator=(const vector<vector_type> &vector_data)
+    small_vector &operator=(const small_vector &vector_data)
     {
       if (this != &vector_data)
       {
-        vector<vector_type> return_vector_object(vector_data); // 拷贝构造
-        swap(return_vector_object);                            // 交换资源，temp析构时会释放原资源
+        small_vector return_vector_object(vector_data);
+        swap(return_vector_object);
       }
       return *this;
     }
-    vector<vector_type> &operator=(vector<vector_type> &&vector_mobile_data) noexcept
+    small_vector &operator=(small_vector &&vector_mobile_data) noexcept(std::is_nothrow_move_constructible_v<vector_type>)
     {
       if (this != &vector_mobile_data)
       {
-        _data_pointer = std::move(vector_mobile_data._data_pointer);
-        _size_pointer = std::move(vector_mobile_data._size_pointer);
-        _capacity_pointer = std::move(vector_mobile_data._capacity_pointer);
-        vector_mobile_data._data_pointer = vector_mobile_data._size_pointer = vector_mobile_data._capacity_pointer = nullptr;
+        release_storage();
+        steal_resources(vector_mobile_data);
       }
       return *this;
     }
-    vector<vector_type> &operator+=(const vector<vector_type> &vector_data)
+    friend std::ostream &operator<<(std::ostream &vector_ostream, const small_vector &dynamic_arrays_data)
     {
-      if (vector_data.size() == 0 || vector_data._data_pointer == nullptr)
-      {
-        return *this;
-      }
-      uint64_t vector_data_size = vector_data.size();
-      uint64_t container_size = size();
-      uint64_t container_capacity = capacity();
-      if (vector_data_size + container_size > container_capacity)
+      for (const vector_type &output_value : dynamic_arrays_data)
       {
-        resize(vector_data_size + container_size);
+        vector_ostream << output_value << " ";
       }
-      uint64_t array_counter = 0;
-      for (uint64_t slicing_traversal = container_size; slicing_traversal < (vector_data_size + container_size); ++slicing_traversal)
-      {
-        _data_pointer[slicing_traversal] = vector_data._data_pointer[array_counter++];
-      }
-      _size_pointer = _data_pointer + (vector_data_size + container_size);
-      return *this;
+      return vector_ostream;
     }
-    template <typename const_vector_output_templates>
-    friend std::ostream &operator<<(std::ostream &vector_ostream, const vector<const_vector_output_templates> &dynamic_arrays_data);
   };
-  template <typename const_vector_output_templates>
-  std::ostream &operator<<(std::ostream &vector_ostream, const vector<const_vector_output_templates> &dynamic_arrays_data)
-  {
-    for (uint64_t input_traversal = 0; input_traversal < dynamic_arrays_data.size(); input_traversal++)
-    {
-      vector_ostream << dynamic_arrays_data[input_traversal] << " ";
-    }
-    return vector_ostream;
-  }
 }
 namespace standard_con
 {
+  using vector_container::small_vector;
   using vector_container::vector;
-}
\ No newline at end of file
+}
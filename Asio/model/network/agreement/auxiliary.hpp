@@ -11,9 +11,11 @@
 #include <chrono>
 #include <cstdint>
 #include <string_view>
+#include <charconv>
 #include <boost/json.hpp>
 #include "./json.hpp"
 #include "../crypt/encryption.hpp"
+#include "../../container/simulate_perfect.hpp"
 
 
 
@@ -49,6 +51,28 @@ namespace protocol::auxiliary
     CUSTOM
   }; // end enum class checksum_type
 
+  /**
+   * @brief 协议头中有专门成员的头部字段
+   * @details 解析时按名称查 `reserved_header_map`，其余字段统一存入 `_headers`
+   */
+  enum class reserved_header : std::uint8_t
+  {
+    NONE,
+    USER_AGENT, // 请求头的`User-Agent`
+    TIMESTAMP,  // 请求头和响应头的`Timestamp`
+    SERVER      // 响应头的`Server`
+  }; // end enum class reserved_header
+
+  /**
+   * @brief 头部字段名到`reserved_header`的映射
+   * @details 编译期建成的完美哈希表，匹配字段名只需一次哈希和一次比较，不必先构造`std::string`
+   */
+  inline constexpr auto reserved_header_map = standard_con::make_perfect_hash_map<std::string_view, reserved_header>({
+      {"User-Agent", reserved_header::USER_AGENT},
+      {"Timestamp", reserved_header::TIMESTAMP},
+      {"Server", reserved_header::SERVER},
+  });
+
   /**
    * @brief 协议头基类
    * @details 提供协议头的基础接口，支持自定义协议类型
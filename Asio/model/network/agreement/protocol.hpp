@@ -864,15 +864,16 @@ bool protocol::request_header::from_string(std::string_view data)
       if (k.empty() || k.size() > 256 || v.size() > 8192)
         return false;
 
-      std::string key(k), val(v);
-      
-      if (key == "User-Agent")
+      switch (auxiliary::reserved_header_map.value_or(k, auxiliary::reserved_header::NONE))
+      {
+      case auxiliary::reserved_header::USER_AGENT:
       {
-        if (val.size() > 512) // 限制User-Agent长度
+        if (v.size() > 512) // 限制User-Agent长度
           return false;
-        temp_user_agent = val;
+        temp_user_agent = v;
+        break;
       }
-      else if (key == "Timestamp")
+      case auxiliary::reserved_header::TIMESTAMP:
       {
         std::int64_t ts;
         if (safe_parse(v, ts))
@@ -883,12 +884,15 @@ bool protocol::request_header::from_string(std::string_view data)
             return false;
           temp_timestamp = std::chrono::system_clock::time_point(std::chrono::milliseconds(ts));
         }
+        break;
       }
-      else
+      default:
       {
         if (temp_headers.size() >= max_headers - 10) // 为特殊头部预留空间
           return false;
-        temp_headers[key] = val;
+        temp_headers[std::string(k)] = std::string(v);
+        break;
+      }
       }
     }
     ++header_count;
@@ -1032,15 +1036,16 @@ bool protocol::response_header::from_string(std::string_view data)
       if (k.empty() || k.size() > 256 || v.size() > 8192)
         return false;
 
-      std::string key(k), val(v);
-      
-      if (key == "Server")
+      switch (auxiliary::reserved_header_map.value_or(k, auxiliary::reserved_header::NONE))
+      {
+      case auxiliary::reserved_header::SERVER:
       {
-        if (val.size() > 512)
+        if (v.size() > 512)
           return false;
-        temp_server = val;
+        temp_server = v;
+        break;
       }
-      else if (key == "Timestamp")
+      case auxiliary::reserved_header::TIMESTAMP:
       {
         std::int64_t ts;
         if (safe_parse(v, ts))
@@ -1051,12 +1056,15 @@ bool protocol::response_header::from_string(std::string_view data)
             return false;
           temp_timestamp = std::chrono::system_clock::time_point(std::chrono::milliseconds(ts));
         }
+        break;
       }
-      else
+      default:
       {
         if (temp_headers.size() >= max_headers - 10)
           return false;
-        temp_headers[key] = val;
+        temp_headers[std::string(k)] = std::string(v);
+        break;
+      }
       }
     }
     ++header_count;